@@ -12,6 +12,7 @@
 #include "audio_core/common/common.h"
 #include "audio_core/sink/sink.h"
 #include "common/logging/log.h"
+#include "common/subsystem_profiler.h"
 #include "common/thread.h"
 #include "core/core.h"
 #include "core/core_timing.h"
@@ -202,6 +203,7 @@ void AudioRenderer::Main(std::stop_token stop_token) {
 
                     // Process the command list
                     {
+                        const Common::ScopedSubsystemTimer timer{Common::Subsystem::Audio};
                         render_times_taken[index] =
                             command_list_processor.Process(index) - start_time;
                     }
@@ -0,0 +1,92 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <algorithm>
+#include <iterator>
+#include <numeric>
+#include <string_view>
+
+#include <fmt/format.h>
+
+#include "common/benchmark_report.h"
+#include "common/scm_rev.h"
+
+namespace Common {
+namespace {
+using DoubleMs = std::chrono::duration<double, std::milli>;
+
+std::string EscapeJson(std::string_view string) {
+    std::string escaped;
+    escaped.reserve(string.size());
+    for (const char c : string) {
+        switch (c) {
+        case '"':
+            escaped += "\\\"";
+            break;
+        case '\\':
+            escaped += "\\\\";
+            break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                escaped += fmt::format("\\u{:04x}", static_cast<unsigned>(c));
+            } else {
+                escaped += c;
+            }
+            break;
+        }
+    }
+    return escaped;
+}
+
+/// Returns the value below which the given fraction of the sorted samples lie.
+double Percentile(const std::vector<double>& sorted, double fraction) {
+    if (sorted.empty()) {
+        return 0.0;
+    }
+    const auto index = static_cast<size_t>(fraction * static_cast<double>(sorted.size() - 1));
+    return sorted[index];
+}
+} // Anonymous namespace
+
+std::string FormatBenchmarkReport(const BenchmarkReport& report) {
+    std::vector<double> sorted = report.frametimes;
+    std::sort(sorted.begin(), sorted.end());
+    const double mean =
+        sorted.empty() ? 0.0
+                       : std::accumulate(sorted.begin(), sorted.end(), 0.0) /
+                             static_cast<double>(sorted.size());
+
+    std::string result;
+    auto out = std::back_inserter(result);
+    fmt::format_to(out, "{{\n");
+    fmt::format_to(out, "  \"version\": \"{} {}\",\n", EscapeJson(g_scm_branch),
+                   EscapeJson(g_scm_desc));
+    fmt::format_to(out, "  \"program_id\": \"{:016X}\",\n", report.program_id);
+    fmt::format_to(out, "  \"multi_core\": {},\n", report.multi_core);
+    fmt::format_to(out, "  \"frames_requested\": {},\n", report.frames_requested);
+    fmt::format_to(out, "  \"frames\": {},\n", report.frames_run);
+    fmt::format_to(out, "  \"completed\": {},\n", report.Completed());
+    fmt::format_to(out, "  \"wall_time_ms\": {:.3f},\n", DoubleMs{report.wall_time}.count());
+    fmt::format_to(out,
+                   "  \"frametime_ms\": {{\"mean\": {:.3f}, \"p50\": {:.3f}, \"p99\": {:.3f}, "
+                   "\"max\": {:.3f}}},\n",
+                   mean, Percentile(sorted, 0.5), Percentile(sorted, 0.99),
+                   sorted.empty() ? 0.0 : sorted.back());
+    fmt::format_to(out, "  \"subsystems\": {{\n");
+    const double wall_seconds = std::chrono::duration<double>{report.wall_time}.count();
+    for (size_t index = 0; index < NumSubsystems; ++index) {
+        const auto& totals = report.subsystem_totals[index];
+        const double time_ms = DoubleMs{totals.time}.count();
+        // Host time spent per second of the run, comparable between runs of different lengths
+        const double ms_per_second = wall_seconds > 0.0 ? time_ms / wall_seconds : 0.0;
+        fmt::format_to(out,
+                       "    \"{}\": {{\"time_ms\": {:.3f}, \"ms_per_s\": {:.3f}, \"count\": "
+                       "{}}}{}\n",
+                       GetSubsystemName(static_cast<Subsystem>(index)), time_ms, ms_per_second,
+                       totals.count, index + 1 < NumSubsystems ? "," : "");
+    }
+    fmt::format_to(out, "  }}\n}}\n");
+    return result;
+}
+
+} // namespace Common
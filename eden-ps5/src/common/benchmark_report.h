@@ -0,0 +1,35 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "common/common_types.h"
+#include "common/subsystem_profiler.h"
+
+namespace Common {
+
+/// Results of a headless benchmark run.
+struct BenchmarkReport {
+    u64 program_id{};
+    u64 frames_requested{};
+    u64 frames_run{};
+    bool multi_core{};                               ///< Whether the run used multicore CPU
+    std::chrono::steady_clock::duration wall_time{}; ///< Host time of the whole run
+    std::vector<double> frametimes;                  ///< Guest frametimes in milliseconds
+    std::array<SubsystemProfiler::Totals, NumSubsystems> subsystem_totals{};
+
+    /// Returns true when the run presented every requested frame.
+    [[nodiscard]] bool Completed() const {
+        return frames_run == frames_requested;
+    }
+};
+
+/// Formats the report as JSON. The run configuration is written before the results.
+[[nodiscard]] std::string FormatBenchmarkReport(const BenchmarkReport& report);
+
+} // namespace Common
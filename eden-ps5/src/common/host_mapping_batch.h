@@ -0,0 +1,132 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <vector>
+#include "common/common_types.h"
+#include "common/host_memory.h"
+
+namespace Common {
+
+/**
+ * Records fastmem arena updates (map, unmap and protect) and applies them later in order,
+ * merging each operation into the previous one when both describe adjacent ranges with the same
+ * attributes. A page table update that touches many neighbouring blocks then turns into a handful
+ * of host syscalls instead of one per block.
+ *
+ * Separate heap operations are never merged, as the heap tracker keeps per-mapping bookkeeping.
+ */
+class HostMappingBatch {
+public:
+    void Map(size_t virtual_offset, size_t host_offset, size_t length, MemoryPermission perms,
+             bool separate_heap) {
+        if (!operations.empty() && !separate_heap) {
+            Operation& last = operations.back();
+            if (last.type == Type::Map && !last.separate_heap && last.perms == perms &&
+                last.virtual_offset + last.length == virtual_offset &&
+                last.host_offset + last.length == host_offset) {
+                last.length += length;
+                return;
+            }
+        }
+        operations.push_back({Type::Map, virtual_offset, host_offset, length, perms, separate_heap});
+    }
+
+    void Unmap(size_t virtual_offset, size_t length, bool separate_heap) {
+        if (!operations.empty() && !separate_heap) {
+            Operation& last = operations.back();
+            if (last.type == Type::Unmap && !last.separate_heap &&
+                TryMergeAdjacent(last, virtual_offset, length)) {
+                return;
+            }
+        }
+        operations.push_back({Type::Unmap, virtual_offset, 0, length, {}, separate_heap});
+    }
+
+    void Protect(size_t virtual_offset, size_t length, MemoryPermission perms) {
+        if (!operations.empty()) {
+            Operation& last = operations.back();
+            if (last.type == Type::Protect && last.perms == perms &&
+                TryMergeAdjacent(last, virtual_offset, length)) {
+                return;
+            }
+        }
+        operations.push_back({Type::Protect, virtual_offset, 0, length, perms, false});
+    }
+
+    /**
+     * Applies every recorded operation to the given backend and clears the batch.
+     *
+     * @param backend Object exposing the HostMemory Map/Unmap/Protect interface.
+     * @param on_update Invoked with (virtual_offset, length) after each applied map or protect, so
+     *                  the caller can restore protections that were changed while the operation
+     *                  was pending.
+     */
+    template <typename Backend, typename OnUpdate>
+    void Flush(Backend& backend, OnUpdate&& on_update) {
+        for (const Operation& op : operations) {
+            switch (op.type) {
+            case Type::Map:
+                backend.Map(op.virtual_offset, op.host_offset, op.length, op.perms,
+                            op.separate_heap);
+                on_update(op.virtual_offset, op.length);
+                break;
+            case Type::Unmap:
+                backend.Unmap(op.virtual_offset, op.length, op.separate_heap);
+                break;
+            case Type::Protect:
+                backend.Protect(op.virtual_offset, op.length, op.perms);
+                on_update(op.virtual_offset, op.length);
+                break;
+            }
+        }
+        operations.clear();
+    }
+
+    template <typename Backend>
+    void Flush(Backend& backend) {
+        Flush(backend, [](size_t, size_t) {});
+    }
+
+    [[nodiscard]] size_t NumPending() const noexcept {
+        return operations.size();
+    }
+
+    [[nodiscard]] bool Empty() const noexcept {
+        return operations.empty();
+    }
+
+private:
+    enum class Type : u8 {
+        Map,
+        Unmap,
+        Protect,
+    };
+
+    struct Operation {
+        Type type;
+        size_t virtual_offset;
+        size_t host_offset;
+        size_t length;
+        MemoryPermission perms;
+        bool separate_heap;
+    };
+
+    static bool TryMergeAdjacent(Operation& last, size_t virtual_offset, size_t length) {
+        if (last.virtual_offset + last.length == virtual_offset) {
+            last.length += length;
+            return true;
+        }
+        if (virtual_offset + length == last.virtual_offset) {
+            last.virtual_offset = virtual_offset;
+            last.length += length;
+            return true;
+        }
+        return false;
+    }
+
+    std::vector<Operation> operations;
+};
+
+} // namespace Common
@@ -22,6 +22,9 @@
 #include <sys/mman.h>
 #include <sys/random.h>
 #include <unistd.h>
+#ifdef __linux__
+#include <sys/syscall.h>
+#endif
 #include "common/scope_exit.h"
 
 // FreeBSD
@@ -37,6 +40,7 @@
 
 #include <mutex>
 #include <random>
+#include <vector>
 
 #include "common/alignment.h"
 #include "common/assert.h"
@@ -97,7 +101,8 @@ static void GetFuncAddress(Common::DynamicLibrary& dll, const char* name, T& pfn
 
 class HostMemory::Impl {
 public:
-    explicit Impl(size_t backing_size_, size_t virtual_size_)
+    explicit Impl(size_t backing_size_, size_t virtual_size_,
+                  [[maybe_unused]] HostMemoryOptions options)
         : backing_size{backing_size_}, virtual_size{virtual_size_}, process{GetCurrentProcess()},
           kernelbase_dll("Kernelbase") {
         if (!kernelbase_dll.IsOpen()) {
@@ -210,6 +215,9 @@ public:
     const size_t backing_size; ///< Size of the backing memory in bytes
     const size_t virtual_size; ///< Size of the virtual address placeholder in bytes
 
+    // Large pages cannot back placeholder views, so the huge page option is ignored here.
+    bool huge_pages_enabled{};
+
     u8* backing_base{};
     u8* virtual_base{};
 
@@ -474,9 +482,62 @@ static int shm_open_anon(int flags, mode_t mode) {
 }
 #endif
 
+/// Maps the backing file at a huge page aligned address, so that the linear view of the backing
+/// memory can be mapped with PMD sized pages.
+static void* MapBackingAligned(int fd, size_t backing_size) {
+    void* const reserve = mmap(nullptr, backing_size + HugePageSize, PROT_NONE,
+                               MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (reserve == MAP_FAILED) {
+        return MAP_FAILED;
+    }
+    const uintptr_t reserve_start = reinterpret_cast<uintptr_t>(reserve);
+    const uintptr_t aligned_start = AlignUp(reserve_start, HugePageSize);
+    const uintptr_t reserve_end = reserve_start + backing_size + HugePageSize;
+    const uintptr_t aligned_end = aligned_start + backing_size;
+
+    // Trim the reservation down to the aligned window and replace it with the backing file.
+    if (aligned_start != reserve_start) {
+        munmap(reserve, aligned_start - reserve_start);
+    }
+    if (reserve_end != aligned_end) {
+        munmap(reinterpret_cast<void*>(aligned_end), reserve_end - aligned_end);
+    }
+    void* const ret = mmap(reinterpret_cast<void*>(aligned_start), backing_size,
+                           PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0);
+    if (ret == MAP_FAILED) {
+        munmap(reinterpret_cast<void*>(aligned_start), backing_size);
+    }
+    return ret;
+}
+
+/// Sets a preferred NUMA node policy on the given shared mapping. For shared memory the policy is
+/// stored on the backing object itself, so it applies to every view of it.
+static bool BindToLocalNumaNode([[maybe_unused]] void* address, [[maybe_unused]] size_t size) {
+#if defined(__linux__) && defined(SYS_mbind) && defined(SYS_getcpu)
+    constexpr int MPOL_PREFERRED_MODE = 1;
+    constexpr size_t BitsPerWord = sizeof(unsigned long) * 8;
+
+    unsigned int cpu{};
+    unsigned int node{};
+    if (syscall(SYS_getcpu, &cpu, &node, nullptr) != 0) {
+        return false;
+    }
+    std::vector<unsigned long> node_mask(node / BitsPerWord + 1);
+    node_mask[node / BitsPerWord] |= 1UL << (node % BitsPerWord);
+    if (syscall(SYS_mbind, address, size, MPOL_PREFERRED_MODE, node_mask.data(),
+                node_mask.size() * BitsPerWord, 0) != 0) {
+        return false;
+    }
+    LOG_INFO(HW_Memory, "Backing memory prefers NUMA node {}", node);
+    return true;
+#else
+    return false;
+#endif
+}
+
 class HostMemory::Impl {
 public:
-    explicit Impl(size_t backing_size_, size_t virtual_size_)
+    explicit Impl(size_t backing_size_, size_t virtual_size_, HostMemoryOptions options)
         : backing_size{backing_size_}, virtual_size{virtual_size_} {
         long page_size = sysconf(_SC_PAGESIZE);
         ASSERT_MSG(page_size == 0x1000, "page size {:#x} is incompatible with 4K paging",
@@ -498,10 +559,31 @@ public:
         int ret = ftruncate(fd, backing_size);
         ASSERT_MSG(ret == 0, "ftruncate failed with {}, are you out-of-memory?", strerror(errno));
 
-        backing_base = static_cast<u8*>(
-            mmap(nullptr, backing_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0));
+        if (options.huge_pages) {
+            backing_base = static_cast<u8*>(MapBackingAligned(fd, backing_size));
+        }
+        if (backing_base == MAP_FAILED) {
+            backing_base = static_cast<u8*>(
+                mmap(nullptr, backing_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0));
+        }
         ASSERT_MSG(backing_base != MAP_FAILED, "mmap failed: {}", strerror(errno));
 
+        // Both policies must be in place before the first page of the backing file is touched.
+        if (options.numa_local && !BindToLocalNumaNode(backing_base, backing_size)) {
+            LOG_WARNING(HW_Memory, "Failed to set NUMA policy for backing memory: {}",
+                        strerror(errno));
+        }
+#if defined(__linux__)
+        if (options.huge_pages) {
+            // Shared memory only uses huge pages when shmem_enabled is set to advise or always.
+            huge_pages_enabled = madvise(backing_base, backing_size, MADV_HUGEPAGE) == 0;
+            if (!huge_pages_enabled) {
+                LOG_WARNING(HW_Memory, "Huge pages unavailable for backing memory: {}",
+                            strerror(errno));
+            }
+        }
+#endif
+
         // Virtual memory initialization
         virtual_base = virtual_map_base = static_cast<u8*>(ChooseVirtualBase(virtual_size));
         ASSERT_MSG(virtual_base != MAP_FAILED, "mmap failed: {}", strerror(errno));
@@ -539,6 +621,16 @@ public:
         void* ret = mmap(virtual_base + virtual_offset, length, flags, MAP_SHARED | MAP_FIXED, fd,
                          host_offset);
         ASSERT_MSG(ret != MAP_FAILED, "mmap failed: {}", strerror(errno));
+
+#if defined(__linux__)
+        // A file backed huge page can only be mapped with a single PMD when the virtual address
+        // and file offset share the same alignment. Fresh mappings start without the advice.
+        const uintptr_t map_address = reinterpret_cast<uintptr_t>(ret);
+        if (huge_pages_enabled && length >= HugePageSize &&
+            (map_address - host_offset) % HugePageSize == 0) {
+            madvise(ret, length, MADV_HUGEPAGE);
+        }
+#endif
     }
 
     void Unmap(size_t virtual_offset, size_t length) {
@@ -597,6 +689,8 @@ public:
     const size_t backing_size; ///< Size of the backing memory in bytes
     const size_t virtual_size; ///< Size of the virtual address placeholder in bytes
 
+    bool huge_pages_enabled{}; ///< True if the kernel accepted MADV_HUGEPAGE on the backing
+
     u8* backing_base{reinterpret_cast<u8*>(MAP_FAILED)};
     u8* virtual_base{reinterpret_cast<u8*>(MAP_FAILED)};
     u8* virtual_map_base{reinterpret_cast<u8*>(MAP_FAILED)};
@@ -649,7 +743,8 @@ private:
 
 class HostMemory::Impl {
 public:
-    explicit Impl([[maybe_unused]] size_t backing_size, [[maybe_unused]] size_t virtual_size) {
+    explicit Impl([[maybe_unused]] size_t backing_size, [[maybe_unused]] size_t virtual_size,
+                  [[maybe_unused]] HostMemoryOptions options) {
         // This is just a place holder.
         ASSERT_MSG(false, "Please implement fastmem in a proper way on your platform.");
     }
@@ -666,20 +761,22 @@ public:
 
     void EnableDirectMappedAddress() {}
 
+    bool huge_pages_enabled{};
     u8* backing_base{nullptr};
     u8* virtual_base{nullptr};
 };
 
 #endif // ^^^ Generic ^^^
 
-HostMemory::HostMemory(size_t backing_size_, size_t virtual_size_)
+HostMemory::HostMemory(size_t backing_size_, size_t virtual_size_, HostMemoryOptions options_)
     : backing_size(backing_size_), virtual_size(virtual_size_) {
     try {
         // Try to allocate a fastmem arena.
         // The implementation will fail with std::bad_alloc on errors.
         impl =
             std::make_unique<HostMemory::Impl>(AlignUp(backing_size, PageAlignment),
-                                               AlignUp(virtual_size, PageAlignment) + HugePageSize);
+                                               AlignUp(virtual_size, PageAlignment) + HugePageSize,
+                                               options_);
         backing_base = impl->backing_base;
         virtual_base = impl->virtual_base;
 
@@ -747,6 +844,10 @@ void HostMemory::ClearBackingRegion(size_t physical_offset, size_t length, u32 f
     }
 }
 
+bool HostMemory::HugePagesEnabled() const noexcept {
+    return impl && impl->huge_pages_enabled;
+}
+
 void HostMemory::EnableDirectMappedAddress() {
     if (impl) {
         impl->EnableDirectMappedAddress();
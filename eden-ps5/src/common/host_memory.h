@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2019 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -18,13 +21,22 @@ enum class MemoryPermission : u32 {
 };
 DECLARE_ENUM_FLAG_OPERATORS(MemoryPermission)
 
+/// Optional tuning of the host pages backing a HostMemory arena. Unsupported options are ignored.
+struct HostMemoryOptions {
+    /// Request transparent huge pages for the backing memory and for suitably aligned mappings.
+    bool huge_pages{};
+    /// Prefer allocating the backing memory on the NUMA node of the constructing thread.
+    bool numa_local{};
+};
+
 /**
  * A low level linear memory buffer, which supports multiple mappings
  * Its purpose is to rebuild a given sparse memory layout, including mirrors.
  */
 class HostMemory {
 public:
-    explicit HostMemory(size_t backing_size_, size_t virtual_size_);
+    explicit HostMemory(size_t backing_size_, size_t virtual_size_,
+                        HostMemoryOptions options_ = {});
     ~HostMemory();
 
     /**
@@ -65,6 +77,9 @@ public:
         return virtual_base;
     }
 
+    /// Returns true when the host accepted the huge page request for the backing memory.
+    [[nodiscard]] bool HugePagesEnabled() const noexcept;
+
     bool IsInVirtualRange(void* address) const noexcept {
         return address >= virtual_base && address < virtual_base + virtual_size;
     }
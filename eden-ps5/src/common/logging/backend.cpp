@@ -248,6 +248,10 @@ public:
         color_console_backend.SetEnabled(enabled);
     }
 
+    bool IsEnabled(Class log_class, Level log_level) const {
+        return filter.CheckMessage(log_class, log_level);
+    }
+
     void PushEntry(Class log_class, Level log_level, const char* filename, unsigned int line_num,
                    const char* function, std::string&& message) {
         if (!filter.CheckMessage(log_class, log_level)) {
@@ -364,6 +368,11 @@ void SetColorConsoleBackendEnabled(bool enabled) {
     Impl::Instance().SetColorConsoleBackendEnabled(enabled);
 }
 
+bool IsLogEnabled(Class log_class, Level log_level) {
+    return !initialization_in_progress_suppress_logging &&
+           Impl::Instance().IsEnabled(log_class, log_level);
+}
+
 void FmtLogMessageImpl(Class log_class, Level log_level, const char* filename,
                        unsigned int line_num, const char* function, fmt::string_view format,
                        const fmt::format_args& args) {
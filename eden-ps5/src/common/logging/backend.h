@@ -25,4 +25,7 @@ void DisableLoggingInTests();
 void SetGlobalFilter(const Filter& filter);
 
 void SetColorConsoleBackendEnabled(bool enabled);
+
+/// Returns whether a message of the given class and level would pass the global filter
+bool IsLogEnabled(Class log_class, Level log_level);
 } // namespace Common::Log
@@ -6,6 +6,7 @@
 #include <deque>
 #include <memory>
 #include <type_traits>
+#include <utility>
 
 #include "common/common_types.h"
 
@@ -57,10 +58,22 @@ public:
         free_items.push_back(id);
     }
 
+    /// Visits items from the least recently used up to the given tick, func may also take the
+    /// tick of the item and return true to stop
     template <typename Func>
     void ForEachItemBelow(TickType tick, Func&& func) {
+        if constexpr (std::is_invocable_v<Func, ObjectType, TickType>) {
+            ForEachItemBelowImpl(tick, std::forward<Func>(func));
+        } else {
+            ForEachItemBelowImpl(tick, [&func](ObjectType obj, TickType) { return func(obj); });
+        }
+    }
+
+private:
+    template <typename Func>
+    void ForEachItemBelowImpl(TickType tick, Func&& func) {
         static constexpr bool RETURNS_BOOL =
-            std::is_same_v<std::invoke_result<Func, ObjectType>, bool>;
+            std::is_same_v<std::invoke_result_t<Func, ObjectType, TickType>, bool>;
         Item* iterator = first_item;
         while (iterator) {
             if (static_cast<s64>(tick) - static_cast<s64>(iterator->tick) < 0) {
@@ -68,17 +81,16 @@ public:
             }
             Item* next = iterator->next;
             if constexpr (RETURNS_BOOL) {
-                if (func(iterator->obj)) {
+                if (func(iterator->obj, iterator->tick)) {
                     return;
                 }
             } else {
-                func(iterator->obj);
+                func(iterator->obj, iterator->tick);
             }
             iterator = next;
         }
     }
 
-private:
     size_t Build() {
         if (free_items.empty()) {
             const size_t item_id = item_pool.size();
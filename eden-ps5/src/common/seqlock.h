@@ -0,0 +1,82 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+#include "common/common_types.h"
+
+namespace Common {
+
+/**
+ * Sequence lock publishing a small trivially copyable value.
+ * Readers never block writers, they copy the value and retry if a write happened meanwhile.
+ * Concurrent writers wait for each other.
+ */
+template <typename T>
+class SeqLock {
+    static_assert(std::is_trivially_copyable_v<T>);
+    static_assert(std::atomic<u64>::is_always_lock_free);
+
+public:
+    SeqLock() {
+        Write(T{});
+    }
+
+    /// Publishes a new value
+    void Write(const T& value) {
+        std::array<u64, NumWords> copy{};
+        std::memcpy(copy.data(), &value, sizeof(T));
+
+        // An odd sequence marks a write in progress
+        u64 current = sequence.load(std::memory_order_relaxed);
+        do {
+            while ((current & 1) != 0) {
+                current = sequence.load(std::memory_order_relaxed);
+            }
+        } while (!sequence.compare_exchange_weak(current, current + 1, std::memory_order_acquire,
+                                                 std::memory_order_relaxed));
+        std::atomic_thread_fence(std::memory_order_release);
+        for (std::size_t index = 0; index < NumWords; ++index) {
+            words[index].store(copy[index], std::memory_order_relaxed);
+        }
+        sequence.store(current + 2, std::memory_order_release);
+    }
+
+    /// Returns the last published value
+    [[nodiscard]] T Read() const {
+        std::array<u64, NumWords> copy;
+        u64 begin;
+        u64 end;
+        do {
+            begin = sequence.load(std::memory_order_acquire);
+            for (std::size_t index = 0; index < NumWords; ++index) {
+                copy[index] = words[index].load(std::memory_order_relaxed);
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+            end = sequence.load(std::memory_order_relaxed);
+        } while ((begin & 1) != 0 || begin != end);
+
+        T value;
+        std::memcpy(&value, copy.data(), sizeof(T));
+        return value;
+    }
+
+    /// Returns a counter that changes every time a value is published
+    [[nodiscard]] u64 Version() const {
+        return sequence.load(std::memory_order_acquire) / 2;
+    }
+
+private:
+    static constexpr std::size_t NumWords = (sizeof(T) + sizeof(u64) - 1) / sizeof(u64);
+
+    std::atomic<u64> sequence{};
+    std::array<std::atomic<u64>, NumWords> words{};
+};
+
+} // namespace Common
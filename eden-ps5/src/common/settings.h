@@ -66,6 +66,7 @@ SWITCHABLE(AntiAliasing, false);
 SWITCHABLE(AspectRatio, true);
 SWITCHABLE(AstcDecodeMode, true);
 SWITCHABLE(AstcRecompression, true);
+SWITCHABLE(AstcRecompressionQuality, true);
 SWITCHABLE(AudioMode, true);
 SWITCHABLE(CpuBackend, true);
 SWITCHABLE(CpuAccuracy, true);
@@ -223,6 +224,8 @@ struct Values {
 #ifdef HAS_NCE
     SwitchableSetting<bool> lru_cache_enabled{linkage, false, "use_lru_cache", Category::System};
 #endif
+    Setting<bool> use_huge_pages{linkage, false, "use_huge_pages", Category::Core};
+    Setting<bool> use_numa_local_memory{linkage, false, "use_numa_local_memory", Category::Core};
 
     // Cpu
     SwitchableSetting<CpuBackend, true> cpu_backend{linkage,
@@ -465,6 +468,13 @@ struct Values {
                                                                   AstcRecompression::Bc3,
                                                                   "astc_recompression",
                                                                   Category::RendererAdvanced};
+    SwitchableSetting<AstcRecompressionQuality, true> astc_recompression_quality{
+        linkage,
+        AstcRecompressionQuality::Normal,
+        AstcRecompressionQuality::Fast,
+        AstcRecompressionQuality::High,
+        "astc_recompression_quality",
+        Category::RendererAdvanced};
     SwitchableSetting<VramUsageMode, true> vram_usage_mode{linkage,
                                                            VramUsageMode::Conservative,
                                                            VramUsageMode::Conservative,
@@ -537,6 +547,15 @@ struct Values {
                                                              Specialization::Default,
                                                              true,
                                                              true};
+    SwitchableSetting<bool> use_graphics_pipeline_library{linkage, false,
+                                                          "use_graphics_pipeline_library",
+                                                          Category::RendererAdvanced};
+    SwitchableSetting<bool> use_descriptor_buffer{linkage, false, "use_descriptor_buffer",
+                                                  Category::RendererAdvanced};
+    SwitchableSetting<bool> use_parallel_command_recording{
+        linkage, false, "use_parallel_command_recording", Category::RendererAdvanced};
+    SwitchableSetting<bool> optimize_shader_ir{linkage, false, "optimize_shader_ir",
+                                               Category::RendererAdvanced};
     SwitchableSetting<bool> enable_compute_pipelines{linkage, false, "enable_compute_pipelines",
                                                      Category::RendererAdvanced};
     SwitchableSetting<bool> use_video_framerate{linkage, false, "use_video_framerate",
@@ -750,6 +769,10 @@ struct Values {
     Setting<bool> enable_all_controllers{linkage, false, "enable_all_controllers",
                                          Category::Debugging};
     Setting<bool> perform_vulkan_check{linkage, true, "perform_vulkan_check", Category::Debugging};
+    Setting<bool> profile_kernel_locks{linkage, false, "profile_kernel_locks", Category::Debugging};
+    Setting<bool> profile_guest_code{linkage, false, "profile_guest_code", Category::Debugging};
+    Setting<bool> profile_guest_jit_blocks{linkage, false, "profile_guest_jit_blocks",
+                                           Category::Debugging};
 
     // Miscellaneous
     Setting<std::string> log_filter{linkage, "*:Info", "log_filter", Category::Miscellaneous};
@@ -0,0 +1,75 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <atomic>
+
+#include "common/subsystem_profiler.h"
+
+namespace Common {
+namespace {
+struct Counters {
+    std::atomic<u64> count;
+    std::atomic<u64> time_ns;
+};
+
+std::atomic<bool> profiler_enabled{false};
+std::array<Counters, NumSubsystems> counters{};
+} // Anonymous namespace
+
+std::string_view GetSubsystemName(Subsystem subsystem) {
+    switch (subsystem) {
+    case Subsystem::CpuJit:
+        return "cpu_jit";
+    case Subsystem::GpuThread:
+        return "gpu_thread";
+    case Subsystem::ShaderCompile:
+        return "shader_compile";
+    case Subsystem::Audio:
+        return "audio";
+    case Subsystem::Services:
+        return "services";
+    case Subsystem::Hid:
+        return "hid";
+    case Subsystem::Count:
+        break;
+    }
+    return "unknown";
+}
+
+namespace SubsystemProfiler {
+
+void SetEnabled(bool enabled) {
+    profiler_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool IsEnabled() {
+    return profiler_enabled.load(std::memory_order_relaxed);
+}
+
+void Record(Subsystem subsystem, std::chrono::nanoseconds time) {
+    auto& counter = counters[static_cast<size_t>(subsystem)];
+    counter.count.fetch_add(1, std::memory_order_relaxed);
+    counter.time_ns.fetch_add(static_cast<u64>(time.count()), std::memory_order_relaxed);
+}
+
+std::array<Totals, NumSubsystems> GetTotals() {
+    std::array<Totals, NumSubsystems> totals{};
+    for (size_t index = 0; index < NumSubsystems; ++index) {
+        totals[index] = {
+            .count = counters[index].count.load(std::memory_order_relaxed),
+            .time = std::chrono::nanoseconds{
+                static_cast<s64>(counters[index].time_ns.load(std::memory_order_relaxed))},
+        };
+    }
+    return totals;
+}
+
+void Reset() {
+    for (auto& counter : counters) {
+        counter.count.store(0, std::memory_order_relaxed);
+        counter.time_ns.store(0, std::memory_order_relaxed);
+    }
+}
+
+} // namespace SubsystemProfiler
+} // namespace Common
@@ -0,0 +1,78 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <string_view>
+
+#include "common/common_types.h"
+
+namespace Common {
+
+/// Emulator subsystems whose host time is accounted by the subsystem profiler.
+enum class Subsystem : u32 {
+    CpuJit,        ///< Guest code running in the CPU backends
+    GpuThread,     ///< Command processing on the GPU thread
+    ShaderCompile, ///< Shader translation and pipeline creation
+    Audio,         ///< Audio renderer command list processing
+    Services,      ///< HLE service request handling
+    Hid,           ///< HID shared memory update events
+    Count,
+};
+
+constexpr size_t NumSubsystems = static_cast<size_t>(Subsystem::Count);
+
+[[nodiscard]] std::string_view GetSubsystemName(Subsystem subsystem);
+
+/**
+ * Accumulates the host time spent in each subsystem across every thread. Profiling is disabled
+ * by default, in which case a timed scope only costs a relaxed atomic load. Times of subsystems
+ * running on several threads at once add up, so they can exceed the wall time of a run.
+ */
+namespace SubsystemProfiler {
+
+struct Totals {
+    u64 count;                     ///< Number of timed scopes that completed
+    std::chrono::nanoseconds time; ///< Total host time of the scopes
+};
+
+void SetEnabled(bool enabled);
+
+[[nodiscard]] bool IsEnabled();
+
+void Record(Subsystem subsystem, std::chrono::nanoseconds time);
+
+[[nodiscard]] std::array<Totals, NumSubsystems> GetTotals();
+
+void Reset();
+
+} // namespace SubsystemProfiler
+
+/// Records the host time of the enclosing scope to a subsystem when profiling is enabled.
+class ScopedSubsystemTimer {
+public:
+    explicit ScopedSubsystemTimer(Subsystem subsystem_)
+        : subsystem{subsystem_}, enabled{SubsystemProfiler::IsEnabled()} {
+        if (enabled) {
+            start = std::chrono::steady_clock::now();
+        }
+    }
+
+    ~ScopedSubsystemTimer() {
+        if (enabled) {
+            SubsystemProfiler::Record(subsystem, std::chrono::steady_clock::now() - start);
+        }
+    }
+
+    ScopedSubsystemTimer(const ScopedSubsystemTimer&) = delete;
+    ScopedSubsystemTimer& operator=(const ScopedSubsystemTimer&) = delete;
+
+private:
+    Subsystem subsystem;
+    bool enabled;
+    std::chrono::steady_clock::time_point start{};
+};
+
+} // namespace Common
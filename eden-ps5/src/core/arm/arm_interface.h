@@ -35,6 +35,7 @@ enum class HaltReason : u64 {
     BreakLoop = 0x02000000,
     SupervisorCall = 0x04000000,
     InstructionBreakpoint = 0x08000000,
+    ProfileSample = 0x10000000,
     PrefetchAbort = 0x20000000,
 };
 DECLARE_ENUM_FLAG_OPERATORS(HaltReason);
@@ -72,6 +73,12 @@ public:
     // Clear a range of the instruction cache for this CPU.
     virtual void InvalidateCacheRange(u64 addr, std::size_t size) = 0;
 
+    // Returns true when guest code runs as translated blocks, so that a halt lands on the guest
+    // address of a block. Backends executing guest code natively return false.
+    virtual bool UsesJitBlocks() const {
+        return true;
+    }
+
     // Get the current architecture.
     // This returns AArch64 when PSTATE.nRW == 0 and AArch32 when PSTATE.nRW == 1.
     virtual Architecture GetArchitecture() const = 0;
@@ -94,6 +101,10 @@ public:
     // It is safe to call this if the CPU is not running.
     virtual void SignalInterrupt(Kernel::KThread* thread) = 0;
 
+    // Signal for execution to halt with ProfileSample, so that the guest profiler can sample the
+    // context. Backends that can not halt ignore the request.
+    virtual void SignalProfileSample(Kernel::KThread* thread) {}
+
     // Stack trace generation.
     void LogBacktrace(Kernel::KProcess* process) const;
 
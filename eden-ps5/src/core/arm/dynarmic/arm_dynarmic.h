@@ -12,6 +12,7 @@ constexpr Dynarmic::HaltReason DataAbort = Dynarmic::HaltReason::MemoryAbort;
 constexpr Dynarmic::HaltReason BreakLoop = Dynarmic::HaltReason::UserDefined2;
 constexpr Dynarmic::HaltReason SupervisorCall = Dynarmic::HaltReason::UserDefined3;
 constexpr Dynarmic::HaltReason InstructionBreakpoint = Dynarmic::HaltReason::UserDefined4;
+constexpr Dynarmic::HaltReason ProfileSample = Dynarmic::HaltReason::UserDefined5;
 constexpr Dynarmic::HaltReason PrefetchAbort = Dynarmic::HaltReason::UserDefined6;
 
 constexpr HaltReason TranslateHaltReason(Dynarmic::HaltReason hr) {
@@ -21,6 +22,7 @@ constexpr HaltReason TranslateHaltReason(Dynarmic::HaltReason hr) {
     static_assert(static_cast<u64>(HaltReason::SupervisorCall) == static_cast<u64>(SupervisorCall));
     static_assert(static_cast<u64>(HaltReason::InstructionBreakpoint) ==
                   static_cast<u64>(InstructionBreakpoint));
+    static_assert(static_cast<u64>(HaltReason::ProfileSample) == static_cast<u64>(ProfileSample));
     static_assert(static_cast<u64>(HaltReason::PrefetchAbort) == static_cast<u64>(PrefetchAbort));
 
     return static_cast<HaltReason>(hr);
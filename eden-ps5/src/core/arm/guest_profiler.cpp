@@ -0,0 +1,317 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <algorithm>
+#include <array>
+
+#include <fmt/format.h>
+
+#include "common/demangle.h"
+#include "common/fs/file.h"
+#include "common/logging/log.h"
+#include "common/thread.h"
+#include "core/arm/debug.h"
+#include "core/arm/guest_profiler.h"
+#include "core/arm/symbols.h"
+#include "core/hardware_properties.h"
+#include "core/hle/kernel/k_process.h"
+#include "core/hle/kernel/kernel.h"
+#include "core/hle/kernel/physical_core.h"
+#include "core/memory.h"
+
+namespace Core {
+namespace {
+/// Deepest call stack walked for a sample
+constexpr size_t MaxFrames = 64;
+
+/// Shortest time between two module scans of a process, as unknown addresses trigger one
+constexpr auto ModuleScanPeriod = std::chrono::seconds{1};
+
+/// Marks frame name keys that are module offsets of unsymbolized code, not symbol indices
+constexpr size_t UnknownSymbolFlag = size_t{1} << 63;
+
+size_t WalkStack(Kernel::KProcess* process, const Kernel::Svc::ThreadContext& ctx,
+                 std::array<VAddr, MaxFrames>& frames) {
+    auto& memory = process->GetMemory();
+    const bool is_64 = process->Is64Bit();
+    const u64 pointer_size = is_64 ? 8 : 4;
+
+    size_t num_frames = 0;
+    frames[num_frames++] = ctx.pc;
+
+    // Return addresses point past the call, step back into it to find the calling function
+    const auto push_return = [&](u64 lr) {
+        if (lr >= 4) {
+            frames[num_frames++] = lr - 4;
+        }
+    };
+
+    // Walk the frame records, see GetAArch64Backtrace
+    u64 lr = ctx.lr;
+    u64 fp = ctx.fp;
+    while (num_frames < MaxFrames && lr != 0) {
+        push_return(lr);
+        if (!fp || (fp % 4 != 0) || !memory.IsValidVirtualAddressRange(fp, pointer_size * 2)) {
+            break;
+        }
+        lr = is_64 ? memory.Read64(fp + 8) : memory.Read32(fp + 4);
+        fp = is_64 ? memory.Read64(fp) : memory.Read32(fp);
+    }
+    return num_frames;
+}
+} // Anonymous namespace
+
+void GuestProfile::AddSample(std::span<const std::string_view> frames) {
+    std::vector<u32> stack;
+    stack.reserve(frames.size());
+    for (auto it = frames.rbegin(); it != frames.rend(); ++it) {
+        stack.push_back(Intern(*it));
+    }
+    ++stacks[std::move(stack)];
+    ++num_samples;
+}
+
+std::vector<GuestProfile::FunctionStats> GuestProfile::GetHotSpots() const {
+    std::vector<FunctionStats> stats(names.size());
+    for (size_t id = 0; id < names.size(); ++id) {
+        stats[id].name = names[id];
+    }
+
+    std::vector<u32> unique_ids;
+    for (const auto& [stack, count] : stacks) {
+        if (stack.empty()) {
+            continue;
+        }
+        stats[stack.back()].self_samples += count;
+
+        // Recursive functions count once per sample
+        unique_ids = stack;
+        std::ranges::sort(unique_ids);
+        const auto [first, last] = std::ranges::unique(unique_ids);
+        unique_ids.erase(first, last);
+        for (const u32 id : unique_ids) {
+            stats[id].total_samples += count;
+        }
+    }
+
+    std::erase_if(stats, [](const FunctionStats& function) { return function.total_samples == 0; });
+    std::ranges::sort(stats, [](const FunctionStats& lhs, const FunctionStats& rhs) {
+        if (lhs.self_samples != rhs.self_samples) {
+            return lhs.self_samples > rhs.self_samples;
+        }
+        return lhs.total_samples > rhs.total_samples;
+    });
+    return stats;
+}
+
+std::string GuestProfile::GetCollapsedStacks() const {
+    std::string output;
+    for (const auto& [stack, count] : stacks) {
+        for (size_t index = 0; index < stack.size(); ++index) {
+            if (index != 0) {
+                output += ';';
+            }
+            output += names[stack[index]];
+        }
+        output += fmt::format(" {}\n", count);
+    }
+    return output;
+}
+
+void GuestProfile::Reset() {
+    names.clear();
+    name_ids.clear();
+    stacks.clear();
+    num_samples = 0;
+}
+
+u32 GuestProfile::Intern(std::string_view name) {
+    std::string key{name};
+    // Semicolons separate the frames of collapsed stacks
+    std::ranges::replace(key, ';', ':');
+    const auto [it, inserted] = name_ids.try_emplace(key, static_cast<u32>(names.size()));
+    if (inserted) {
+        names.push_back(std::move(key));
+    }
+    return it->second;
+}
+
+GuestProfiler::GuestProfiler(Kernel::KernelCore& kernel_, bool attribute_jit_blocks_)
+    : kernel{kernel_}, attribute_jit_blocks{attribute_jit_blocks_} {}
+
+GuestProfiler::~GuestProfiler() {
+    Stop();
+}
+
+void GuestProfiler::Start(std::chrono::microseconds interval) {
+    Stop();
+    sampler = std::jthread(
+        [this, interval](std::stop_token stop_token) { SamplerLoop(stop_token, interval); });
+}
+
+void GuestProfiler::Stop() {
+    if (sampler.joinable()) {
+        sampler.request_stop();
+        sampler.join();
+    }
+}
+
+void GuestProfiler::SamplerLoop(std::stop_token stop_token, std::chrono::microseconds interval) {
+    Common::SetCurrentThreadName("GuestProfiler");
+
+    auto next_sample = std::chrono::steady_clock::now();
+    while (!stop_token.stop_requested()) {
+        next_sample += interval;
+        const auto now = std::chrono::steady_clock::now();
+        if (next_sample < now) {
+            // Skip the samples that were missed instead of bursting them
+            next_sample = now + interval;
+        }
+        std::this_thread::sleep_until(next_sample);
+
+        for (size_t core = 0; core < Hardware::NUM_CPU_CORES; ++core) {
+            kernel.PhysicalCore(core).RequestProfileSample();
+        }
+    }
+}
+
+void GuestProfiler::RecordSample(Kernel::KProcess* process, const Kernel::Svc::ThreadContext& ctx,
+                                 bool in_jit_block) {
+    std::array<VAddr, MaxFrames> addresses;
+    const size_t num_frames = WalkStack(process, ctx, addresses);
+
+    std::scoped_lock lk{mutex};
+    auto& modules = process_modules[process->GetProcessId()];
+
+    // Modules may have been loaded since the last scan. Scanning before naming any frame keeps
+    // the names valid until the sample is added.
+    const bool unknown_frame =
+        std::ranges::any_of(std::span(addresses.data(), num_frames),
+                            [&](VAddr address) { return !FindModule(modules, address); });
+    if (unknown_frame &&
+        std::chrono::steady_clock::now() - modules.last_scan >= ModuleScanPeriod) {
+        ScanModules(process, modules);
+    }
+
+    std::array<std::string_view, MaxFrames + 1> frames;
+    size_t frame_index = 0;
+
+    // The halt happens on entry of the next block, so the sampled PC starts a JIT block
+    std::string block_name;
+    if (attribute_jit_blocks && in_jit_block) {
+        block_name = process->Is64Bit() ? fmt::format("[jit] a64_{:016X}", ctx.pc)
+                                        : fmt::format("[jit] a32_{:08X}", ctx.pc);
+        frames[frame_index++] = block_name;
+    }
+    for (size_t index = 0; index < num_frames; ++index) {
+        frames[frame_index++] = GetFrameName(modules, addresses[index]);
+    }
+    profile.AddSample(std::span(frames.data(), frame_index));
+}
+
+void GuestProfiler::ScanModules(Kernel::KProcess* process, ProcessModules& process_modules_) {
+    process_modules_.last_scan = std::chrono::steady_clock::now();
+
+    const bool is_64 = process->Is64Bit();
+    std::vector<ModuleInfo> modules;
+    for (const auto& [base, name] : FindModules(process)) {
+        // Keep the modules that are already known, along with their cached frame names
+        const auto known =
+            std::ranges::find(process_modules_.modules, base, &ModuleInfo::base);
+        if (known != process_modules_.modules.end() && known->name == name) {
+            modules.push_back(std::move(*known));
+            continue;
+        }
+
+        ModuleInfo module{
+            .name = name,
+            .base = base,
+            .end = GetInteger(GetModuleEnd(process, base)),
+            .symbols = {},
+            .frame_names = {},
+        };
+        for (const auto& [symbol_name, symbol] : Symbols::GetSymbols(base, process->GetMemory(),
+                                                                     is_64)) {
+            module.symbols.push_back({
+                .start = symbol.first,
+                .size = symbol.second,
+                .name = symbol_name,
+            });
+        }
+        std::ranges::sort(module.symbols, {}, &ModuleInfo::Symbol::start);
+        modules.push_back(std::move(module));
+    }
+    process_modules_.modules = std::move(modules);
+}
+
+GuestProfiler::ModuleInfo* GuestProfiler::FindModule(ProcessModules& process_modules_,
+                                                     VAddr address) {
+    auto& modules = process_modules_.modules;
+    auto it = std::ranges::upper_bound(modules, address, {}, &ModuleInfo::base);
+    if (it == modules.begin()) {
+        return nullptr;
+    }
+    --it;
+    return address <= it->end ? &*it : nullptr;
+}
+
+std::string_view GuestProfiler::GetFrameName(ProcessModules& process_modules_, VAddr address) {
+    ModuleInfo* const module = FindModule(process_modules_, address);
+    if (!module) {
+        return "unknown";
+    }
+
+    const VAddr offset = address - module->base;
+    auto symbol = std::ranges::upper_bound(module->symbols, offset, {},
+                                           &ModuleInfo::Symbol::start);
+    size_t key = offset | UnknownSymbolFlag;
+    if (symbol != module->symbols.begin()) {
+        --symbol;
+        if (offset < symbol->start + symbol->size) {
+            key = static_cast<size_t>(symbol - module->symbols.begin());
+        }
+    }
+
+    const auto [it, inserted] = module->frame_names.try_emplace(key);
+    if (inserted) {
+        if ((key & UnknownSymbolFlag) != 0) {
+            it->second = fmt::format("{}`0x{:x}", module->name, offset);
+        } else {
+            const auto& name = module->symbols[key].name;
+            it->second = fmt::format("{}`{}", module->name, Common::DemangleSymbol(name));
+        }
+    }
+    return it->second;
+}
+
+void GuestProfiler::LogReport(size_t max_functions) const {
+    std::scoped_lock lk{mutex};
+    const u64 num_samples = profile.GetSampleCount();
+    if (num_samples == 0) {
+        LOG_INFO(Core_ARM, "No guest code samples were recorded");
+        return;
+    }
+
+    const auto hot_spots = profile.GetHotSpots();
+    const auto percent = [&](u64 samples) {
+        return 100.0 * static_cast<double>(samples) / static_cast<double>(num_samples);
+    };
+    LOG_INFO(Core_ARM, "Guest code hot spots over {} samples (self, total):", num_samples);
+    for (size_t i = 0; i < std::min(max_functions, hot_spots.size()); ++i) {
+        const auto& function = hot_spots[i];
+        LOG_INFO(Core_ARM, "  {:6.2f}% {:6.2f}%  {}", percent(function.self_samples),
+                 percent(function.total_samples), function.name);
+    }
+}
+
+bool GuestProfiler::WriteCollapsedStacks(const std::filesystem::path& path) const {
+    std::string stacks;
+    {
+        std::scoped_lock lk{mutex};
+        stacks = profile.GetCollapsedStacks();
+    }
+    return Common::FS::WriteStringToFile(path, Common::FS::FileType::TextFile, stacks) ==
+           stacks.size();
+}
+
+} // namespace Core
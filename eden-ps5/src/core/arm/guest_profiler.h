@@ -0,0 +1,132 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <chrono>
+#include <filesystem>
+#include <map>
+#include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "common/common_funcs.h"
+#include "common/common_types.h"
+
+namespace Kernel {
+class KernelCore;
+class KProcess;
+namespace Svc {
+struct ThreadContext;
+}
+} // namespace Kernel
+
+namespace Core {
+
+/// Sample counts of a guest program aggregated by call stack. Not thread-safe.
+class GuestProfile {
+public:
+    struct FunctionStats {
+        std::string name;
+        u64 self_samples;  ///< Samples with the function as the leaf frame
+        u64 total_samples; ///< Samples with the function anywhere on the stack
+    };
+
+    /// Adds a sample whose frames are ordered from the leaf to the root.
+    void AddSample(std::span<const std::string_view> frames);
+
+    [[nodiscard]] u64 GetSampleCount() const {
+        return num_samples;
+    }
+
+    /// Returns the sampled functions, sorted by self samples.
+    [[nodiscard]] std::vector<FunctionStats> GetHotSpots() const;
+
+    /// Returns the stacks in the collapsed format read by flamegraph.pl and speedscope, with the
+    /// frames of each stack ordered from the root to the leaf.
+    [[nodiscard]] std::string GetCollapsedStacks() const;
+
+    void Reset();
+
+private:
+    u32 Intern(std::string_view name);
+
+    std::vector<std::string> names;
+    std::unordered_map<std::string, u32> name_ids;
+    std::map<std::vector<u32>, u64> stacks;
+    u64 num_samples{};
+};
+
+/**
+ * Periodically halts every emulated core to capture the guest call stack of the thread it runs.
+ * Frames are symbolized by module and function while sampling, so the profile outlives the
+ * sampled processes. On JIT backends the halt happens on block entry, so the sampled PC is also
+ * the guest address of a JIT block.
+ */
+class GuestProfiler {
+public:
+    explicit GuestProfiler(Kernel::KernelCore& kernel, bool attribute_jit_blocks);
+    ~GuestProfiler();
+
+    YUZU_NON_COPYABLE(GuestProfiler);
+    YUZU_NON_MOVEABLE(GuestProfiler);
+
+    /// Starts requesting a sample from every core each interval.
+    void Start(std::chrono::microseconds interval);
+
+    void Stop();
+
+    /// Records the stack of a core that halted for a sample. Called from the core thread.
+    /// in_jit_block tells whether the PC is the entry of a JIT block rather than a native PC.
+    void RecordSample(Kernel::KProcess* process, const Kernel::Svc::ThreadContext& ctx,
+                      bool in_jit_block);
+
+    /// Logs the functions with the most samples.
+    void LogReport(size_t max_functions = 16) const;
+
+    /// Writes the collapsed stacks of the profile to a file.
+    bool WriteCollapsedStacks(const std::filesystem::path& path) const;
+
+private:
+    struct ModuleInfo {
+        struct Symbol {
+            VAddr start; ///< Offset from the module base
+            u64 size;
+            std::string name;
+        };
+
+        std::string name;
+        VAddr base;
+        VAddr end;
+        std::vector<Symbol> symbols; ///< Sorted by start
+        std::unordered_map<size_t, std::string> frame_names;
+    };
+
+    struct ProcessModules {
+        std::vector<ModuleInfo> modules; ///< Sorted by base
+        std::chrono::steady_clock::time_point last_scan;
+    };
+
+    void SamplerLoop(std::stop_token stop_token, std::chrono::microseconds interval);
+
+    void ScanModules(Kernel::KProcess* process, ProcessModules& process_modules);
+
+    static ModuleInfo* FindModule(ProcessModules& process_modules, VAddr address);
+
+    std::string_view GetFrameName(ProcessModules& process_modules, VAddr address);
+
+    Kernel::KernelCore& kernel;
+    bool attribute_jit_blocks;
+
+    mutable std::mutex mutex;
+    GuestProfile profile;
+    std::unordered_map<u64, ProcessModules> process_modules;
+
+    std::jthread sampler;
+};
+
+} // namespace Core
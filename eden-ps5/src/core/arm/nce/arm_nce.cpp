@@ -369,7 +369,15 @@ void ArmNce::SetContext(const Kernel::Svc::ThreadContext& ctx) {
 
 void ArmNce::SignalInterrupt(Kernel::KThread* thread) {
     // Add break loop condition.
-    m_guest_ctx.esr_el1.fetch_or(static_cast<u64>(HaltReason::BreakLoop));
+    SignalHalt(thread, HaltReason::BreakLoop);
+}
+
+void ArmNce::SignalProfileSample(Kernel::KThread* thread) {
+    SignalHalt(thread, HaltReason::ProfileSample);
+}
+
+void ArmNce::SignalHalt(Kernel::KThread* thread, HaltReason hr) {
+    m_guest_ctx.esr_el1.fetch_or(static_cast<u64>(hr));
 
     // Lock the thread context.
     auto* params = &thread->GetNativeExecutionParameters();
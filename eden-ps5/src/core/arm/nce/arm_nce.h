@@ -23,6 +23,10 @@ public:
 
     void Initialize() override;
 
+    bool UsesJitBlocks() const override {
+        return false;
+    }
+
     Architecture GetArchitecture() const override {
         return Architecture::AArch64;
     }
@@ -39,6 +43,7 @@ public:
     u32 GetSvcNumber() const override;
 
     void SignalInterrupt(Kernel::KThread* thread) override;
+    void SignalProfileSample(Kernel::KThread* thread) override;
     void ClearInstructionCache() override;
     void InvalidateCacheRange(u64 addr, std::size_t size) override;
 
@@ -67,6 +72,9 @@ private:
     static void LockThreadParameters(void* tpidr);
     static void UnlockThreadParameters(void* tpidr);
 
+    // Adds a halt reason and breaks the running thread out of guest code.
+    void SignalHalt(Kernel::KThread* thread, HaltReason hr);
+
 private:
     // C++ implementation functions for assembly definitions.
     static void* RestoreGuestContext(void* raw_context);
@@ -5,6 +5,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <algorithm>
+#include <bit>
 #include <mutex>
 #include <string>
 #include <tuple>
@@ -17,6 +18,7 @@
 #include "common/x64/cpu_wait.h"
 #endif
 
+#include "common/assert.h"
 #include "common/settings.h"
 #include "core/core_timing.h"
 #include "core/hardware_properties.h"
@@ -30,29 +32,58 @@ std::shared_ptr<EventType> CreateEvent(std::string name, TimedCallback&& callbac
 }
 
 struct CoreTiming::Event {
-    s64 time;
-    u64 fifo_order;
+    s64 time{};
+    u64 fifo_order{};
+    s64 reschedule_time{};
     std::weak_ptr<EventType> type;
-    s64 reschedule_time;
-    heap_t::handle_type handle{};
+    /// Identity of the event type, compared when unscheduling without locking the weak pointer.
+    const EventType* type_key{};
 
-    // Sort by time, unless the times are the same, in which case sort by
-    // the order added to the queue
-    friend bool operator>(const Event& left, const Event& right) {
-        return std::tie(left.time, left.fifo_order) > std::tie(right.time, right.fifo_order);
-    }
+    /// Links within a wheel slot. next also links the incoming event stack.
+    Event* prev{};
+    Event* next{};
+    u8 level{};
+    u8 slot{};
 
-    friend bool operator<(const Event& left, const Event& right) {
-        return std::tie(left.time, left.fifo_order) < std::tie(right.time, right.fifo_order);
-    }
+    u32 pool_index{};
+    std::atomic<u32> next_free{};
 };
 
+namespace {
+
+// Sort by time, unless the times are the same, in which case sort by
+// the order added to the queue. Greater-than, as the ready heap is a min-heap.
+template <typename T>
+bool EventLater(const T* left, const T* right) {
+    return std::tie(left->time, left->fifo_order) > std::tie(right->time, right->fifo_order);
+}
+
+} // Anonymous namespace
+
 CoreTiming::CoreTiming() : clock{Common::CreateOptimalClock()} {}
 
 CoreTiming::~CoreTiming() {
     Reset();
 }
 
+template <typename Func>
+void CoreTiming::ForEachQueuedEvent(Func&& func) {
+    for (size_t level = 0; level < WheelLevels; ++level) {
+        u64 occupied = wheel_occupied[level];
+        while (occupied != 0) {
+            const size_t slot = std::countr_zero(occupied);
+            occupied &= occupied - 1;
+
+            // The callback may unlink the event, so fetch the next one first.
+            for (Event* evt = wheel[level][slot]; evt != nullptr;) {
+                Event* const next = evt->next;
+                func(evt);
+                evt = next;
+            }
+        }
+    }
+}
+
 void CoreTiming::ThreadEntry(CoreTiming& instance) {
     static constexpr char name[] = "HostTiming";
     Common::SetCurrentThreadName(name);
@@ -65,6 +96,11 @@ void CoreTiming::Initialize(std::function<void()>&& on_thread_init_) {
     Reset();
     on_thread_init = std::move(on_thread_init_);
     event_fifo_id = 0;
+    {
+        // Time restarts from zero in single core mode, keep the queued events relative to it.
+        std::scoped_lock lock{basic_lock};
+        RebaseWheel(0);
+    }
     shutting_down = false;
     cpu_ticks = 0;
     if (is_multicore) {
@@ -74,7 +110,15 @@ void CoreTiming::Initialize(std::function<void()>&& on_thread_init_) {
 
 void CoreTiming::ClearPendingEvents() {
     std::scoped_lock lock{advance_lock, basic_lock};
-    event_queue.clear();
+    DrainIncomingEvents();
+    ForEachQueuedEvent([this](Event* evt) {
+        UnlinkWheelEvent(evt);
+        FreeEvent(evt);
+    });
+    for (Event* evt : ready_events) {
+        FreeEvent(evt);
+    }
+    ready_events.clear();
     event.Set();
 }
 
@@ -113,18 +157,20 @@ bool CoreTiming::IsRunning() const {
 
 bool CoreTiming::HasPendingEvents() const {
     std::scoped_lock lock{basic_lock};
-    return !(wait_set && event_queue.empty());
+    return !(wait_set && IsQueueEmpty());
 }
 
 void CoreTiming::ScheduleEvent(std::chrono::nanoseconds ns_into_future,
                                const std::shared_ptr<EventType>& event_type, bool absolute_time) {
-    {
-        std::scoped_lock scope{basic_lock};
-        const auto next_time{absolute_time ? ns_into_future : GetGlobalTimeNs() + ns_into_future};
+    const auto next_time{absolute_time ? ns_into_future : GetGlobalTimeNs() + ns_into_future};
 
-        auto h{event_queue.emplace(Event{next_time.count(), event_fifo_id++, event_type, 0})};
-        (*h).handle = h;
-    }
+    Event* const evt = AllocateEvent();
+    evt->time = next_time.count();
+    evt->fifo_order = event_fifo_id.fetch_add(1, std::memory_order_relaxed);
+    evt->reschedule_time = 0;
+    evt->type = event_type;
+    evt->type_key = event_type.get();
+    PushIncomingEvent(evt);
 
     event.Set();
 }
@@ -133,14 +179,15 @@ void CoreTiming::ScheduleLoopingEvent(std::chrono::nanoseconds start_time,
                                       std::chrono::nanoseconds resched_time,
                                       const std::shared_ptr<EventType>& event_type,
                                       bool absolute_time) {
-    {
-        std::scoped_lock scope{basic_lock};
-        const auto next_time{absolute_time ? start_time : GetGlobalTimeNs() + start_time};
+    const auto next_time{absolute_time ? start_time : GetGlobalTimeNs() + start_time};
 
-        auto h{event_queue.emplace(
-            Event{next_time.count(), event_fifo_id++, event_type, resched_time.count()})};
-        (*h).handle = h;
-    }
+    Event* const evt = AllocateEvent();
+    evt->time = next_time.count();
+    evt->fifo_order = event_fifo_id.fetch_add(1, std::memory_order_relaxed);
+    evt->reschedule_time = resched_time.count();
+    evt->type = event_type;
+    evt->type_key = event_type.get();
+    PushIncomingEvent(evt);
 
     event.Set();
 }
@@ -150,16 +197,26 @@ void CoreTiming::UnscheduleEvent(const std::shared_ptr<EventType>& event_type,
     {
         std::scoped_lock lk{basic_lock};
 
-        std::vector<heap_t::handle_type> to_remove;
-        for (auto itr = event_queue.begin(); itr != event_queue.end(); itr++) {
-            const Event& e = *itr;
-            if (e.type.lock().get() == event_type.get()) {
-                to_remove.push_back(itr->handle);
+        // Pull in events scheduled concurrently, so they can be found below.
+        DrainIncomingEvents();
+
+        const EventType* const key = event_type.get();
+        ForEachQueuedEvent([this, key](Event* evt) {
+            if (evt->type_key == key) {
+                UnlinkWheelEvent(evt);
+                FreeEvent(evt);
             }
-        }
+        });
 
-        for (auto& h : to_remove) {
-            event_queue.erase(h);
+        const auto removed = std::erase_if(ready_events, [this, key](Event* evt) {
+            if (evt->type_key != key) {
+                return false;
+            }
+            FreeEvent(evt);
+            return true;
+        });
+        if (removed != 0) {
+            std::make_heap(ready_events.begin(), ready_events.end(), EventLater<Event>);
         }
 
         event_type->sequence_number++;
@@ -223,61 +280,259 @@ u64 CoreTiming::GetGPUTicks() const {
 
 std::optional<s64> CoreTiming::Advance() {
     std::scoped_lock lock{advance_lock, basic_lock};
+    DrainIncomingEvents();
     global_timer = GetGlobalTimeNs().count();
+    CollectExpiredEvents(global_timer);
 
-    while (!event_queue.empty() && event_queue.top().time <= global_timer) {
-        const Event& evt = event_queue.top();
+    while (!ready_events.empty()) {
+        std::pop_heap(ready_events.begin(), ready_events.end(), EventLater<Event>);
+        Event* const evt = ready_events.back();
+        ready_events.pop_back();
 
-        if (const auto event_type{evt.type.lock()}) {
-            const auto evt_time = evt.time;
+        // The event is now owned by this loop, UnscheduleEvent can no longer reach it.
+        bool reschedule = false;
+        if (const auto event_type{evt->type.lock()}) {
+            const auto evt_time = evt->time;
             const auto evt_sequence_num = event_type->sequence_number;
 
-            if (evt.reschedule_time == 0) {
-                event_queue.pop();
+            basic_lock.unlock();
 
-                basic_lock.unlock();
+            const auto new_schedule_time{event_type->callback(
+                evt_time, std::chrono::nanoseconds{GetGlobalTimeNs().count() - evt_time})};
 
-                event_type->callback(
-                    evt_time, std::chrono::nanoseconds{GetGlobalTimeNs().count() - evt_time});
-
-                basic_lock.lock();
-            } else {
-                basic_lock.unlock();
-
-                const auto new_schedule_time{event_type->callback(
-                    evt_time, std::chrono::nanoseconds{GetGlobalTimeNs().count() - evt_time})};
-
-                basic_lock.lock();
-
-                if (evt_sequence_num != event_type->sequence_number) {
-                    // Heap handle is invalidated after external modification.
-                    continue;
-                }
+            basic_lock.lock();
 
+            // Looping events are dropped if they were unscheduled during the callback.
+            if (evt->reschedule_time != 0 && evt_sequence_num == event_type->sequence_number) {
                 const auto next_schedule_time{new_schedule_time.has_value()
                                                   ? new_schedule_time.value().count()
-                                                  : evt.reschedule_time};
+                                                  : evt->reschedule_time};
 
                 // If this event was scheduled into a pause, its time now is going to be way
                 // behind. Re-set this event to continue from the end of the pause.
-                auto next_time{evt.time + next_schedule_time};
-                if (evt.time < pause_end_time) {
+                auto next_time{evt->time + next_schedule_time};
+                if (evt->time < pause_end_time) {
                     next_time = pause_end_time + next_schedule_time;
                 }
 
-                event_queue.update(evt.handle, Event{next_time, event_fifo_id++, evt.type,
-                                                     next_schedule_time, evt.handle});
+                evt->time = next_time;
+                evt->fifo_order = event_fifo_id.fetch_add(1, std::memory_order_relaxed);
+                evt->reschedule_time = next_schedule_time;
+                reschedule = true;
             }
         }
 
+        if (reschedule) {
+            InsertEvent(evt);
+        } else {
+            FreeEvent(evt);
+        }
+
+        DrainIncomingEvents();
         global_timer = GetGlobalTimeNs().count();
+        CollectExpiredEvents(global_timer);
     }
 
-    if (!event_queue.empty()) {
-        return event_queue.top().time;
+    return NextEventTime();
+}
+
+CoreTiming::Event& CoreTiming::GetPooledEvent(u32 index) {
+    return event_chunks[index / EventChunkSize][index % EventChunkSize];
+}
+
+CoreTiming::Event* CoreTiming::AllocateEvent() {
+    u64 head = free_events.load(std::memory_order_acquire);
+    while (true) {
+        const u32 first = static_cast<u32>(head);
+        if (first == 0) [[unlikely]] {
+            GrowEventPool();
+            head = free_events.load(std::memory_order_acquire);
+            continue;
+        }
+
+        // A stale next index is harmless, the tag makes the exchange fail if the head was
+        // popped and pushed back in the meantime.
+        Event& evt = GetPooledEvent(first - 1);
+        const u64 tag = (head >> 32) + 1;
+        const u64 new_head = (tag << 32) | evt.next_free.load(std::memory_order_relaxed);
+        if (free_events.compare_exchange_weak(head, new_head, std::memory_order_acquire,
+                                              std::memory_order_acquire)) {
+            return &evt;
+        }
+    }
+}
+
+void CoreTiming::FreeEvent(Event* evt) {
+    evt->type.reset();
+    evt->type_key = nullptr;
+
+    u64 head = free_events.load(std::memory_order_relaxed);
+    u64 new_head;
+    do {
+        evt->next_free.store(static_cast<u32>(head), std::memory_order_relaxed);
+        new_head = (((head >> 32) + 1) << 32) | (evt->pool_index + 1);
+    } while (!free_events.compare_exchange_weak(head, new_head, std::memory_order_release,
+                                                std::memory_order_relaxed));
+}
+
+void CoreTiming::GrowEventPool() {
+    std::scoped_lock lk{event_pool_lock};
+    if (static_cast<u32>(free_events.load(std::memory_order_acquire)) != 0) {
+        // Another thread grew the pool while we were waiting.
+        return;
+    }
+
+    ASSERT_MSG(num_event_chunks < MaxEventChunks, "Too many pending core timing events");
+    const u32 chunk = num_event_chunks++;
+    event_chunks[chunk] = std::make_unique<Event[]>(EventChunkSize);
+    for (u32 i = 0; i < EventChunkSize; ++i) {
+        Event& evt = event_chunks[chunk][i];
+        evt.pool_index = chunk * EventChunkSize + i;
+        FreeEvent(&evt);
+    }
+}
+
+void CoreTiming::PushIncomingEvent(Event* evt) {
+    Event* head = incoming_events.load(std::memory_order_relaxed);
+    do {
+        evt->next = head;
+    } while (!incoming_events.compare_exchange_weak(head, evt, std::memory_order_release,
+                                                    std::memory_order_relaxed));
+}
+
+void CoreTiming::DrainIncomingEvents() {
+    // Events carry their fifo order, so the reversed order of the stack does not matter.
+    Event* evt = incoming_events.exchange(nullptr, std::memory_order_acquire);
+    while (evt != nullptr) {
+        Event* const next = evt->next;
+        InsertEvent(evt);
+        evt = next;
+    }
+}
+
+void CoreTiming::InsertEvent(Event* evt) {
+    if (evt->time <= wheel_time) {
+        ready_events.push_back(evt);
+        std::push_heap(ready_events.begin(), ready_events.end(), EventLater<Event>);
+        return;
+    }
+
+    const u64 diff = static_cast<u64>(evt->time ^ wheel_time);
+    const size_t msb = std::bit_width(diff) - 1;
+    const size_t level = msb < WheelGranularityBits ? 0 : (msb - WheelGranularityBits) / WheelSlotBits;
+    const size_t slot =
+        (static_cast<u64>(evt->time) >> (WheelGranularityBits + level * WheelSlotBits)) &
+        (WheelSlots - 1);
+
+    Event*& head = wheel[level][slot];
+    evt->prev = nullptr;
+    evt->next = head;
+    if (head != nullptr) {
+        head->prev = evt;
+    }
+    head = evt;
+    evt->level = static_cast<u8>(level);
+    evt->slot = static_cast<u8>(slot);
+    wheel_occupied[level] |= u64{1} << slot;
+}
+
+void CoreTiming::UnlinkWheelEvent(Event* evt) {
+    if (evt->prev != nullptr) {
+        evt->prev->next = evt->next;
     } else {
-        return std::nullopt;
+        wheel[evt->level][evt->slot] = evt->next;
+        if (evt->next == nullptr) {
+            wheel_occupied[evt->level] &= ~(u64{1} << evt->slot);
+        }
+    }
+    if (evt->next != nullptr) {
+        evt->next->prev = evt->prev;
+    }
+}
+
+void CoreTiming::CollectExpiredEvents(s64 now) {
+    if (now < wheel_time) [[unlikely]] {
+        RebaseWheel(now);
+        return;
     }
+
+    // Detach every slot whose time range has started. This has to finish before anything is
+    // re-inserted, as slots are only ordered while they hold events placed from one wheel_time.
+    Event* started = nullptr;
+    for (size_t level = 0; level < WheelLevels; ++level) {
+        const s64 slot_mask = ~((s64{1} << (WheelGranularityBits + level * WheelSlotBits)) - 1);
+        u64 occupied = wheel_occupied[level];
+        while (occupied != 0) {
+            const size_t slot = std::countr_zero(occupied);
+            occupied &= occupied - 1;
+
+            Event* const head = wheel[level][slot];
+            if ((head->time & slot_mask) > now) {
+                // None of the following slots have started either.
+                break;
+            }
+
+            Event* tail = head;
+            while (tail->next != nullptr) {
+                tail = tail->next;
+            }
+            tail->next = started;
+            started = head;
+
+            wheel[level][slot] = nullptr;
+            wheel_occupied[level] &= ~(u64{1} << slot);
+        }
+    }
+
+    // Due events go to the ready queue, the rest land on a lower level or a slot that has not
+    // started yet.
+    wheel_time = now;
+    while (started != nullptr) {
+        Event* const next = started->next;
+        InsertEvent(started);
+        started = next;
+    }
+}
+
+void CoreTiming::RebaseWheel(s64 now) {
+    Event* events = nullptr;
+    ForEachQueuedEvent([&events, this](Event* evt) {
+        UnlinkWheelEvent(evt);
+        evt->next = events;
+        events = evt;
+    });
+
+    wheel_time = now;
+    while (events != nullptr) {
+        Event* const next = events->next;
+        InsertEvent(events);
+        events = next;
+    }
+}
+
+std::optional<s64> CoreTiming::NextEventTime() const {
+    if (!ready_events.empty()) {
+        return ready_events.front()->time;
+    }
+
+    // The lowest occupied slot of the lowest occupied level holds the earliest event.
+    for (size_t level = 0; level < WheelLevels; ++level) {
+        if (wheel_occupied[level] == 0) {
+            continue;
+        }
+        const size_t slot = std::countr_zero(wheel_occupied[level]);
+        s64 earliest = wheel[level][slot]->time;
+        for (const Event* evt = wheel[level][slot]->next; evt != nullptr; evt = evt->next) {
+            earliest = std::min(earliest, evt->time);
+        }
+        return earliest;
+    }
+    return std::nullopt;
+}
+
+bool CoreTiming::IsQueueEmpty() const {
+    return ready_events.empty() && incoming_events.load(std::memory_order_acquire) == nullptr &&
+           std::ranges::all_of(wheel_occupied, [](u64 occupied) { return occupied == 0; });
 }
 
 void CoreTiming::ThreadLoop() {
@@ -1,8 +1,12 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2020 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #pragma once
 
+#include <array>
 #include <atomic>
 #include <chrono>
 #include <functional>
@@ -11,8 +15,7 @@
 #include <optional>
 #include <string>
 #include <thread>
-
-#include <boost/heap/fibonacci_heap.hpp>
+#include <vector>
 
 #include "common/common_types.h"
 #include "common/thread.h"
@@ -141,11 +144,40 @@ public:
 private:
     struct Event;
 
+    /// Number of low time bits covered by a single slot of the first wheel level (~1us).
+    static constexpr size_t WheelGranularityBits = 10;
+    /// Each wheel level has 64 slots, so that its occupancy fits in a single u64.
+    static constexpr size_t WheelSlotBits = 6;
+    static constexpr size_t WheelSlots = size_t{1} << WheelSlotBits;
+    /// Enough levels to cover the whole non-negative s64 nanosecond range.
+    static constexpr size_t WheelLevels = (63 - WheelGranularityBits) / WheelSlotBits + 1;
+
+    static constexpr u32 EventChunkSize = 256;
+    static constexpr u32 MaxEventChunks = 256;
+
     static void ThreadEntry(CoreTiming& instance);
     void ThreadLoop();
 
     void Reset();
 
+    Event* AllocateEvent();
+    void FreeEvent(Event* evt);
+    void GrowEventPool();
+    Event& GetPooledEvent(u32 index);
+
+    void PushIncomingEvent(Event* evt);
+    void DrainIncomingEvents();
+
+    void InsertEvent(Event* evt);
+    void UnlinkWheelEvent(Event* evt);
+    void CollectExpiredEvents(s64 now);
+    void RebaseWheel(s64 now);
+    std::optional<s64> NextEventTime() const;
+    bool IsQueueEmpty() const;
+
+    template <typename Func>
+    void ForEachQueuedEvent(Func&& func);
+
     std::unique_ptr<Common::WallClock> clock;
 
     s64 global_timer = 0;
@@ -154,11 +186,26 @@ private:
     s64 timer_resolution_ns;
 #endif
 
-    using heap_t =
-        boost::heap::fibonacci_heap<CoreTiming::Event, boost::heap::compare<std::greater<>>>;
-
-    heap_t event_queue;
-    u64 event_fifo_id = 0;
+    /// Hierarchical timer wheel. An event is placed on the level of the highest bit in which its
+    /// time differs from wheel_time, which keeps every level ordered without wrap-around: all
+    /// events on a level are due before the events of the levels above it.
+    std::array<std::array<Event*, WheelSlots>, WheelLevels> wheel{};
+    std::array<u64, WheelLevels> wheel_occupied{};
+    s64 wheel_time{};
+
+    /// Events that are due, as a min-heap on (time, fifo order).
+    std::vector<Event*> ready_events;
+
+    /// Events scheduled since the queue was last drained. Pushed lock-free by any thread.
+    std::atomic<Event*> incoming_events{};
+    std::atomic<u64> event_fifo_id{};
+
+    /// Pool of event nodes, so scheduling does not allocate. The free list head packs an ABA tag
+    /// in the upper 32 bits and the index of the first free node plus one in the lower ones.
+    std::array<std::unique_ptr<Event[]>, MaxEventChunks> event_chunks;
+    u32 num_event_chunks{};
+    std::mutex event_pool_lock;
+    std::atomic<u64> free_events{};
 
     Common::Event event{};
     Common::Event pause_event{};
@@ -1,6 +1,10 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2020 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include "common/settings.h"
 #include "core/device_memory.h"
 #include "hle/kernel/board/nintendo/nx/k_system_control.h"
 
@@ -14,7 +18,11 @@ constexpr size_t VirtualReserveSize = 1ULL << 39;
 
 DeviceMemory::DeviceMemory()
     : buffer{Kernel::Board::Nintendo::Nx::KSystemControl::Init::GetIntendedMemorySize(),
-             VirtualReserveSize} {}
+             VirtualReserveSize,
+             Common::HostMemoryOptions{
+                 .huge_pages = Settings::values.use_huge_pages.GetValue(),
+                 .numa_local = Settings::values.use_numa_local_memory.GetValue(),
+             }} {}
 
 DeviceMemory::~DeviceMemory() = default;
 
@@ -256,6 +256,13 @@ public:
         }
     }
 
+    // Wraps an object the caller has already opened, taking over that reference.
+    static KScopedAutoObject Adopt(T* o) {
+        KScopedAutoObject ret;
+        ret.m_obj = o;
+        return ret;
+    }
+
     constexpr KScopedAutoObject<T>& operator=(KScopedAutoObject<T>&& rhs) {
         rhs.Swap(*this);
         return *this;
@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2021 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -153,6 +156,17 @@ Result KConditionVariable::WaitForAddress(KernelCore& kernel, Handle handle, KPr
     KThread* cur_thread = GetCurrentThreadPointer(kernel);
     ThreadQueueImplForKConditionVariableWaitForAddress wait_queue(kernel);
 
+    // By the time a thread arbitrates a lock, the owner has often released it already. Check the
+    // tag before taking the scheduler lock: seeing it differ at any point is equivalent to seeing
+    // it differ under the lock, and saves contending with the other cores.
+    if (!cur_thread->IsTerminationRequested()) [[likely]] {
+        u32 test_tag{};
+        if (ReadFromUser(kernel, std::addressof(test_tag), addr) &&
+            test_tag != (handle | Svc::HandleWaitMask)) {
+            R_SUCCEED();
+        }
+    }
+
     // Wait for the address.
     KThread* owner_thread{};
     {
@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2021 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -11,14 +14,14 @@ Result KHandleTable::Finalize() {
     u16 saved_table_size = 0;
     {
         KScopedDisableDispatch dd{m_kernel};
-        KScopedSpinLock lk(m_lock);
+        KScopedUpdateLock lk(*this);
 
-        std::swap(m_table_size, saved_table_size);
+        saved_table_size = m_table_size.exchange(0, std::memory_order_relaxed);
     }
 
     // Close and free all entries.
     for (size_t i = 0; i < saved_table_size; i++) {
-        if (KAutoObject* obj = m_objects[i]; obj != nullptr) {
+        if (KAutoObject* obj = this->GetEntryObject(i); obj != nullptr) {
             obj->Close();
         }
     }
@@ -42,12 +45,12 @@ bool KHandleTable::Remove(Handle handle) {
     KAutoObject* obj = nullptr;
     {
         KScopedDisableDispatch dd{m_kernel};
-        KScopedSpinLock lk(m_lock);
+        KScopedUpdateLock lk(*this);
 
         if (this->IsValidHandle(handle)) [[likely]] {
             const auto index = handle_pack.index;
 
-            obj = m_objects[index];
+            obj = this->GetEntryObject(index);
             this->FreeEntry(index);
         } else {
             return false;
@@ -62,18 +65,18 @@ bool KHandleTable::Remove(Handle handle) {
 
 Result KHandleTable::Add(Handle* out_handle, KAutoObject* obj) {
     KScopedDisableDispatch dd{m_kernel};
-    KScopedSpinLock lk(m_lock);
+    KScopedUpdateLock lk(*this);
 
     // Never exceed our capacity.
-    R_UNLESS(m_count < m_table_size, ResultOutOfHandles);
+    R_UNLESS(m_count < this->GetTableSize(), ResultOutOfHandles);
 
     // Allocate entry, set output handle.
     {
         const auto linear_id = this->AllocateLinearId();
         const auto index = this->AllocateEntry();
 
-        m_entry_infos[index].linear_id = linear_id;
-        m_objects[index] = obj;
+        m_entry_infos[index].SetLinearId(linear_id);
+        this->SetEntryObject(index, obj);
 
         obj->Open();
 
@@ -101,10 +104,10 @@ KScopedAutoObject<KAutoObject> KHandleTable::GetObjectForIpc(Handle handle,
 
 Result KHandleTable::Reserve(Handle* out_handle) {
     KScopedDisableDispatch dd{m_kernel};
-    KScopedSpinLock lk(m_lock);
+    KScopedUpdateLock lk(*this);
 
     // Never exceed our capacity.
-    R_UNLESS(m_count < m_table_size, ResultOutOfHandles);
+    R_UNLESS(m_count < this->GetTableSize(), ResultOutOfHandles);
 
     *out_handle = EncodeHandle(static_cast<u16>(this->AllocateEntry()), this->AllocateLinearId());
     R_SUCCEED();
@@ -112,7 +115,7 @@ Result KHandleTable::Reserve(Handle* out_handle) {
 
 void KHandleTable::Unreserve(Handle handle) {
     KScopedDisableDispatch dd{m_kernel};
-    KScopedSpinLock lk(m_lock);
+    KScopedUpdateLock lk(*this);
 
     // Unpack the handle.
     const auto handle_pack = HandlePack(handle);
@@ -122,16 +125,16 @@ void KHandleTable::Unreserve(Handle handle) {
     ASSERT(reserved == 0);
     ASSERT(linear_id != 0);
 
-    if (index < m_table_size) [[likely]] {
+    if (index < this->GetTableSize()) [[likely]] {
         // NOTE: This code does not check the linear id.
-        ASSERT(m_objects[index] == nullptr);
+        ASSERT(this->GetEntryObject(index) == nullptr);
         this->FreeEntry(index);
     }
 }
 
 void KHandleTable::Register(Handle handle, KAutoObject* obj) {
     KScopedDisableDispatch dd{m_kernel};
-    KScopedSpinLock lk(m_lock);
+    KScopedUpdateLock lk(*this);
 
     // Unpack the handle.
     const auto handle_pack = HandlePack(handle);
@@ -141,12 +144,12 @@ void KHandleTable::Register(Handle handle, KAutoObject* obj) {
     ASSERT(reserved == 0);
     ASSERT(linear_id != 0);
 
-    if (index < m_table_size) [[likely]] {
+    if (index < this->GetTableSize()) [[likely]] {
         // Set the entry.
-        ASSERT(m_objects[index] == nullptr);
+        ASSERT(this->GetEntryObject(index) == nullptr);
 
-        m_entry_infos[index].linear_id = static_cast<u16>(linear_id);
-        m_objects[index] = obj;
+        m_entry_infos[index].SetLinearId(static_cast<u16>(linear_id));
+        this->SetEntryObject(index, obj);
 
         obj->Open();
     }
@@ -1,9 +1,14 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2021 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #pragma once
 
 #include <array>
+#include <atomic>
+#include <thread>
 
 #include "common/assert.h"
 #include "common/bit_field.h"
@@ -36,19 +41,20 @@ public:
 
         // Lock.
         KScopedDisableDispatch dd{m_kernel};
-        KScopedSpinLock lk(m_lock);
+        KScopedUpdateLock lk(*this);
 
         // Initialize all fields.
+        const auto table_size = static_cast<u16>((size <= 0) ? MaxTableSize : size);
         m_max_count = 0;
-        m_table_size = static_cast<s16>((size <= 0) ? MaxTableSize : size);
+        m_table_size.store(table_size, std::memory_order_relaxed);
         m_next_linear_id = MinLinearId;
         m_count = 0;
         m_free_head_index = -1;
 
         // Free all entries.
-        for (s32 i = 0; i < static_cast<s32>(m_table_size); ++i) {
-            m_objects[i] = nullptr;
-            m_entry_infos[i].next_free_index = static_cast<s16>(i - 1);
+        for (s32 i = 0; i < static_cast<s32>(table_size); ++i) {
+            this->SetEntryObject(i, nullptr);
+            m_entry_infos[i].SetNextFreeIndex(static_cast<s16>(i - 1));
             m_free_head_index = i;
         }
 
@@ -56,7 +62,7 @@ public:
     }
 
     size_t GetTableSize() const {
-        return m_table_size;
+        return m_table_size.load(std::memory_order_relaxed);
     }
     size_t GetCount() const {
         return m_count;
@@ -70,18 +76,19 @@ public:
 
     template <typename T = KAutoObject>
     KScopedAutoObject<T> GetObjectWithoutPseudoHandle(Handle handle) const {
-        // Lock and look up in table.
-        KScopedDisableDispatch dd{m_kernel};
-        KScopedSpinLock lk(m_lock);
-
+        // Look up and open the object in the table.
+        KAutoObject* obj = this->OpenObjectImpl(handle);
         if constexpr (std::is_same_v<T, KAutoObject>) {
-            return this->GetObjectImpl(handle);
+            return KScopedAutoObject<T>::Adopt(obj);
         } else {
-            if (auto* obj = this->GetObjectImpl(handle); obj != nullptr) [[likely]] {
-                return obj->DynamicCast<T*>();
-            } else {
+            if (obj == nullptr) [[unlikely]] {
                 return nullptr;
             }
+            T* const obj_t = obj->DynamicCast<T*>();
+            if (obj_t == nullptr) [[unlikely]] {
+                obj->Close();
+            }
+            return KScopedAutoObject<T>::Adopt(obj_t);
         }
     }
 
@@ -106,11 +113,8 @@ public:
     }
 
     KScopedAutoObject<KAutoObject> GetObjectForIpcWithoutPseudoHandle(Handle handle) const {
-        // Lock and look up in table.
-        KScopedDisableDispatch dd{m_kernel};
-        KScopedSpinLock lk(m_lock);
-
-        return this->GetObjectImpl(handle);
+        // Look up and open the object in the table.
+        return KScopedAutoObject<KAutoObject>::Adopt(this->OpenObjectImpl(handle));
     }
 
     KScopedAutoObject<KAutoObject> GetObjectForIpc(Handle handle, KThread* cur_thread) const;
@@ -132,30 +136,24 @@ public:
     bool GetMultipleObjects(T** out, const Handle* handles, size_t num_handles) const {
         // Try to convert and open all the handles.
         size_t num_opened;
-        {
-            // Lock the table.
-            KScopedDisableDispatch dd{m_kernel};
-            KScopedSpinLock lk(m_lock);
-            for (num_opened = 0; num_opened < num_handles; num_opened++) {
-                // Get the current handle.
-                const auto cur_handle = handles[num_opened];
-
-                // Get the object for the current handle.
-                KAutoObject* cur_object = this->GetObjectImpl(cur_handle);
-                if (cur_object == nullptr) [[unlikely]] {
-                    break;
-                }
-
-                // Cast the current object to the desired type.
-                T* cur_t = cur_object->DynamicCast<T*>();
-                if (cur_t == nullptr) [[unlikely]] {
-                    break;
-                }
-
-                // Open a reference to the current object.
-                cur_t->Open();
-                out[num_opened] = cur_t;
+        for (num_opened = 0; num_opened < num_handles; num_opened++) {
+            // Get the current handle.
+            const auto cur_handle = handles[num_opened];
+
+            // Open the object for the current handle.
+            KAutoObject* cur_object = this->OpenObjectImpl(cur_handle);
+            if (cur_object == nullptr) [[unlikely]] {
+                break;
             }
+
+            // Cast the current object to the desired type.
+            T* cur_t = cur_object->DynamicCast<T*>();
+            if (cur_t == nullptr) [[unlikely]] {
+                cur_object->Close();
+                break;
+            }
+
+            out[num_opened] = cur_t;
         }
 
         // If we converted every object, succeed.
@@ -172,8 +170,58 @@ public:
     }
 
 private:
+    // Held by every operation that modifies the table. The sequence counter is odd while the
+    // modification is in progress, which lets lock-free readers detect that they raced with it.
+    class KScopedUpdateLock {
+    public:
+        explicit KScopedUpdateLock(KHandleTable& table) : m_table(table), m_lk(table.m_lock) {
+            const u32 sequence = m_table.m_sequence.load(std::memory_order_relaxed);
+            m_table.m_sequence.store(sequence + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+        }
+
+        ~KScopedUpdateLock() {
+            const u32 sequence = m_table.m_sequence.load(std::memory_order_relaxed);
+            m_table.m_sequence.store(sequence + 1, std::memory_order_release);
+        }
+
+    private:
+        KHandleTable& m_table;
+        KScopedSpinLock m_lk;
+    };
+
+    // Looks up a handle and opens a reference to its object without taking the table lock.
+    // The entry is read under the sequence counter, and the counter is validated again only
+    // after the object has been opened, so a concurrent Remove can never hand out an object
+    // whose last reference is being dropped. Objects live in type-stable slab memory, and Open
+    // refuses to revive an object whose reference count already reached zero.
+    KAutoObject* OpenObjectImpl(Handle handle) const {
+        while (true) {
+            const u32 sequence = m_sequence.load(std::memory_order_acquire);
+            if ((sequence & 1) != 0) [[unlikely]] {
+                std::this_thread::yield();
+                continue;
+            }
+
+            KAutoObject* obj = this->GetObjectImpl(handle);
+            const bool opened = obj != nullptr && obj->Open();
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (m_sequence.load(std::memory_order_relaxed) == sequence) [[likely]] {
+                // A live entry always holds a reference, so opening it can't have failed.
+                ASSERT(obj == nullptr || opened);
+                return obj;
+            }
+
+            // The table changed underneath us, try again.
+            if (opened) {
+                obj->Close();
+            }
+        }
+    }
+
     s32 AllocateEntry() {
-        ASSERT(m_count < m_table_size);
+        ASSERT(m_count < this->GetTableSize());
 
         const auto index = m_free_head_index;
 
@@ -187,8 +235,8 @@ private:
     void FreeEntry(s32 index) {
         ASSERT(m_count > 0);
 
-        m_objects[index] = nullptr;
-        m_entry_infos[index].next_free_index = static_cast<s16>(m_free_head_index);
+        this->SetEntryObject(index, nullptr);
+        m_entry_infos[index].SetNextFreeIndex(static_cast<s16>(m_free_head_index));
 
         m_free_head_index = index;
 
@@ -219,12 +267,12 @@ private:
         if (linear_id == 0) [[unlikely]] {
             return false;
         }
-        if (index >= m_table_size) [[unlikely]] {
+        if (index >= this->GetTableSize()) [[unlikely]] {
             return false;
         }
 
         // Check that there's an object, and our serial id is correct.
-        if (m_objects[index] == nullptr) [[unlikely]] {
+        if (this->GetEntryObject(index) == nullptr) [[unlikely]] {
             return false;
         }
         if (m_entry_infos[index].GetLinearId() != linear_id) [[unlikely]] {
@@ -242,7 +290,7 @@ private:
         }
 
         if (this->IsValidHandle(handle)) [[likely]] {
-            return m_objects[handle_pack.index];
+            return this->GetEntryObject(handle_pack.index);
         } else {
             return nullptr;
         }
@@ -250,12 +298,12 @@ private:
 
     KAutoObject* GetObjectByIndexImpl(Handle* out_handle, size_t index) const {
         // Index must be in bounds.
-        if (index >= m_table_size) [[unlikely]] {
+        if (index >= this->GetTableSize()) [[unlikely]] {
             return nullptr;
         }
 
         // Ensure entry has an object.
-        if (KAutoObject* obj = m_objects[index]; obj != nullptr) {
+        if (KAutoObject* obj = this->GetEntryObject(index); obj != nullptr) {
             *out_handle = EncodeHandle(static_cast<u16>(index), m_entry_infos[index].GetLinearId());
             return obj;
         } else {
@@ -263,6 +311,14 @@ private:
         }
     }
 
+    KAutoObject* GetEntryObject(size_t index) const {
+        return m_objects[index].load(std::memory_order_relaxed);
+    }
+
+    void SetEntryObject(size_t index, KAutoObject* obj) {
+        m_objects[index].store(obj, std::memory_order_relaxed);
+    }
+
 private:
     union HandlePack {
         constexpr HandlePack() = default;
@@ -286,25 +342,34 @@ private:
     static constexpr u16 MinLinearId = 1;
     static constexpr u16 MaxLinearId = 0x7FFF;
 
-    union EntryInfo {
-        u16 linear_id;
-        s16 next_free_index;
+    // Holds the linear id of a used entry, or the index of the next free entry. Accessed
+    // atomically as lock-free readers may look at an entry while it is being modified.
+    struct EntryInfo {
+        std::atomic<u16> value;
+
+        u16 GetLinearId() const {
+            return value.load(std::memory_order_relaxed);
+        }
+        s32 GetNextFreeIndex() const {
+            return static_cast<s16>(value.load(std::memory_order_relaxed));
+        }
 
-        constexpr u16 GetLinearId() const {
-            return linear_id;
+        void SetLinearId(u16 linear_id) {
+            value.store(linear_id, std::memory_order_relaxed);
         }
-        constexpr s32 GetNextFreeIndex() const {
-            return next_free_index;
+        void SetNextFreeIndex(s16 next_free_index) {
+            value.store(static_cast<u16>(next_free_index), std::memory_order_relaxed);
         }
     };
 
 private:
     KernelCore& m_kernel;
     std::array<EntryInfo, MaxTableSize> m_entry_infos{};
-    std::array<KAutoObject*, MaxTableSize> m_objects{};
+    std::array<std::atomic<KAutoObject*>, MaxTableSize> m_objects{};
     mutable KSpinLock m_lock;
+    std::atomic<u32> m_sequence{};
     s32 m_free_head_index{};
-    u16 m_table_size{};
+    std::atomic<u16> m_table_size{};
     u16 m_max_count{};
     u16 m_next_linear_id{};
     u16 m_count{};
@@ -5804,7 +5804,17 @@ Result KPageTableBase::Operate(PageLinkedList* page_list, KProcessAddress virt_a
     }
 }
 
+void KPageTableBase::BeginUpdate() {
+    if (m_memory != nullptr) {
+        m_memory->BeginHostMappingBatch();
+    }
+}
+
 void KPageTableBase::FinalizeUpdate(PageLinkedList* page_list) {
+    if (m_memory != nullptr) {
+        m_memory->EndHostMappingBatch();
+    }
+
     while (page_list->Peek()) {
         [[maybe_unused]] auto page = page_list->Pop();
 
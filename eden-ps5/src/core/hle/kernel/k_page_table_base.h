@@ -176,7 +176,9 @@ private:
         PageLinkedList m_ll;
 
     public:
-        explicit KScopedPageTableUpdater(KPageTableBase* pt) : m_pt(pt), m_ll() {}
+        explicit KScopedPageTableUpdater(KPageTableBase* pt) : m_pt(pt), m_ll() {
+            m_pt->BeginUpdate();
+        }
         explicit KScopedPageTableUpdater(KPageTableBase& pt)
             : KScopedPageTableUpdater(std::addressof(pt)) {}
         ~KScopedPageTableUpdater() {
@@ -332,6 +334,10 @@ protected:
                    OperationType operation, bool reuse_ll);
     void FinalizeUpdate(PageLinkedList* page_list);
 
+    // Host fastmem updates issued between BeginUpdate and FinalizeUpdate are coalesced
+    // and applied when the update is finalized.
+    void BeginUpdate();
+
     bool IsLockedByCurrentThread() const {
         return m_general_lock.IsLockedByCurrentThread();
     }
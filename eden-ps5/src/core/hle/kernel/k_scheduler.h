@@ -1,9 +1,13 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2020 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #pragma once
 
 #include <atomic>
+#include <source_location>
 
 #include "common/common_types.h"
 #include "core/hle/kernel/global_scheduler_context.h"
@@ -163,11 +167,23 @@ private:
     bool m_switch_from_schedule{};
 };
 
-class KScopedSchedulerLock : public KScopedLock<KScheduler::LockType> {
+class KScopedSchedulerLock {
 public:
-    explicit KScopedSchedulerLock(KernelCore& kernel)
-        : KScopedLock(kernel.GlobalSchedulerContext().m_scheduler_lock) {}
-    ~KScopedSchedulerLock() = default;
+    explicit KScopedSchedulerLock(KernelCore& kernel,
+                                  std::source_location location = std::source_location::current())
+        : m_lock(kernel.GlobalSchedulerContext().m_scheduler_lock) {
+        m_lock.Lock(location);
+    }
+
+    ~KScopedSchedulerLock() {
+        m_lock.Unlock();
+    }
+
+    YUZU_NON_COPYABLE(KScopedSchedulerLock);
+    YUZU_NON_MOVEABLE(KScopedSchedulerLock);
+
+private:
+    KScheduler::LockType& m_lock;
 };
 
 } // namespace Kernel
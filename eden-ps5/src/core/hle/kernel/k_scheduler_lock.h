@@ -1,14 +1,20 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2020 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #pragma once
 
 #include <atomic>
+#include <chrono>
+#include <source_location>
 #include "common/assert.h"
 #include "core/hle/kernel/k_interrupt_manager.h"
 #include "core/hle/kernel/k_spin_lock.h"
 #include "core/hle/kernel/k_thread.h"
 #include "core/hle/kernel/kernel.h"
+#include "core/hle/kernel/lock_contention_profiler.h"
 #include "core/hle/kernel/physical_core.h"
 
 namespace Kernel {
@@ -25,7 +31,7 @@ public:
         return m_owner_thread == GetCurrentThreadPointer(m_kernel);
     }
 
-    void Lock() {
+    void Lock(std::source_location location = std::source_location::current()) {
         if (this->IsLockedByCurrentThread()) {
             // If we already own the lock, the lock count should be > 0.
             // For debug, ensure this is true.
@@ -33,7 +39,9 @@ public:
         } else {
             // Otherwise, we want to disable scheduling and acquire the spinlock.
             SchedulerType::DisableScheduling(m_kernel);
-            m_spin_lock.Lock();
+            if (!m_spin_lock.TryLock()) [[unlikely]] {
+                this->LockContended(location);
+            }
 
             ASSERT(m_lock_count == 0);
             ASSERT(m_owner_thread == nullptr);
@@ -69,6 +77,19 @@ public:
     }
 
 private:
+    void LockContended(const std::source_location& location) {
+        // Only time the wait when the contention profiler is enabled.
+        auto* const profiler = m_kernel.GetLockContentionProfiler();
+        if (profiler == nullptr) {
+            m_spin_lock.Lock();
+            return;
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        m_spin_lock.Lock();
+        profiler->RecordWait(location, std::chrono::steady_clock::now() - start);
+    }
+
     friend class GlobalSchedulerContext;
 
     KernelCore& m_kernel;
@@ -1,8 +1,13 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2020 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #pragma once
 
+#include <source_location>
+
 #include "common/common_types.h"
 #include "core/hle/kernel/global_scheduler_context.h"
 #include "core/hle/kernel/k_hardware_timer.h"
@@ -13,11 +18,12 @@ namespace Kernel {
 
 class KScopedSchedulerLockAndSleep {
 public:
-    explicit KScopedSchedulerLockAndSleep(KernelCore& kernel, KHardwareTimer** out_timer,
-                                          KThread* thread, s64 timeout_tick)
+    explicit KScopedSchedulerLockAndSleep(
+        KernelCore& kernel, KHardwareTimer** out_timer, KThread* thread, s64 timeout_tick,
+        std::source_location location = std::source_location::current())
         : m_kernel(kernel), m_timeout_tick(timeout_tick), m_thread(thread), m_timer() {
         // Lock the scheduler.
-        kernel.GlobalSchedulerContext().m_scheduler_lock.Lock();
+        kernel.GlobalSchedulerContext().m_scheduler_lock.Lock(location);
 
         // Set our timer only if the time is positive.
         m_timer = (timeout_tick > 0) ? std::addressof(kernel.HardwareTimer()) : nullptr;
@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2021 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -84,6 +87,14 @@ Result KSynchronizationObject::Wait(KernelCore& kernel, s32* out_index,
     ThreadQueueImplForKSynchronizationObjectWait wait_queue(kernel, objects, thread_nodes.data(),
                                                             num_objects);
 
+    // Prepare the thread nodes before taking the scheduler lock, nothing else can see them yet.
+    for (auto i = 0; i < num_objects; ++i) {
+        ASSERT(objects[i] != nullptr);
+
+        thread_nodes[i].thread = thread;
+        thread_nodes[i].next = nullptr;
+    }
+
     {
         // Setup the scheduling lock and sleep.
         KScopedSchedulerLockAndSleep slp(kernel, std::addressof(timer), thread, timeout);
@@ -96,8 +107,6 @@ Result KSynchronizationObject::Wait(KernelCore& kernel, s32* out_index,
 
         // Check if any of the objects are already signaled.
         for (auto i = 0; i < num_objects; ++i) {
-            ASSERT(objects[i] != nullptr);
-
             if (objects[i]->IsSignaled()) {
                 *out_index = i;
                 slp.CancelSleep();
@@ -120,9 +129,6 @@ Result KSynchronizationObject::Wait(KernelCore& kernel, s32* out_index,
 
         // Add the waiters.
         for (auto i = 0; i < num_objects; ++i) {
-            thread_nodes[i].thread = thread;
-            thread_nodes[i].next = nullptr;
-
             objects[i]->LinkNode(std::addressof(thread_nodes[i]));
         }
 
@@ -7,19 +7,27 @@
 #include <array>
 #include <atomic>
 #include <bitset>
+#include <chrono>
+#include <ctime>
 #include <functional>
 #include <memory>
 #include <thread>
 #include <unordered_set>
 #include <utility>
 
+#include <fmt/chrono.h>
+
 #include "common/assert.h"
+#include "common/fs/fs.h"
+#include "common/fs/path_util.h"
 #include "common/logging/log.h"
 #include "common/scope_exit.h"
+#include "common/settings.h"
 #include "common/thread.h"
 #include "common/thread_worker.h"
 #include "core/arm/arm_interface.h"
 #include "core/arm/exclusive_monitor.h"
+#include "core/arm/guest_profiler.h"
 #include "core/core.h"
 #include "core/core_timing.h"
 #include "core/cpu_manager.h"
@@ -42,6 +50,7 @@
 #include "core/hle/kernel/k_thread.h"
 #include "core/hle/kernel/k_worker_task_manager.h"
 #include "core/hle/kernel/kernel.h"
+#include "core/hle/kernel/lock_contention_profiler.h"
 #include "core/hle/kernel/physical_core.h"
 #include "core/hle/result.h"
 #include "core/hle/service/server_manager.h"
@@ -55,6 +64,7 @@ struct KernelCore::Impl {
     static constexpr size_t SystemMemoryBlockSlabHeapSize = 10000;
     static constexpr size_t BlockInfoSlabHeapSize = 4000;
     static constexpr size_t ReservedDynamicPageCount = 64;
+    static constexpr std::chrono::microseconds GuestProfilerInterval{1000};
 
     explicit Impl(Core::System& system_, KernelCore& kernel_) : system{system_} {}
 
@@ -66,6 +76,10 @@ struct KernelCore::Impl {
         hardware_timer = std::make_unique<Kernel::KHardwareTimer>(kernel);
         hardware_timer->Initialize();
 
+        if (Settings::values.profile_kernel_locks.GetValue()) {
+            lock_contention_profiler = std::make_unique<Kernel::LockContentionProfiler>();
+        }
+
         global_object_list_container = std::make_unique<KAutoObjectWithListContainer>(kernel);
         global_scheduler_context = std::make_unique<Kernel::GlobalSchedulerContext>(kernel);
 
@@ -82,6 +96,12 @@ struct KernelCore::Impl {
         InitializeShutdownThreads();
         InitializePhysicalCores();
         InitializePreemption(kernel);
+
+        if (Settings::values.profile_guest_code.GetValue()) {
+            guest_profiler = std::make_unique<Core::GuestProfiler>(
+                kernel, Settings::values.profile_guest_jit_blocks.GetValue());
+            guest_profiler->Start(GuestProfilerInterval);
+        }
         InitializeGlobalData(kernel);
 
         // Initialize the Dynamic Slab Heaps.
@@ -113,6 +133,13 @@ struct KernelCore::Impl {
             is_shutting_down.store(false, std::memory_order_relaxed);
         };
 
+        if (guest_profiler) {
+            guest_profiler->Stop();
+            guest_profiler->LogReport();
+            WriteGuestProfile();
+            guest_profiler.reset();
+        }
+
         CloseServices();
 
         if (application_process) {
@@ -181,6 +208,24 @@ struct KernelCore::Impl {
 
         hardware_timer->Finalize();
         hardware_timer.reset();
+
+        if (lock_contention_profiler) {
+            lock_contention_profiler->LogReport();
+            lock_contention_profiler.reset();
+        }
+    }
+
+    void WriteGuestProfile() {
+        const std::time_t t = std::time(nullptr);
+        const auto filename =
+            fmt::format("{:%F-%H-%M-%S}_guest_profile.folded", *std::localtime(&t));
+        const auto filepath = Common::FS::GetEdenPath(Common::FS::EdenPath::LogDir) / filename;
+        if (!Common::FS::CreateParentDir(filepath) ||
+            !guest_profiler->WriteCollapsedStacks(filepath)) {
+            LOG_ERROR(Kernel, "Failed to write the guest profile to {}", filepath.string());
+            return;
+        }
+        LOG_INFO(Kernel, "Guest profile written to {}", filepath.string());
     }
 
     void CloseServices() {
@@ -782,6 +827,8 @@ struct KernelCore::Impl {
     KProcess* application_process{};
     std::unique_ptr<Kernel::GlobalSchedulerContext> global_scheduler_context;
     std::unique_ptr<Kernel::KHardwareTimer> hardware_timer;
+    std::unique_ptr<Kernel::LockContentionProfiler> lock_contention_profiler;
+    std::unique_ptr<Core::GuestProfiler> guest_profiler;
 
     Init::KSlabResourceCounts slab_resource_counts{};
     KResourceLimit* system_resource_limit{};
@@ -966,6 +1013,14 @@ Kernel::KHardwareTimer& KernelCore::HardwareTimer() {
     return *impl->hardware_timer;
 }
 
+Kernel::LockContentionProfiler* KernelCore::GetLockContentionProfiler() {
+    return impl->lock_contention_profiler.get();
+}
+
+Core::GuestProfiler* KernelCore::GetGuestProfiler() {
+    return impl->guest_profiler.get();
+}
+
 KAutoObjectWithListContainer& KernelCore::ObjectListContainer() {
     return *impl->global_object_list_container;
 }
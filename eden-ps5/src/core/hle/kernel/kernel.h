@@ -23,6 +23,7 @@
 
 namespace Core {
 class ExclusiveMonitor;
+class GuestProfiler;
 class System;
 } // namespace Core
 
@@ -74,6 +75,7 @@ class KThreadLocalPage;
 class KTransferMemory;
 class KWorkerTaskManager;
 class KCodeMemory;
+class LockContentionProfiler;
 class PhysicalCore;
 
 namespace Init {
@@ -169,6 +171,12 @@ public:
     /// Gets the an instance of the hardware timer.
     Kernel::KHardwareTimer& HardwareTimer();
 
+    /// Gets the scheduler lock contention profiler, or nullptr if profiling is disabled.
+    Kernel::LockContentionProfiler* GetLockContentionProfiler();
+
+    /// Gets the guest code sampling profiler, or nullptr if profiling is disabled.
+    Core::GuestProfiler* GetGuestProfiler();
+
     /// Stops execution of 'id' core, in order to reschedule a new thread.
     void PrepareReschedule(std::size_t id);
 
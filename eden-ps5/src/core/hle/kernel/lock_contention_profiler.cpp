@@ -0,0 +1,80 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <algorithm>
+#include <functional>
+
+#include "common/logging/log.h"
+#include "core/hle/kernel/lock_contention_profiler.h"
+
+namespace Kernel {
+
+namespace {
+
+/// Strips the build directory from a source path, keeping it relative to src/.
+std::string_view ShortenPath(std::string_view path) {
+    if (const size_t pos = path.rfind("src/"); pos != std::string_view::npos) {
+        return path.substr(pos + 4);
+    }
+    return path;
+}
+
+} // Anonymous namespace
+
+size_t LockContentionProfiler::SiteKeyHash::operator()(const SiteKey& key) const noexcept {
+    return std::hash<std::string_view>{}(key.file) ^ (static_cast<size_t>(key.line) << 1);
+}
+
+void LockContentionProfiler::RecordWait(const std::source_location& location,
+                                        std::chrono::nanoseconds wait) {
+    const SiteKey key{location.file_name(), location.line()};
+
+    std::scoped_lock lk{m_mutex};
+    auto [it, inserted] = m_sites.try_emplace(key);
+    SiteStats& stats = it->second;
+    if (inserted) {
+        stats.file = key.file;
+        stats.function = location.function_name();
+        stats.line = key.line;
+    }
+    ++stats.wait_count;
+    stats.total_wait += wait;
+    stats.max_wait = std::max(stats.max_wait, wait);
+}
+
+std::vector<LockContentionProfiler::SiteStats> LockContentionProfiler::GetStats() const {
+    std::vector<SiteStats> stats;
+    {
+        std::scoped_lock lk{m_mutex};
+        stats.reserve(m_sites.size());
+        for (const auto& [key, site] : m_sites) {
+            stats.push_back(site);
+        }
+    }
+    std::ranges::sort(stats, std::greater{}, &SiteStats::total_wait);
+    return stats;
+}
+
+void LockContentionProfiler::LogReport(size_t max_sites) const {
+    const std::vector<SiteStats> stats = GetStats();
+    if (stats.empty()) {
+        LOG_INFO(Kernel, "No contended scheduler lock acquisitions were recorded");
+        return;
+    }
+
+    LOG_INFO(Kernel, "Scheduler lock contention by call site:");
+    for (size_t i = 0; i < std::min(max_sites, stats.size()); ++i) {
+        const SiteStats& site = stats[i];
+        const auto total_us = std::chrono::duration_cast<std::chrono::microseconds>(site.total_wait);
+        const auto max_us = std::chrono::duration_cast<std::chrono::microseconds>(site.max_wait);
+        LOG_INFO(Kernel, "  {}:{} ({}): {} waits, {} us total, {} us max", ShortenPath(site.file),
+                 site.line, site.function, site.wait_count, total_us.count(), max_us.count());
+    }
+}
+
+void LockContentionProfiler::Reset() {
+    std::scoped_lock lk{m_mutex};
+    m_sites.clear();
+}
+
+} // namespace Kernel
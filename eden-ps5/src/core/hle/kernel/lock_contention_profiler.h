@@ -0,0 +1,66 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <chrono>
+#include <mutex>
+#include <source_location>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "common/common_funcs.h"
+#include "common/common_types.h"
+
+namespace Kernel {
+
+/**
+ * Accumulates the time spent waiting on a contended kernel lock, keyed by the call site that
+ * tried to acquire it. Uncontended acquisitions are not recorded, so the profiler only costs
+ * anything when a core actually had to wait.
+ */
+class LockContentionProfiler {
+public:
+    struct SiteStats {
+        std::string_view file;
+        std::string_view function;
+        u32 line;
+        u64 wait_count;
+        std::chrono::nanoseconds total_wait;
+        std::chrono::nanoseconds max_wait;
+    };
+
+    explicit LockContentionProfiler() = default;
+
+    YUZU_NON_COPYABLE(LockContentionProfiler);
+    YUZU_NON_MOVEABLE(LockContentionProfiler);
+
+    /// Records a wait of the given duration for the lock acquired at location.
+    void RecordWait(const std::source_location& location, std::chrono::nanoseconds wait);
+
+    /// Returns the statistics of every call site that waited, sorted by total wait time.
+    [[nodiscard]] std::vector<SiteStats> GetStats() const;
+
+    /// Logs the call sites with the most wait time.
+    void LogReport(size_t max_sites = 16) const;
+
+    void Reset();
+
+private:
+    struct SiteKey {
+        std::string_view file;
+        u32 line;
+
+        bool operator==(const SiteKey&) const = default;
+    };
+
+    struct SiteKeyHash {
+        size_t operator()(const SiteKey& key) const noexcept;
+    };
+
+    mutable std::mutex m_mutex;
+    std::unordered_map<SiteKey, SiteStats, SiteKeyHash> m_sites;
+};
+
+} // namespace Kernel
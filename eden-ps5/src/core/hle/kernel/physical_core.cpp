@@ -6,7 +6,10 @@
 
 #include "common/scope_exit.h"
 #include "common/settings.h"
+#include "common/subsystem_profiler.h"
+#include "core/arm/guest_profiler.h"
 #include "core/core.h"
+#include "core/core_timing.h"
 #include "core/debugger/debugger.h"
 #include "core/hle/kernel/k_process.h"
 #include "core/hle/kernel/k_thread.h"
@@ -83,6 +86,7 @@ void PhysicalCore::RunThread(Kernel::KThread* thread) {
                 return;
             }
 
+            const Common::ScopedSubsystemTimer timer{Common::Subsystem::CpuJit};
             if (thread->GetStepState() == StepState::StepPending) {
                 hr = interface->StepThread(thread);
 
@@ -103,6 +107,15 @@ void PhysicalCore::RunThread(Kernel::KThread* thread) {
         const bool data_abort = True(hr & Core::HaltReason::DataAbort);
         const bool interrupt = True(hr & Core::HaltReason::BreakLoop);
 
+        // Record a profiler sample before the context may change.
+        if (True(hr & Core::HaltReason::ProfileSample)) {
+            if (auto* profiler = m_kernel.GetGuestProfiler(); profiler) {
+                Svc::ThreadContext ctx{};
+                interface->GetContext(ctx);
+                profiler->RecordSample(process, ctx, interface->UsesJitBlocks());
+            }
+        }
+
         // Since scheduling may occur here, we cannot use any cached
         // state after returning from calls we make.
 
@@ -137,6 +150,13 @@ void PhysicalCore::RunThread(Kernel::KThread* thread) {
             return;
         }
 
+        // A profiler sample alone does not end the slice, resume the guest. In single core mode
+        // the JIT also returns once the slice ran out of ticks, which the sample may coincide with.
+        if (hr == Core::HaltReason::ProfileSample &&
+            (!m_is_single_core || system.CoreTiming().GetDowncount() > 0)) {
+            continue;
+        }
+
         // Handle external interrupt sources.
         if (interrupt || m_is_single_core) {
             return;
@@ -234,6 +254,17 @@ void PhysicalCore::Interrupt() {
     arm_interface->SignalInterrupt(thread);
 }
 
+void PhysicalCore::RequestProfileSample() {
+    std::scoped_lock lk{m_guard};
+
+    // Only running guest code is sampled.
+    if (m_arm_interface == nullptr) {
+        return;
+    }
+
+    m_arm_interface->SignalProfileSample(m_current_thread);
+}
+
 void PhysicalCore::ClearInterrupt() {
     std::scoped_lock lk{m_guard};
     m_is_interrupted = false;
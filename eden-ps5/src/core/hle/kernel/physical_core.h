@@ -52,6 +52,9 @@ public:
     // Interrupt this core.
     void Interrupt();
 
+    // Ask the running guest code to halt for a profiler sample.
+    void RequestProfileSample();
+
     // Clear this core's interrupt.
     void ClearInterrupt();
 
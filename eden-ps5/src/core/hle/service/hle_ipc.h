@@ -389,6 +389,23 @@ public:
         is_deferred = is_deferred_;
     }
 
+    /// Attaches service state to a deferred request, kept until the request is retried
+    template <typename T>
+    void SetDeferredState(T state) {
+        deferred_state = std::make_shared<T>(std::move(state));
+    }
+
+    /// Takes the state attached by a previous attempt of this request, if any
+    template <typename T>
+    [[nodiscard]] std::optional<T> TakeDeferredState() {
+        if (!deferred_state) {
+            return std::nullopt;
+        }
+        std::optional<T> state{std::move(*std::static_pointer_cast<T>(deferred_state))};
+        deferred_state.reset();
+        return state;
+    }
+
 private:
     friend class IPC::ResponseBuilder;
 
@@ -425,6 +442,7 @@ private:
 
     std::weak_ptr<SessionRequestManager> manager{};
     bool is_deferred{false};
+    std::shared_ptr<void> deferred_state;
 
     Kernel::KernelCore& kernel;
     Core::Memory::Memory& memory;
@@ -366,6 +366,12 @@ Result ServerManager::CompleteSyncRequest(Session* session) {
     // Mark the request as not deferred.
     session->GetContext()->SetIsDeferred(false);
 
+    // Remember how many deferral events were handled before the request ran.
+    const u64 deferral_generation = [&] {
+        std::scoped_lock lk{m_deferred_list_mutex};
+        return m_deferral_generation;
+    }();
+
     // Complete the request. We have exclusive access to this session.
     auto* server_session = static_cast<Kernel::KServerSession*>(session->GetNativeHandle());
     service_res =
@@ -374,8 +380,18 @@ Result ServerManager::CompleteSyncRequest(Session* session) {
     // If we've been deferred, we're done.
     if (session->GetContext()->GetIsDeferred()) {
         // Insert into deferred session list.
-        std::scoped_lock ll{m_deferred_list_mutex};
-        m_deferred_sessions.push_back(session);
+        bool missed_deferral;
+        {
+            std::scoped_lock ll{m_deferred_list_mutex};
+            m_deferred_sessions.push_back(session);
+            missed_deferral = m_deferral_generation != deferral_generation;
+        }
+
+        // If the deferral event was handled while the request ran, the session was not in the
+        // list yet. Signal again so the wakeup it may have been waiting for is not lost.
+        if (missed_deferral && m_deferral_event) {
+            m_deferral_event->Signal();
+        }
 
         // Finish.
         R_SUCCEED();
@@ -406,6 +422,7 @@ Result ServerManager::OnDeferralEvent() {
     // Get and clear list.
     const auto deferrals = [&] {
         std::scoped_lock lk{m_deferred_list_mutex};
+        ++m_deferral_generation;
         return std::move(m_deferred_sessions);
     }();
 
@@ -79,6 +79,7 @@ private:
     // Deferred wait list
     std::mutex m_deferred_list_mutex{};
     MultiWait m_deferred_list{};
+    u64 m_deferral_generation{};
 
     // Guest state tracking
     MultiWait m_multi_wait{};
@@ -8,6 +8,7 @@
 #include "common/assert.h"
 #include "common/logging/log.h"
 #include "common/settings.h"
+#include "common/subsystem_profiler.h"
 #include "core/core.h"
 #include "core/hle/ipc.h"
 #include "core/hle/kernel/kernel.h"
@@ -114,6 +115,7 @@ void ServiceFrameworkBase::InvokeRequestTipc(HLERequestContext& ctx) {
 Result ServiceFrameworkBase::HandleSyncRequest(Kernel::KServerSession& session,
                                                HLERequestContext& ctx) {
     const auto guard = LockService();
+    const Common::ScopedSubsystemTimer timer{Common::Subsystem::Services};
 
     Result result = ResultSuccess;
 
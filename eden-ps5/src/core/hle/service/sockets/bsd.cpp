@@ -5,7 +5,9 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <array>
+#include <chrono>
 #include <memory>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -13,12 +15,14 @@
 
 #include "common/socket_types.h"
 #include "core/core.h"
+#include "core/hle/kernel/k_event.h"
 #include "core/hle/kernel/k_thread.h"
 #include "core/hle/service/ipc_helpers.h"
 #include "core/hle/service/sockets/bsd.h"
 #include "core/hle/service/sockets/sockets_translate.h"
 #include "core/internal_network/network.h"
 #include "core/internal_network/socket_proxy.h"
+#include "core/internal_network/socket_reactor.h"
 #include "core/internal_network/sockets.h"
 #include "network/network.h"
 #include <common/settings.h>
@@ -88,7 +92,7 @@ void BSD::AcceptWork::Response(HLERequestContext& ctx) {
 }
 
 void BSD::ConnectWork::Execute(BSD* bsd) {
-    bsd_errno = bsd->ConnectImpl(fd, addr);
+    bsd_errno = in_progress ? bsd->FinishConnectImpl(fd) : bsd->ConnectImpl(fd, addr);
 }
 
 void BSD::ConnectWork::Response(HLERequestContext& ctx) {
@@ -484,8 +488,124 @@ void BSD::EventFd(HLERequestContext& ctx) {
 
 template <typename Work>
 void BSD::ExecuteWork(HLERequestContext& ctx, Work work) {
-    work.Execute(this);
-    work.Response(ctx);
+    constexpr bool is_poll = std::is_same_v<Work, PollWork>;
+
+    if constexpr (!is_poll && !requires { Work::wait_events; }) {
+        // Sends could complete partially without blocking, so they keep blocking
+        work.Execute(this);
+        work.Response(ctx);
+    } else {
+        // Retries of deferred requests run the handler again from the start. The pending state
+        // lives on the request context, so it is released along with a closed session.
+        std::optional<PendingWork> pending = ctx.TakeDeferredState<PendingWork>();
+        if constexpr (requires { work.in_progress; }) {
+            work.in_progress = pending.has_value();
+        }
+
+        bool is_deferrable;
+        if constexpr (is_poll) {
+            is_deferrable = work.timeout != 0 && CanDeferPoll(work.read_buffer, work.nfds);
+        } else {
+            is_deferrable = CanDeferSocket(work.fd);
+            if constexpr (requires { work.flags; }) {
+                // A nonblocking retry returns after a partial read, so MSG_WAITALL keeps blocking
+                is_deferrable &= (work.flags & (Network::FLAG_MSG_DONTWAIT |
+                                                Network::FLAG_MSG_WAITALL)) == 0;
+            }
+        }
+        if (!is_deferrable) {
+            work.Execute(this);
+            work.Response(ctx);
+            return;
+        }
+
+        // Run the operation without blocking. If it would block, the request is deferred and the
+        // server manager retries it once the reactor sees its sockets become ready.
+        bool would_block;
+        if constexpr (is_poll) {
+            const s32 timeout = std::exchange(work.timeout, 0);
+            work.Execute(this);
+            work.timeout = timeout;
+            would_block = work.ret == 0;
+        } else {
+            const std::shared_ptr<Network::SocketBase> socket = file_descriptors[work.fd]->socket;
+            socket->SetNonBlock(true);
+            work.Execute(this);
+            socket->SetNonBlock(false);
+            would_block = work.bsd_errno == Errno::AGAIN || work.bsd_errno == Errno::INPROGRESS;
+        }
+
+        const auto now = std::chrono::steady_clock::now();
+        const bool is_expired = pending && pending->deadline && now >= *pending->deadline;
+        if (!would_block || is_expired) {
+            // Expired polls report no events and expired receives report EAGAIN, like the timeouts
+            // of blocking calls
+            work.Response(ctx);
+            return;
+        }
+
+        if (!pending) {
+            pending.emplace();
+            if constexpr (is_poll) {
+                if (work.timeout > 0) {
+                    pending->deadline = now + std::chrono::milliseconds{work.timeout};
+                }
+            } else if constexpr (Work::wait_events == Network::PollEvents::In) {
+                const u32 rcv_timeout = file_descriptors[work.fd]->rcv_timeout;
+                if (rcv_timeout != 0) {
+                    pending->deadline = now + std::chrono::milliseconds{rcv_timeout};
+                }
+            }
+            if (pending->deadline) {
+                reactor->WakeAt(*pending->deadline);
+            }
+        }
+
+        if constexpr (is_poll) {
+            WatchPoll(work.read_buffer, work.nfds);
+        } else {
+            reactor->Watch(file_descriptors[work.fd]->socket->GetFD(), Work::wait_events);
+        }
+        ctx.SetDeferredState(*pending);
+        ctx.SetIsDeferred();
+    }
+}
+
+bool BSD::CanDeferSocket(s32 fd) const {
+    if (!reactor || fd < 0 || fd >= static_cast<s32>(MAX_FD) || !file_descriptors[fd]) {
+        return false;
+    }
+    const FileDescriptor& descriptor = *file_descriptors[fd];
+    if ((descriptor.flags & Network::FLAG_O_NONBLOCK) != 0) {
+        return false;
+    }
+    // Proxy sockets have no host socket to wait on
+    return dynamic_cast<const Network::Socket*>(descriptor.socket.get()) != nullptr;
+}
+
+bool BSD::CanDeferPoll(std::span<const u8> read_buffer, s32 nfds) const {
+    if (!reactor || nfds <= 0 || read_buffer.size() < nfds * sizeof(PollFD)) {
+        return false;
+    }
+    for (s32 i = 0; i < nfds; ++i) {
+        const auto pollfd = GetValue<PollFD>(read_buffer.subspan(i * sizeof(PollFD)));
+        if (pollfd.fd < 0 || pollfd.fd >= static_cast<s32>(MAX_FD) ||
+            !file_descriptors[pollfd.fd]) {
+            return false;
+        }
+        const Network::SocketBase* const socket = file_descriptors[pollfd.fd]->socket.get();
+        if (dynamic_cast<const Network::Socket*>(socket) == nullptr) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void BSD::WatchPoll(std::span<const u8> read_buffer, s32 nfds) {
+    for (s32 i = 0; i < nfds; ++i) {
+        const auto pollfd = GetValue<PollFD>(read_buffer.subspan(i * sizeof(PollFD)));
+        reactor->Watch(file_descriptors[pollfd.fd]->socket->GetFD(), Translate(pollfd.events));
+    }
 }
 
 std::pair<s32, Errno> BSD::SocketImpl(Domain domain, Type type, Protocol protocol) {
@@ -646,6 +766,30 @@ Errno BSD::ConnectImpl(s32 fd, std::span<const u8> addr) {
     return Translate(file_descriptors[fd]->socket->Connect(Translate(addr_in)));
 }
 
+Errno BSD::FinishConnectImpl(s32 fd) {
+    if (!IsFileDescriptorValid(fd)) {
+        return Errno::BADF;
+    }
+
+    Network::SocketBase* const socket = file_descriptors[fd]->socket.get();
+    std::vector<Network::PollFD> host_pollfds{
+        Network::PollFD{socket, Network::PollEvents::Out, Network::PollEvents{}},
+    };
+    const auto [num_ready, poll_errno] = Network::Poll(host_pollfds, 0);
+    if (poll_errno != Network::Errno::SUCCESS) {
+        return Translate(poll_errno);
+    }
+    if (num_ready == 0) {
+        return Errno::INPROGRESS;
+    }
+
+    const auto [pending_err, getsockopt_err] = socket->GetPendingError();
+    if (getsockopt_err != Network::Errno::SUCCESS) {
+        return Translate(getsockopt_err);
+    }
+    return Translate(pending_err);
+}
+
 Errno BSD::GetPeerNameImpl(s32 fd, std::vector<u8>& write_buffer) {
     if (!IsFileDescriptorValid(fd)) {
         return Errno::BADF;
@@ -784,6 +928,8 @@ Errno BSD::SetSockOptImpl(s32 fd, u32 level, OptName optname, std::span<const u8
     case OptName::SNDTIMEO:
         return Translate(socket->SetSndTimeo(value));
     case OptName::RCVTIMEO:
+        // Deferred receives implement the timeout themselves
+        file_descriptors[fd]->rcv_timeout = value;
         return Translate(socket->SetRcvTimeo(value));
     case OptName::NOSIGPIPE:
         LOG_WARNING(Service, "(STUBBED) setting NOSIGPIPE to {}", value);
@@ -906,7 +1052,12 @@ Errno BSD::CloseImpl(s32 fd) {
         return Errno::BADF;
     }
 
-    const Errno bsd_errno = Translate(file_descriptors[fd]->socket->Close());
+    Network::SocketBase* const socket = file_descriptors[fd]->socket.get();
+    if (reactor && dynamic_cast<Network::Socket*>(socket) != nullptr) {
+        reactor->Forget(socket->GetFD());
+    }
+
+    const Errno bsd_errno = Translate(socket->Close());
     if (bsd_errno != Errno::SUCCESS) {
         return bsd_errno;
     }
@@ -914,6 +1065,11 @@ Errno BSD::CloseImpl(s32 fd) {
     LOG_INFO(Service, "Close socket fd={}", fd);
 
     file_descriptors[fd].reset();
+
+    // Let requests deferred on the socket fail instead of waiting forever
+    if (deferral_event) {
+        deferral_event->Signal();
+    }
     return bsd_errno;
 }
 
@@ -939,6 +1095,12 @@ std::optional<std::shared_ptr<Network::SocketBase>> BSD::GetSocket(s32 fd) {
     return file_descriptors[fd]->socket;
 }
 
+void BSD::SetDeferralEvent(Kernel::KEvent* deferral_event_) {
+    deferral_event = deferral_event_;
+    deferral_event->Open();
+    reactor = Network::SocketReactor::Create([this] { deferral_event->Signal(); });
+}
+
 s32 BSD::FindFreeFileDescriptorHandle() noexcept {
     for (s32 fd = 0; fd < static_cast<s32>(file_descriptors.size()); ++fd) {
         if (!file_descriptors[fd]) {
@@ -1033,6 +1195,11 @@ BSD::~BSD() {
     if (auto room_member = Network::GetRoomMember().lock()) {
         room_member->Unbind(proxy_packet_received);
     }
+
+    reactor.reset();
+    if (deferral_event) {
+        deferral_event->Close();
+    }
 }
 
 std::unique_lock<std::mutex> BSD::LockService() {
@@ -6,7 +6,10 @@
 
 #pragma once
 
+#include <chrono>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <span>
 #include <vector>
 
@@ -15,15 +18,21 @@
 #include "common/socket_types.h"
 #include "core/hle/service/service.h"
 #include "core/hle/service/sockets/sockets.h"
+#include "core/internal_network/network.h"
 #include "network/network.h"
 
 namespace Core {
 class System;
 }
 
+namespace Kernel {
+class KEvent;
+}
+
 namespace Network {
 class SocketBase;
 class Socket;
+class SocketReactor;
 } // namespace Network
 
 namespace Service::Sockets {
@@ -40,6 +49,9 @@ public:
     Errno CloseImpl(s32 fd);
     std::optional<std::shared_ptr<Network::SocketBase>> GetSocket(s32 fd);
 
+    /// Enables deferring blocking calls, the event is signaled when deferred calls can be retried
+    void SetDeferralEvent(Kernel::KEvent* deferral_event_);
+
 private:
     /// Maximum number of file descriptors
     static constexpr size_t MAX_FD = 128;
@@ -47,9 +59,15 @@ private:
     struct FileDescriptor {
         std::shared_ptr<Network::SocketBase> socket;
         s32 flags = 0;
+        u32 rcv_timeout = 0; ///< Receive timeout in milliseconds, zero waits forever
         bool is_connection_based = false;
     };
 
+    /// Request deferred until its sockets are ready
+    struct PendingWork {
+        std::optional<std::chrono::steady_clock::time_point> deadline;
+    };
+
     struct PollWork {
         void Execute(BSD* bsd);
         void Response(HLERequestContext& ctx);
@@ -63,6 +81,8 @@ private:
     };
 
     struct AcceptWork {
+        static constexpr Network::PollEvents wait_events = Network::PollEvents::In;
+
         void Execute(BSD* bsd);
         void Response(HLERequestContext& ctx);
 
@@ -73,15 +93,20 @@ private:
     };
 
     struct ConnectWork {
+        static constexpr Network::PollEvents wait_events = Network::PollEvents::Out;
+
         void Execute(BSD* bsd);
         void Response(HLERequestContext& ctx);
 
         s32 fd;
         std::span<const u8> addr;
+        bool in_progress{}; ///< Connection was started by a previous deferred attempt
         Errno bsd_errno{};
     };
 
     struct RecvWork {
+        static constexpr Network::PollEvents wait_events = Network::PollEvents::In;
+
         void Execute(BSD* bsd);
         void Response(HLERequestContext& ctx);
 
@@ -93,6 +118,8 @@ private:
     };
 
     struct RecvFromWork {
+        static constexpr Network::PollEvents wait_events = Network::PollEvents::In;
+
         void Execute(BSD* bsd);
         void Response(HLERequestContext& ctx);
 
@@ -155,12 +182,17 @@ private:
     template <typename Work>
     void ExecuteWork(HLERequestContext& ctx, Work work);
 
+    bool CanDeferSocket(s32 fd) const;
+    bool CanDeferPoll(std::span<const u8> read_buffer, s32 nfds) const;
+    void WatchPoll(std::span<const u8> read_buffer, s32 nfds);
+
     std::pair<s32, Errno> SocketImpl(Domain domain, Type type, Protocol protocol);
     std::pair<s32, Errno> PollImpl(std::vector<u8>& write_buffer, std::span<const u8> read_buffer,
                                    s32 nfds, s32 timeout);
     std::pair<s32, Errno> AcceptImpl(s32 fd, std::vector<u8>& write_buffer);
     Errno BindImpl(s32 fd, std::span<const u8> addr);
     Errno ConnectImpl(s32 fd, std::span<const u8> addr);
+    Errno FinishConnectImpl(s32 fd);
     Errno GetPeerNameImpl(s32 fd, std::vector<u8>& write_buffer);
     Errno GetSockNameImpl(s32 fd, std::vector<u8>& write_buffer);
     Errno ListenImpl(s32 fd, s32 backlog);
@@ -182,6 +214,11 @@ private:
 
     std::array<std::optional<FileDescriptor>, MAX_FD> file_descriptors;
 
+    /// Signaled to retry the deferred requests of the server manager
+    Kernel::KEvent* deferral_event{};
+    /// Notifies readiness of the host sockets of deferred requests, null when unsupported
+    std::unique_ptr<Network::SocketReactor> reactor;
+
     /// Callback to parse and handle a received wifi packet.
     void OnProxyPacketReceived(const Network::ProxyPacket& packet);
 
@@ -1,6 +1,7 @@
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include "core/hle/kernel/k_event.h"
 #include "core/hle/service/server_manager.h"
 #include "core/hle/service/sockets/bsd.h"
 #include "core/hle/service/sockets/nsd.h"
@@ -12,8 +13,20 @@ namespace Service::Sockets {
 void LoopProcess(Core::System& system) {
     auto server_manager = std::make_unique<ServerManager>(system);
 
-    server_manager->RegisterNamedService("bsd:s", std::make_shared<BSD>(system, "bsd:s"));
-    server_manager->RegisterNamedService("bsd:u", std::make_shared<BSD>(system, "bsd:u"));
+    // Blocking socket calls are deferred until the sockets are ready instead of blocking a thread
+    Kernel::KEvent* deferral_event{};
+    server_manager->ManageDeferral(&deferral_event);
+
+    auto bsd_s = std::make_shared<BSD>(system, "bsd:s");
+    auto bsd_u = std::make_shared<BSD>(system, "bsd:u");
+    bsd_s->SetDeferralEvent(deferral_event);
+    bsd_u->SetDeferralEvent(deferral_event);
+
+    // The services hold their own references to the event
+    deferral_event->Close();
+
+    server_manager->RegisterNamedService("bsd:s", std::move(bsd_s));
+    server_manager->RegisterNamedService("bsd:u", std::move(bsd_u));
     server_manager->RegisterNamedService("bsdcfg", std::make_shared<BSDCFG>(system));
     server_manager->RegisterNamedService("nsd:a", std::make_shared<NSD>(system, "nsd:a"));
     server_manager->RegisterNamedService("nsd:u", std::make_shared<NSD>(system, "nsd:u"));
@@ -0,0 +1,251 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <array>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#ifdef __linux__
+#include <errno.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#endif
+
+#include "common/assert.h"
+#include "common/logging/log.h"
+#include "common/polyfill_thread.h"
+#include "common/thread.h"
+#include "core/internal_network/socket_reactor.h"
+
+namespace Network {
+
+#ifdef __linux__
+
+namespace {
+
+u32 TranslateEvents(PollEvents events) {
+    // Errors and hang-ups are always reported
+    u32 result = 0;
+    if (True(events & (PollEvents::In | PollEvents::RdNorm))) {
+        result |= EPOLLIN;
+    }
+    if (True(events & (PollEvents::Pri | PollEvents::RdBand))) {
+        result |= EPOLLPRI;
+    }
+    if (True(events & (PollEvents::Out | PollEvents::WrBand))) {
+        result |= EPOLLOUT;
+    }
+    return result;
+}
+
+} // Anonymous namespace
+
+struct SocketReactor::Impl {
+    explicit Impl(int epoll_fd_, int event_fd_, Callback&& callback_)
+        : epoll_fd{epoll_fd_}, event_fd{event_fd_}, callback{std::move(callback_)} {
+        thread = std::jthread([this](std::stop_token stop_token) { Loop(stop_token); });
+    }
+
+    ~Impl() {
+        thread.request_stop();
+        Wake();
+        thread.join();
+        close(event_fd);
+        close(epoll_fd);
+    }
+
+    void Watch(int fd, PollEvents events) {
+        std::scoped_lock lk{mutex};
+        const auto [it, inserted] = interests.try_emplace(fd, 0U);
+        it->second |= TranslateEvents(events);
+
+        // One-shot interest has to be re-armed by the next wait, but the registration is kept
+        epoll_event event{};
+        event.events = it->second | EPOLLONESHOT;
+        event.data.fd = fd;
+        if (inserted) {
+            if (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &event) == 0) {
+                return;
+            }
+            if (errno == EEXIST && epoll_ctl(epoll_fd, EPOLL_CTL_MOD, fd, &event) == 0) {
+                return;
+            }
+        } else {
+            if (epoll_ctl(epoll_fd, EPOLL_CTL_MOD, fd, &event) == 0) {
+                return;
+            }
+            // The host closed the socket behind our back and the descriptor was reused
+            if (errno == ENOENT && epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &event) == 0) {
+                return;
+            }
+        }
+        LOG_ERROR(Network, "Failed to watch socket fd={} errno={}", fd, errno);
+        interests.erase(it);
+    }
+
+    void Forget(int fd) {
+        std::scoped_lock lk{mutex};
+        if (interests.erase(fd) != 0) {
+            epoll_ctl(epoll_fd, EPOLL_CTL_DEL, fd, nullptr);
+        }
+    }
+
+    void WakeAt(std::chrono::steady_clock::time_point deadline) {
+        bool is_earliest;
+        {
+            std::scoped_lock lk{mutex};
+            is_earliest = deadlines.empty() || deadline < deadlines.top();
+            deadlines.push(deadline);
+        }
+        if (is_earliest) {
+            // Recalculate the wait timeout
+            Wake();
+        }
+    }
+
+    void Wake() {
+        const u64 value = 1;
+        [[maybe_unused]] const ssize_t ret = write(event_fd, &value, sizeof(value));
+    }
+
+    int GetTimeout() {
+        std::scoped_lock lk{mutex};
+        if (deadlines.empty()) {
+            return -1;
+        }
+        const auto remaining = deadlines.top() - std::chrono::steady_clock::now();
+        if (remaining <= std::chrono::steady_clock::duration::zero()) {
+            return 0;
+        }
+        // Round up, waking before the deadline would spin until it is reached
+        return static_cast<int>(
+            std::chrono::ceil<std::chrono::milliseconds>(remaining).count());
+    }
+
+    void Loop(std::stop_token stop_token) {
+        Common::SetCurrentThreadName("SocketReactor");
+
+        std::array<epoll_event, MaxEvents> events;
+        while (!stop_token.stop_requested()) {
+            const int num_events = epoll_wait(epoll_fd, events.data(), MaxEvents, GetTimeout());
+            if (num_events < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                LOG_CRITICAL(Network, "epoll_wait failed errno={}", errno);
+                return;
+            }
+
+            bool is_ready = false;
+            {
+                std::scoped_lock lk{mutex};
+                for (int i = 0; i < num_events; ++i) {
+                    const int fd = events[i].data.fd;
+                    if (fd == event_fd) {
+                        u64 value;
+                        [[maybe_unused]] const ssize_t ret = read(event_fd, &value, sizeof(value));
+                        continue;
+                    }
+                    // Fired one-shot interests are disarmed until watched again
+                    if (const auto it = interests.find(fd); it != interests.end()) {
+                        it->second = 0;
+                    }
+                    is_ready = true;
+                }
+                const auto now = std::chrono::steady_clock::now();
+                while (!deadlines.empty() && deadlines.top() <= now) {
+                    deadlines.pop();
+                    is_ready = true;
+                }
+            }
+            if (is_ready) {
+                callback();
+            }
+        }
+    }
+
+    static constexpr int MaxEvents = 64;
+
+    const int epoll_fd;
+    const int event_fd;
+    const Callback callback;
+
+    std::mutex mutex;
+    std::unordered_map<int, u32> interests; ///< Armed epoll events of each registered socket
+    std::priority_queue<std::chrono::steady_clock::time_point,
+                        std::vector<std::chrono::steady_clock::time_point>, std::greater<>>
+        deadlines;
+
+    std::jthread thread;
+};
+
+std::unique_ptr<SocketReactor> SocketReactor::Create(Callback callback) {
+    const int epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    if (epoll_fd < 0) {
+        LOG_ERROR(Network, "epoll_create1 failed errno={}", errno);
+        return nullptr;
+    }
+    const int event_fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (event_fd < 0) {
+        LOG_ERROR(Network, "eventfd failed errno={}", errno);
+        close(epoll_fd);
+        return nullptr;
+    }
+    epoll_event event{};
+    event.events = EPOLLIN;
+    event.data.fd = event_fd;
+    if (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, event_fd, &event) != 0) {
+        LOG_ERROR(Network, "Failed to watch reactor eventfd errno={}", errno);
+        close(event_fd);
+        close(epoll_fd);
+        return nullptr;
+    }
+    return std::unique_ptr<SocketReactor>(
+        new SocketReactor(std::make_unique<Impl>(epoll_fd, event_fd, std::move(callback))));
+}
+
+void SocketReactor::Watch(SocketBase::SOCKET fd, PollEvents events) {
+    impl->Watch(fd, events);
+}
+
+void SocketReactor::Forget(SocketBase::SOCKET fd) {
+    impl->Forget(fd);
+}
+
+void SocketReactor::WakeAt(std::chrono::steady_clock::time_point deadline) {
+    impl->WakeAt(deadline);
+}
+
+#else
+
+struct SocketReactor::Impl {};
+
+std::unique_ptr<SocketReactor> SocketReactor::Create(Callback) {
+    // Callers keep blocking on their own threads
+    return nullptr;
+}
+
+void SocketReactor::Watch(SocketBase::SOCKET, PollEvents) {
+    UNREACHABLE();
+}
+
+void SocketReactor::Forget(SocketBase::SOCKET) {
+    UNREACHABLE();
+}
+
+void SocketReactor::WakeAt(std::chrono::steady_clock::time_point) {
+    UNREACHABLE();
+}
+
+#endif
+
+SocketReactor::SocketReactor(std::unique_ptr<Impl> impl_) : impl{std::move(impl_)} {}
+
+SocketReactor::~SocketReactor() = default;
+
+} // namespace Network
@@ -0,0 +1,51 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <memory>
+
+#include "common/common_funcs.h"
+#include "core/internal_network/network.h"
+#include "core/internal_network/sockets.h"
+
+namespace Network {
+
+/**
+ * Persistent readiness notifier for host sockets.
+ * A socket is registered once and its interest is re-armed on each wait, so waiting on a socket
+ * does not rebuild a host poll set. The callback runs on the reactor thread whenever a watched
+ * socket becomes ready or a deadline expires. Each readiness is reported once.
+ */
+class SocketReactor {
+public:
+    using Callback = std::function<void()>;
+
+    /// Creates a reactor, returns nullptr when the host has no supported readiness API
+    [[nodiscard]] static std::unique_ptr<SocketReactor> Create(Callback callback);
+
+    ~SocketReactor();
+
+    YUZU_NON_COPYABLE(SocketReactor);
+    YUZU_NON_MOVEABLE(SocketReactor);
+
+    /// Notifies the callback once the socket is ready for any of the given events
+    void Watch(SocketBase::SOCKET fd, PollEvents events);
+
+    /// Stops watching a socket, must be called before the socket is closed
+    void Forget(SocketBase::SOCKET fd);
+
+    /// Notifies the callback once the deadline is reached
+    void WakeAt(std::chrono::steady_clock::time_point deadline);
+
+private:
+    struct Impl;
+
+    explicit SocketReactor(std::unique_ptr<Impl> impl);
+
+    std::unique_ptr<Impl> impl;
+};
+
+} // namespace Network
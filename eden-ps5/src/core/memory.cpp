@@ -16,6 +16,7 @@
 #include "common/atomic_ops.h"
 #include "common/common_types.h"
 #include "common/heap_tracker.h"
+#include "common/host_mapping_batch.h"
 #include "common/logging/log.h"
 #include "common/page_table.h"
 #include "common/scope_exit.h"
@@ -78,8 +79,13 @@ struct Memory::Impl {
                  Common::PageType::Memory);
 
         if (current_page_table->fastmem_arena) {
-            buffer->Map(GetInteger(base), GetInteger(target) - DramMemoryMap::Base, size, perms,
-                        separate_heap);
+            if (host_batch_depth > 0) {
+                host_batch.Map(GetInteger(base), GetInteger(target) - DramMemoryMap::Base, size,
+                               perms, separate_heap);
+            } else {
+                buffer->Map(GetInteger(base), GetInteger(target) - DramMemoryMap::Base, size,
+                            perms, separate_heap);
+            }
         }
     }
 
@@ -91,7 +97,11 @@ struct Memory::Impl {
                  Common::PageType::Unmapped);
 
         if (current_page_table->fastmem_arena) {
-            buffer->Unmap(GetInteger(base), size, separate_heap);
+            if (host_batch_depth > 0) {
+                host_batch.Unmap(GetInteger(base), size, separate_heap);
+            } else {
+                buffer->Unmap(GetInteger(base), size, separate_heap);
+            }
         }
     }
 
@@ -112,7 +122,7 @@ struct Memory::Impl {
             switch (page_type) {
             case Common::PageType::RasterizerCachedMemory:
                 if (protect_bytes > 0) {
-                    buffer->Protect(protect_begin, protect_bytes, perms);
+                    HostProtect(protect_begin, protect_bytes, perms);
                     protect_bytes = 0;
                 }
                 break;
@@ -125,10 +135,63 @@ struct Memory::Impl {
         }
 
         if (protect_bytes > 0) {
-            buffer->Protect(protect_begin, protect_bytes, perms);
+            HostProtect(protect_begin, protect_bytes, perms);
         }
     }
 
+    void HostProtect(u64 vaddr, u64 size, Common::MemoryPermission perms) {
+        if (host_batch_depth > 0) {
+            host_batch.Protect(vaddr, size, perms);
+        } else {
+            buffer->Protect(vaddr, size, perms);
+        }
+    }
+
+    void BeginHostMappingBatch() {
+        ++host_batch_depth;
+    }
+
+    void EndHostMappingBatch() {
+        ASSERT(host_batch_depth > 0);
+        if (--host_batch_depth > 0 || host_batch.Empty()) {
+            return;
+        }
+        // The rasterizer may have cached pages of a range whose map or protect was still pending,
+        // and applying it resets the host protection of the whole range. Restore it for those.
+        host_batch.Flush(*buffer, [this](u64 vaddr, u64 size) {
+            ProtectRasterizerCachedPages(vaddr, size);
+        });
+    }
+
+    /// Applies the rasterizer protection to every cached page in the range, one call per run.
+    void ProtectRasterizerCachedPages(u64 vaddr, u64 size) {
+        const Common::MemoryPermission perm = RasterizerCachedPermission();
+        u64 run_begin{};
+        u64 run_bytes{};
+        for (u64 addr = vaddr; addr < vaddr + size; addr += YUZU_PAGESIZE) {
+            if (current_page_table->pointers[addr >> YUZU_PAGEBITS].Type() ==
+                Common::PageType::RasterizerCachedMemory) {
+                if (run_bytes == 0) {
+                    run_begin = addr;
+                }
+                run_bytes += YUZU_PAGESIZE;
+            } else if (run_bytes > 0) {
+                buffer->Protect(run_begin, run_bytes, perm);
+                run_bytes = 0;
+            }
+        }
+        if (run_bytes > 0) {
+            buffer->Protect(run_begin, run_bytes, perm);
+        }
+    }
+
+    static Common::MemoryPermission RasterizerCachedPermission() {
+        if (Settings::values.use_reactive_flushing.GetValue()) {
+            return {};
+        }
+        return Common::MemoryPermission::Read;
+    }
+
     [[nodiscard]] u8* GetPointerFromRasterizerCachedMemory(u64 vaddr) const {
         const Common::PhysicalAddress paddr{
             current_page_table->backing_addr[vaddr >> YUZU_PAGEBITS]};
@@ -558,13 +621,8 @@ struct Memory::Impl {
         }
 
         if (current_page_table->fastmem_arena) {
-            Common::MemoryPermission perm{};
-            if (!Settings::values.use_reactive_flushing.GetValue() || !cached) {
-                perm |= Common::MemoryPermission::Read;
-            }
-            if (!cached) {
-                perm |= Common::MemoryPermission::Write;
-            }
+            const Common::MemoryPermission perm =
+                cached ? RasterizerCachedPermission() : Common::MemoryPermission::ReadWrite;
             buffer->Protect(vaddr, size, perm);
         }
 
@@ -1023,6 +1081,9 @@ struct Memory::Impl {
     std::span<Core::GPUDirtyMemoryManager> gpu_dirty_managers;
     std::mutex sys_core_guard;
 
+    Common::HostMappingBatch host_batch;
+    u32 host_batch_depth{};
+
 #ifdef __linux__
     std::optional<Common::HeapTracker> buffer;
 #else
@@ -1060,6 +1121,14 @@ void Memory::ProtectRegion(Common::PageTable& page_table, Common::ProcessAddress
     impl->ProtectRegion(page_table, GetInteger(vaddr), size, perms);
 }
 
+void Memory::BeginHostMappingBatch() {
+    impl->BeginHostMappingBatch();
+}
+
+void Memory::EndHostMappingBatch() {
+    impl->EndHostMappingBatch();
+}
+
 bool Memory::IsValidVirtualAddress(const Common::ProcessAddress vaddr) const {
     const auto& page_table = *impl->current_page_table;
     const size_t page = vaddr >> YUZU_PAGEBITS;
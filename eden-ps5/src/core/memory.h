@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: 2014 Citra Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -113,6 +116,16 @@ public:
     void ProtectRegion(Common::PageTable& page_table, Common::ProcessAddress base, u64 size,
                        Common::MemoryPermission perms);
 
+    /**
+     * Starts deferring host fastmem updates made by MapMemoryRegion, UnmapRegion and
+     * ProtectRegion. Adjacent updates are coalesced and applied by the outermost matching
+     * EndHostMappingBatch call. Calls may nest; the caller must hold the page table lock.
+     */
+    void BeginHostMappingBatch();
+
+    /// Ends a batch started by BeginHostMappingBatch, applying pending updates if outermost.
+    void EndHostMappingBatch();
+
     /**
      * Checks whether or not the supplied address is a valid virtual
      * address for the current process.
@@ -1,6 +1,11 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2019 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <bit>
+
 #include "common/assert.h"
 #include "common/scope_exit.h"
 #include "core/memory/dmnt_cheat_types.h"
@@ -684,6 +689,41 @@ u64 DmntCheatVm::GetVmInt(VmInt value, u32 bit_width) {
     }
 }
 
+u64 DmntCheatVm::MaskToBitWidth(u64 value, u32 bit_width) {
+    switch (bit_width) {
+    case 1:
+        return static_cast<u8>(value);
+    case 2:
+        return static_cast<u16>(value);
+    case 4:
+        return static_cast<u32>(value);
+    case 8:
+        return value;
+    default:
+        // Invalid bit width -> return 0.
+        return 0;
+    }
+}
+
+bool DmntCheatVm::CheckCondition(ConditionalComparisonType cond_type, u64 lhs, u64 rhs) {
+    switch (cond_type) {
+    case ConditionalComparisonType::GT:
+        return lhs > rhs;
+    case ConditionalComparisonType::GE:
+        return lhs >= rhs;
+    case ConditionalComparisonType::LT:
+        return lhs < rhs;
+    case ConditionalComparisonType::LE:
+        return lhs <= rhs;
+    case ConditionalComparisonType::EQ:
+        return lhs == rhs;
+    case ConditionalComparisonType::NE:
+        return lhs != rhs;
+    default:
+        return false;
+    }
+}
+
 u64 DmntCheatVm::GetCheatProcessAddress(const CheatProcessMetadata& metadata,
                                         MemoryAccessType mem_type, u64 rel_address) {
     switch (mem_type) {
@@ -717,6 +757,7 @@ bool DmntCheatVm::LoadProgram(const std::vector<CheatEntry>& entries) {
             // Bounds check.
             if (entries[i].definition.num_opcodes + num_opcodes > MaximumProgramOpcodeCount) {
                 num_opcodes = 0;
+                compiled_program.clear();
                 return false;
             }
 
@@ -726,10 +767,102 @@ bool DmntCheatVm::LoadProgram(const std::vector<CheatEntry>& entries) {
         }
     }
 
+    CompileProgram();
     return true;
 }
 
-void DmntCheatVm::Execute(const CheatProcessMetadata& metadata) {
+void DmntCheatVm::CompileProgram() {
+    compiled_program.clear();
+    addresses_resolved = false;
+
+    // Decode the whole program once, in the same order the interpreter walks it.
+    ResetState();
+    CheatVmOpcode opcode{};
+    while (DecodeNextOpcode(opcode)) {
+        compiled_program.push_back({.opcode = opcode});
+    }
+    ResetState();
+
+    // Resolve where execution resumes when a conditional block or an else branch is skipped.
+    // A failed condition stops at the matching else or end, a skipped else branch only stops at
+    // the matching end. Running off the end of the program terminates execution.
+    const std::size_t count = compiled_program.size();
+    for (std::size_t i = 0; i < count; i++) {
+        auto& compiled = compiled_program[i];
+        const auto* end_cond = std::get_if<EndConditionalOpcode>(&compiled.opcode.opcode);
+        const bool is_else = end_cond != nullptr && end_cond->is_else;
+        if (!compiled.opcode.begin_conditional_block && !is_else) {
+            continue;
+        }
+
+        compiled.skip_target = count;
+        compiled.skip_closes_block = false;
+
+        std::size_t depth = 0;
+        for (std::size_t j = i + 1; j < count; j++) {
+            const auto& next = compiled_program[j].opcode;
+            if (next.begin_conditional_block) {
+                depth++;
+                continue;
+            }
+            const auto* next_end = std::get_if<EndConditionalOpcode>(&next.opcode);
+            if (next_end == nullptr) {
+                continue;
+            }
+            if (!next_end->is_else) {
+                if (depth == 0) {
+                    compiled.skip_target = j + 1;
+                    compiled.skip_closes_block = true;
+                    break;
+                }
+                depth--;
+            } else if (!is_else && depth == 0) {
+                compiled.skip_target = j + 1;
+                break;
+            }
+        }
+    }
+}
+
+void DmntCheatVm::ResolveAddresses(const CheatProcessMetadata& metadata) {
+    const std::array<u64, 4> region_bases{
+        metadata.main_nso_extents.base,
+        metadata.heap_extents.base,
+        metadata.alias_extents.base,
+        metadata.aslr_extents.base,
+    };
+    if (addresses_resolved && region_bases == resolved_region_bases) {
+        return;
+    }
+
+    for (auto& compiled : compiled_program) {
+        const auto& opcode = compiled.opcode.opcode;
+        if (auto store_static = std::get_if<StoreStaticOpcode>(&opcode)) {
+            compiled.resolved_address = GetCheatProcessAddress(metadata, store_static->mem_type,
+                                                               store_static->rel_address);
+        } else if (auto begin_cond = std::get_if<BeginConditionalOpcode>(&opcode)) {
+            compiled.resolved_address =
+                GetCheatProcessAddress(metadata, begin_cond->mem_type, begin_cond->rel_address);
+        } else if (auto ldr_memory = std::get_if<LoadRegisterMemoryOpcode>(&opcode)) {
+            compiled.resolved_address =
+                GetCheatProcessAddress(metadata, ldr_memory->mem_type, ldr_memory->rel_address);
+        } else if (auto str_register = std::get_if<StoreRegisterToAddressOpcode>(&opcode)) {
+            compiled.resolved_address = GetCheatProcessAddress(metadata, str_register->mem_type,
+                                                               str_register->rel_address);
+        } else if (auto begin_reg_cond = std::get_if<BeginRegisterConditionalOpcode>(&opcode)) {
+            compiled.resolved_address = GetCheatProcessAddress(metadata, begin_reg_cond->mem_type,
+                                                               begin_reg_cond->rel_address);
+        } else if (auto debug_log = std::get_if<DebugLogOpcode>(&opcode)) {
+            compiled.resolved_address =
+                GetCheatProcessAddress(metadata, debug_log->mem_type, debug_log->rel_address);
+        }
+    }
+
+    resolved_region_bases = region_bases;
+    addresses_resolved = true;
+}
+
+void DmntCheatVm::ExecuteInterpreted(const CheatProcessMetadata& metadata) {
     CheatVmOpcode cur_opcode{};
 
     // Get Keys down.
@@ -1265,4 +1398,340 @@ void DmntCheatVm::Execute(const CheatProcessMetadata& metadata) {
     }
 }
 
+void DmntCheatVm::Execute(const CheatProcessMetadata& metadata) {
+    // Get Keys down.
+    const u64 kDown = callbacks->HidKeysDown();
+
+    if (callbacks->IsCommandLogEnabled()) {
+        callbacks->CommandLog("Started VM execution.");
+        callbacks->CommandLog(fmt::format("Main NSO:  {:012X}", metadata.main_nso_extents.base));
+        callbacks->CommandLog(fmt::format("Heap:      {:012X}", metadata.main_nso_extents.base));
+        callbacks->CommandLog(
+            fmt::format("Keys Down: {:08X}", static_cast<u32>(kDown & 0x0FFFFFFF)));
+    }
+
+    // Clear VM state.
+    ResetState();
+    ResolveAddresses(metadata);
+
+    const auto ReadMemory = [this](u64 address, void* data, u32 bit_width) {
+        switch (bit_width) {
+        case 1:
+        case 2:
+        case 4:
+        case 8:
+            callbacks->MemoryReadUnsafe(address, data, bit_width);
+            break;
+        }
+    };
+    const auto WriteMemory = [this](u64 address, const void* data, u32 bit_width) {
+        switch (bit_width) {
+        case 1:
+        case 2:
+        case 4:
+        case 8:
+            callbacks->MemoryWriteUnsafe(address, data, bit_width);
+            break;
+        }
+    };
+
+    const std::size_t count = compiled_program.size();
+    std::size_t ip = 0;
+
+    const auto SkipBlock = [&](const CompiledCheatVmOpcode& compiled) {
+        if (condition_depth == 0) {
+            UNREACHABLE_MSG("Invalid condition depth in DMNT Cheat VM");
+        }
+        ip = compiled.skip_target;
+        if (compiled.skip_closes_block) {
+            condition_depth--;
+        }
+    };
+
+    // Loop until program finishes.
+    while (ip < count) {
+        const CompiledCheatVmOpcode& compiled = compiled_program[ip++];
+        const auto& cur_opcode = compiled.opcode;
+
+        // Increment conditional depth, if relevant.
+        if (cur_opcode.begin_conditional_block) {
+            condition_depth++;
+        }
+
+        if (auto store_static = std::get_if<StoreStaticOpcode>(&cur_opcode.opcode)) {
+            const u64 dst_address =
+                compiled.resolved_address + registers[store_static->offset_register];
+            const u64 dst_value = GetVmInt(store_static->value, store_static->bit_width);
+            WriteMemory(dst_address, &dst_value, store_static->bit_width);
+        } else if (auto begin_cond = std::get_if<BeginConditionalOpcode>(&cur_opcode.opcode)) {
+            u64 src_value = 0;
+            ReadMemory(compiled.resolved_address, &src_value, begin_cond->bit_width);
+            const u64 cond_value = GetVmInt(begin_cond->value, begin_cond->bit_width);
+            if (!CheckCondition(begin_cond->cond_type, src_value, cond_value)) {
+                SkipBlock(compiled);
+            }
+        } else if (auto end_cond = std::get_if<EndConditionalOpcode>(&cur_opcode.opcode)) {
+            if (end_cond->is_else) {
+                SkipBlock(compiled);
+            } else if (condition_depth > 0) {
+                condition_depth--;
+            }
+        } else if (auto ctrl_loop = std::get_if<ControlLoopOpcode>(&cur_opcode.opcode)) {
+            if (ctrl_loop->start_loop) {
+                registers[ctrl_loop->reg_index] = ctrl_loop->num_iters;
+                loop_tops[ctrl_loop->reg_index] = ip;
+            } else {
+                registers[ctrl_loop->reg_index]--;
+                if (registers[ctrl_loop->reg_index] != 0) {
+                    ip = loop_tops[ctrl_loop->reg_index];
+                }
+            }
+        } else if (auto ldr_static = std::get_if<LoadRegisterStaticOpcode>(&cur_opcode.opcode)) {
+            registers[ldr_static->reg_index] = ldr_static->value;
+        } else if (auto ldr_memory = std::get_if<LoadRegisterMemoryOpcode>(&cur_opcode.opcode)) {
+            const u64 src_address = ldr_memory->load_from_reg
+                                        ? registers[ldr_memory->reg_index] + ldr_memory->rel_address
+                                        : compiled.resolved_address;
+            ReadMemory(src_address, &registers[ldr_memory->reg_index], ldr_memory->bit_width);
+        } else if (auto str_static = std::get_if<StoreStaticToAddressOpcode>(&cur_opcode.opcode)) {
+            u64 dst_address = registers[str_static->reg_index];
+            const u64 dst_value = str_static->value;
+            if (str_static->add_offset_reg) {
+                dst_address += registers[str_static->offset_reg_index];
+            }
+            WriteMemory(dst_address, &dst_value, str_static->bit_width);
+            if (str_static->increment_reg) {
+                registers[str_static->reg_index] += str_static->bit_width;
+            }
+        } else if (auto perform_math_static =
+                       std::get_if<PerformArithmeticStaticOpcode>(&cur_opcode.opcode)) {
+            u64& reg = registers[perform_math_static->reg_index];
+            const u64 value = static_cast<u64>(perform_math_static->value);
+            switch (perform_math_static->math_type) {
+            case RegisterArithmeticType::Addition:
+                reg += value;
+                break;
+            case RegisterArithmeticType::Subtraction:
+                reg -= value;
+                break;
+            case RegisterArithmeticType::Multiplication:
+                reg *= value;
+                break;
+            case RegisterArithmeticType::LeftShift:
+                reg <<= value;
+                break;
+            case RegisterArithmeticType::RightShift:
+                reg >>= value;
+                break;
+            default:
+                // Do not handle extensions here.
+                break;
+            }
+            // Invalid bit widths leave the result untouched.
+            if (perform_math_static->bit_width <= 8 &&
+                std::has_single_bit(perform_math_static->bit_width)) {
+                reg = MaskToBitWidth(reg, perform_math_static->bit_width);
+            }
+        } else if (auto begin_keypress_cond =
+                       std::get_if<BeginKeypressConditionalOpcode>(&cur_opcode.opcode)) {
+            if ((begin_keypress_cond->key_mask & kDown) != begin_keypress_cond->key_mask) {
+                SkipBlock(compiled);
+            }
+        } else if (auto perform_math_reg =
+                       std::get_if<PerformArithmeticRegisterOpcode>(&cur_opcode.opcode)) {
+            const u64 operand_1_value = registers[perform_math_reg->src_reg_1_index];
+            const u64 operand_2_value =
+                perform_math_reg->has_immediate
+                    ? GetVmInt(perform_math_reg->value, perform_math_reg->bit_width)
+                    : registers[perform_math_reg->src_reg_2_index];
+
+            u64 res_val = 0;
+            switch (perform_math_reg->math_type) {
+            case RegisterArithmeticType::Addition:
+                res_val = operand_1_value + operand_2_value;
+                break;
+            case RegisterArithmeticType::Subtraction:
+                res_val = operand_1_value - operand_2_value;
+                break;
+            case RegisterArithmeticType::Multiplication:
+                res_val = operand_1_value * operand_2_value;
+                break;
+            case RegisterArithmeticType::LeftShift:
+                res_val = operand_1_value << operand_2_value;
+                break;
+            case RegisterArithmeticType::RightShift:
+                res_val = operand_1_value >> operand_2_value;
+                break;
+            case RegisterArithmeticType::LogicalAnd:
+                res_val = operand_1_value & operand_2_value;
+                break;
+            case RegisterArithmeticType::LogicalOr:
+                res_val = operand_1_value | operand_2_value;
+                break;
+            case RegisterArithmeticType::LogicalNot:
+                res_val = ~operand_1_value;
+                break;
+            case RegisterArithmeticType::LogicalXor:
+                res_val = operand_1_value ^ operand_2_value;
+                break;
+            case RegisterArithmeticType::None:
+                res_val = operand_1_value;
+                break;
+            }
+            // Invalid bit widths leave the result untouched.
+            if (perform_math_reg->bit_width <= 8 &&
+                std::has_single_bit(perform_math_reg->bit_width)) {
+                res_val = MaskToBitWidth(res_val, perform_math_reg->bit_width);
+            }
+            registers[perform_math_reg->dst_reg_index] = res_val;
+        } else if (auto str_register =
+                       std::get_if<StoreRegisterToAddressOpcode>(&cur_opcode.opcode)) {
+            const u64 dst_value = registers[str_register->str_reg_index];
+            u64 dst_address = registers[str_register->addr_reg_index];
+            switch (str_register->ofs_type) {
+            case StoreRegisterOffsetType::None:
+                break;
+            case StoreRegisterOffsetType::Reg:
+                dst_address += registers[str_register->ofs_reg_index];
+                break;
+            case StoreRegisterOffsetType::Imm:
+                dst_address += str_register->rel_address;
+                break;
+            case StoreRegisterOffsetType::MemReg:
+                dst_address = GetCheatProcessAddress(metadata, str_register->mem_type,
+                                                     registers[str_register->addr_reg_index]);
+                break;
+            case StoreRegisterOffsetType::MemImm:
+                dst_address = compiled.resolved_address;
+                break;
+            case StoreRegisterOffsetType::MemImmReg:
+                dst_address = compiled.resolved_address + registers[str_register->addr_reg_index];
+                break;
+            }
+            WriteMemory(dst_address, &dst_value, str_register->bit_width);
+            if (str_register->increment_reg) {
+                registers[str_register->addr_reg_index] += str_register->bit_width;
+            }
+        } else if (auto begin_reg_cond =
+                       std::get_if<BeginRegisterConditionalOpcode>(&cur_opcode.opcode)) {
+            const u64 src_value =
+                MaskToBitWidth(registers[begin_reg_cond->val_reg_index], begin_reg_cond->bit_width);
+
+            u64 cond_value = 0;
+            switch (begin_reg_cond->comp_type) {
+            case CompareRegisterValueType::StaticValue:
+                cond_value = GetVmInt(begin_reg_cond->value, begin_reg_cond->bit_width);
+                break;
+            case CompareRegisterValueType::OtherRegister:
+                cond_value = MaskToBitWidth(registers[begin_reg_cond->other_reg_index],
+                                            begin_reg_cond->bit_width);
+                break;
+            case CompareRegisterValueType::MemoryRelAddr:
+                ReadMemory(compiled.resolved_address, &cond_value, begin_reg_cond->bit_width);
+                break;
+            case CompareRegisterValueType::MemoryOfsReg:
+                ReadMemory(GetCheatProcessAddress(metadata, begin_reg_cond->mem_type,
+                                                  registers[begin_reg_cond->ofs_reg_index]),
+                           &cond_value, begin_reg_cond->bit_width);
+                break;
+            case CompareRegisterValueType::RegisterRelAddr:
+                ReadMemory(registers[begin_reg_cond->addr_reg_index] + begin_reg_cond->rel_address,
+                           &cond_value, begin_reg_cond->bit_width);
+                break;
+            case CompareRegisterValueType::RegisterOfsReg:
+                ReadMemory(registers[begin_reg_cond->addr_reg_index] +
+                               registers[begin_reg_cond->ofs_reg_index],
+                           &cond_value, begin_reg_cond->bit_width);
+                break;
+            default:
+                ReadMemory(0, &cond_value, begin_reg_cond->bit_width);
+                break;
+            }
+
+            if (!CheckCondition(begin_reg_cond->cond_type, src_value, cond_value)) {
+                SkipBlock(compiled);
+            }
+        } else if (auto save_restore_reg =
+                       std::get_if<SaveRestoreRegisterOpcode>(&cur_opcode.opcode)) {
+            switch (save_restore_reg->op_type) {
+            case SaveRestoreRegisterOpType::ClearRegs:
+                registers[save_restore_reg->dst_index] = 0ul;
+                break;
+            case SaveRestoreRegisterOpType::ClearSaved:
+                saved_values[save_restore_reg->dst_index] = 0ul;
+                break;
+            case SaveRestoreRegisterOpType::Save:
+                saved_values[save_restore_reg->dst_index] = registers[save_restore_reg->src_index];
+                break;
+            case SaveRestoreRegisterOpType::Restore:
+            default:
+                registers[save_restore_reg->dst_index] = saved_values[save_restore_reg->src_index];
+                break;
+            }
+        } else if (auto save_restore_regmask =
+                       std::get_if<SaveRestoreRegisterMaskOpcode>(&cur_opcode.opcode)) {
+            for (std::size_t i = 0; i < NumRegisters; i++) {
+                if (!save_restore_regmask->should_operate[i]) {
+                    continue;
+                }
+                switch (save_restore_regmask->op_type) {
+                case SaveRestoreRegisterOpType::ClearSaved:
+                    saved_values[i] = 0ul;
+                    break;
+                case SaveRestoreRegisterOpType::ClearRegs:
+                    registers[i] = 0ul;
+                    break;
+                case SaveRestoreRegisterOpType::Save:
+                    saved_values[i] = registers[i];
+                    break;
+                case SaveRestoreRegisterOpType::Restore:
+                default:
+                    registers[i] = saved_values[i];
+                    break;
+                }
+            }
+        } else if (auto rw_static_reg =
+                       std::get_if<ReadWriteStaticRegisterOpcode>(&cur_opcode.opcode)) {
+            if (rw_static_reg->static_idx < NumReadableStaticRegisters) {
+                registers[rw_static_reg->idx] = static_registers[rw_static_reg->static_idx];
+            } else {
+                static_registers[rw_static_reg->static_idx] = registers[rw_static_reg->idx];
+            }
+        } else if (std::holds_alternative<PauseProcessOpcode>(cur_opcode.opcode)) {
+            callbacks->PauseProcess();
+        } else if (std::holds_alternative<ResumeProcessOpcode>(cur_opcode.opcode)) {
+            callbacks->ResumeProcess();
+        } else if (auto debug_log = std::get_if<DebugLogOpcode>(&cur_opcode.opcode)) {
+            u64 log_value = 0;
+            switch (debug_log->val_type) {
+            case DebugLogValueType::RegisterValue:
+                log_value =
+                    MaskToBitWidth(registers[debug_log->val_reg_index], debug_log->bit_width);
+                break;
+            case DebugLogValueType::MemoryRelAddr:
+                ReadMemory(compiled.resolved_address, &log_value, debug_log->bit_width);
+                break;
+            case DebugLogValueType::MemoryOfsReg:
+                ReadMemory(GetCheatProcessAddress(metadata, debug_log->mem_type,
+                                                  registers[debug_log->ofs_reg_index]),
+                           &log_value, debug_log->bit_width);
+                break;
+            case DebugLogValueType::RegisterRelAddr:
+                ReadMemory(registers[debug_log->addr_reg_index] + debug_log->rel_address,
+                           &log_value, debug_log->bit_width);
+                break;
+            case DebugLogValueType::RegisterOfsReg:
+                ReadMemory(registers[debug_log->addr_reg_index] +
+                               registers[debug_log->ofs_reg_index],
+                           &log_value, debug_log->bit_width);
+                break;
+            default:
+                ReadMemory(0, &log_value, debug_log->bit_width);
+                break;
+            }
+            DebugLog(debug_log->log_id, log_value);
+        }
+    }
+}
+
 } // namespace Core::Memory
@@ -1,8 +1,12 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2019 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #pragma once
 
+#include <array>
 #include <variant>
 #include <vector>
 #include <fmt/printf.h>
@@ -259,6 +263,19 @@ struct CheatVmOpcode {
         opcode{};
 };
 
+/// Pre-decoded opcode produced by DmntCheatVm::LoadProgram. Static memory operands and the
+/// targets of conditional skips are resolved ahead of time so that execution never has to
+/// re-decode the raw opcode stream.
+struct CompiledCheatVmOpcode {
+    CheatVmOpcode opcode{};
+    /// Absolute address of the static memory operand (region base + relative address), if any.
+    u64 resolved_address{};
+    /// Index to continue from when this conditional block (or else branch) is skipped.
+    std::size_t skip_target{};
+    /// Whether skipping to skip_target also leaves the enclosing conditional block.
+    bool skip_closes_block{};
+};
+
 class DmntCheatVm {
 public:
     /// Helper Type for DmntCheatVm <=> yuzu Interface
@@ -276,6 +293,7 @@ public:
 
         virtual void DebugLog(u8 id, u64 value) = 0;
         virtual void CommandLog(std::string_view data) = 0;
+        virtual bool IsCommandLogEnabled() const = 0;
     };
 
     static constexpr std::size_t MaximumProgramOpcodeCount = 0x400;
@@ -293,8 +311,14 @@ public:
     }
 
     bool LoadProgram(const std::vector<CheatEntry>& cheats);
+
+    /// Runs the pre-decoded program produced by LoadProgram.
     void Execute(const CheatProcessMetadata& metadata);
 
+    /// Decodes and interprets the raw opcode stream, logging every instruction and the register
+    /// file as it goes. Behaves identically to Execute, but is considerably slower.
+    void ExecuteInterpreted(const CheatProcessMetadata& metadata);
+
 private:
     std::unique_ptr<Callbacks> callbacks;
 
@@ -308,16 +332,25 @@ private:
     std::array<u64, NumStaticRegisters> static_registers{};
     std::array<std::size_t, NumRegisters> loop_tops{};
 
+    std::vector<CompiledCheatVmOpcode> compiled_program;
+    std::array<u64, 4> resolved_region_bases{};
+    bool addresses_resolved = false;
+
     bool DecodeNextOpcode(CheatVmOpcode& out);
     void SkipConditionalBlock(bool is_if);
     void ResetState();
 
+    void CompileProgram();
+    void ResolveAddresses(const CheatProcessMetadata& metadata);
+
     // For implementing the DebugLog opcode.
     void DebugLog(u32 log_id, u64 value);
 
     void LogOpcode(const CheatVmOpcode& opcode);
 
     static u64 GetVmInt(VmInt value, u32 bit_width);
+    static u64 MaskToBitWidth(u64 value, u32 bit_width);
+    static bool CheckCondition(ConditionalComparisonType cond_type, u64 lhs, u64 rhs);
     static u64 GetCheatProcessAddress(const CheatProcessMetadata& metadata,
                                       MemoryAccessType mem_type, u64 rel_address);
 };
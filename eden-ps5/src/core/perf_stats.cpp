@@ -68,6 +68,7 @@ void PerfStats::EndSystemFrame() {
     }
     accumulated_frametime += frame_time;
     system_frames += 1;
+    total_system_frames.fetch_add(1, std::memory_order_relaxed);
 
     previous_frame_length = frame_end - previous_frame_end;
     previous_frame_end = frame_end;
@@ -125,6 +126,16 @@ double PerfStats::GetLastFrameTimeScale() const {
     return duration_cast<DoubleSecs>(previous_frame_length).count() / FRAME_LENGTH;
 }
 
+u64 PerfStats::GetTotalSystemFrames() const {
+    return total_system_frames.load(std::memory_order_relaxed);
+}
+
+std::vector<double> PerfStats::GetFrametimeHistory() const {
+    std::scoped_lock lock{object_mutex};
+
+    return std::vector<double>(perf_history.begin(), perf_history.begin() + current_index);
+}
+
 void SpeedLimiter::DoSpeedLimiting(microseconds current_system_time_us) {
     if (Settings::values.use_multi_core.GetValue() ||
         !Settings::values.use_speed_limit.GetValue()) {
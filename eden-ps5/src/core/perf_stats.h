@@ -8,6 +8,7 @@
 #include <chrono>
 #include <cstddef>
 #include <mutex>
+#include <vector>
 #include "common/common_types.h"
 
 namespace Core {
@@ -51,6 +52,12 @@ public:
      */
     double GetLastFrameTimeScale() const;
 
+    /// Returns the number of system frames presented since the title started.
+    u64 GetTotalSystemFrames() const;
+
+    /// Returns the recorded frametimes of the system frames, in milliseconds.
+    std::vector<double> GetFrametimeHistory() const;
+
 private:
     mutable std::mutex object_mutex;
 
@@ -73,6 +80,8 @@ private:
     u32 system_frames = 0;
     /// Cumulative number of game frames (GSP frame submissions) since last reset
     std::atomic<u32> game_frames = 0;
+    /// Number of system frames presented since the title started, never reset
+    std::atomic<u64> total_system_frames = 0;
 
     /// Point when the previous system frame ended
     Clock::time_point previous_frame_end = reset_point;
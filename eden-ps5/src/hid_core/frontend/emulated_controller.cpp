@@ -574,14 +574,19 @@ void EmulatedController::UnloadInput() {
 }
 
 void EmulatedController::EnableConfiguration() {
-    std::scoped_lock lock{connect_mutex, npad_mutex};
+    std::scoped_lock lock{connect_mutex, npad_mutex, mutex};
     is_configuring = true;
     tmp_is_connected = is_connected;
     tmp_npad_type = npad_type;
+    PublishPadState();
 }
 
 void EmulatedController::DisableConfiguration() {
-    is_configuring = false;
+    {
+        std::scoped_lock lock{mutex};
+        is_configuring = false;
+        PublishPadState();
+    }
 
     // Get Joycon colors before turning on the controller
     for (const auto& color_device : color_devices) {
@@ -620,12 +625,14 @@ void EmulatedController::DisableSystemButtons() {
     system_buttons_enabled = false;
     controller.home_button_state.raw = 0;
     controller.capture_button_state.raw = 0;
+    PublishPadState();
 }
 
 void EmulatedController::ResetSystemButtons() {
     std::scoped_lock lock{mutex};
     controller.home_button_state.home.Assign(false);
     controller.capture_button_state.capture.Assign(false);
+    PublishPadState();
 }
 
 bool EmulatedController::IsConfiguring() const {
@@ -780,6 +787,7 @@ void EmulatedController::SetButton(const Common::Input::CallbackStatus& callback
         }
     }
 
+    const bool turbo_changed = current_status.turbo != new_status.turbo;
     current_status.toggle = new_status.toggle;
     current_status.turbo = new_status.turbo;
     current_status.uuid = uuid;
@@ -806,6 +814,9 @@ void EmulatedController::SetButton(const Common::Input::CallbackStatus& callback
     }
 
     if (!value_changed) {
+        if (turbo_changed) {
+            PublishPadState();
+        }
         return;
     }
 
@@ -814,6 +825,7 @@ void EmulatedController::SetButton(const Common::Input::CallbackStatus& callback
         controller.debug_pad_button_state.raw = 0;
         controller.home_button_state.raw = 0;
         controller.capture_button_state.raw = 0;
+        PublishPadState();
         lock.unlock();
         TriggerOnChange(ControllerTriggerType::Button, false);
         return;
@@ -821,10 +833,10 @@ void EmulatedController::SetButton(const Common::Input::CallbackStatus& callback
 
     // GC controllers have triggers not buttons
     if (npad_type == NpadStyleIndex::GameCube) {
-        if (index == Settings::NativeButton::ZR) {
-            return;
-        }
-        if (index == Settings::NativeButton::ZL) {
+        if (index == Settings::NativeButton::ZR || index == Settings::NativeButton::ZL) {
+            if (turbo_changed) {
+                PublishPadState();
+            }
             return;
         }
     }
@@ -918,6 +930,7 @@ void EmulatedController::SetButton(const Common::Input::CallbackStatus& callback
         break;
     }
 
+    PublishPadState();
     lock.unlock();
 
     if (player.connected) {
@@ -957,6 +970,7 @@ void EmulatedController::SetStick(const Common::Input::CallbackStatus& callback,
     if (is_configuring) {
         controller.analog_stick_state.left = {};
         controller.analog_stick_state.right = {};
+        PublishPadState();
         return;
     }
 
@@ -981,6 +995,7 @@ void EmulatedController::SetStick(const Common::Input::CallbackStatus& callback,
         controller.npad_button_state.stick_r_down.Assign(controller.stick_values[index].down);
         break;
     }
+    PublishPadState();
 }
 
 void EmulatedController::SetTrigger(const Common::Input::CallbackStatus& callback,
@@ -1007,6 +1022,7 @@ void EmulatedController::SetTrigger(const Common::Input::CallbackStatus& callbac
     if (is_configuring) {
         controller.gc_trigger_state.left = 0;
         controller.gc_trigger_state.right = 0;
+        PublishPadState();
         return;
     }
 
@@ -1029,6 +1045,7 @@ void EmulatedController::SetTrigger(const Common::Input::CallbackStatus& callbac
         controller.npad_button_state.zr.Assign(trigger.pressed.value);
         break;
     }
+    PublishPadState();
 }
 
 void EmulatedController::SetMotion(const Common::Input::CallbackStatus& callback,
@@ -1855,53 +1872,51 @@ RingAnalogValue EmulatedController::GetRingSensorValues() const {
 }
 
 HomeButtonState EmulatedController::GetHomeButtons() const {
-    std::scoped_lock lock{mutex};
-    if (is_configuring) {
+    const auto state = pad_state.Read();
+    if (state.is_configuring) {
         return {};
     }
-    return controller.home_button_state;
+    return state.home_button_state;
 }
 
 CaptureButtonState EmulatedController::GetCaptureButtons() const {
-    std::scoped_lock lock{mutex};
-    if (is_configuring) {
+    const auto state = pad_state.Read();
+    if (state.is_configuring) {
         return {};
     }
-    return controller.capture_button_state;
+    return state.capture_button_state;
 }
 
 NpadButtonState EmulatedController::GetNpadButtons() const {
-    std::scoped_lock lock{mutex};
-    if (is_configuring) {
+    const auto state = pad_state.Read();
+    if (state.is_configuring) {
         return {};
     }
-    return {controller.npad_button_state.raw & GetTurboButtonMask()};
+    return {state.npad_button_state.raw & GetTurboButtonMask(state)};
 }
 
 DebugPadButton EmulatedController::GetDebugPadButtons() const {
-    std::scoped_lock lock{mutex};
-    if (is_configuring) {
+    const auto state = pad_state.Read();
+    if (state.is_configuring) {
         return {};
     }
-    return controller.debug_pad_button_state;
+    return state.debug_pad_button_state;
 }
 
 AnalogSticks EmulatedController::GetSticks() const {
-    std::scoped_lock lock{mutex};
-
-    if (is_configuring) {
+    const auto state = pad_state.Read();
+    if (state.is_configuring) {
         return {};
     }
-
-    return controller.analog_stick_state;
+    return state.analog_stick_state;
 }
 
 NpadGcTriggerState EmulatedController::GetTriggers() const {
-    std::scoped_lock lock{mutex};
-    if (is_configuring) {
+    const auto state = pad_state.Read();
+    if (state.is_configuring) {
         return {};
     }
-    return controller.gc_trigger_state;
+    return state.gc_trigger_state;
 }
 
 MotionState EmulatedController::GetMotions() const {
@@ -1988,13 +2003,8 @@ void EmulatedController::StatusUpdate() {
     }
 }
 
-NpadButton EmulatedController::GetTurboButtonMask() const {
-    // Apply no mask when disabled
-    if (turbo_button_state < TURBO_BUTTON_DELAY) {
-        return {NpadButton::All};
-    }
-
-    NpadButtonState button_mask{};
+void EmulatedController::PublishPadState() {
+    NpadButtonState turbo_buttons{};
     for (std::size_t index = 0; index < controller.button_values.size(); ++index) {
         if (!controller.button_values[index].turbo) {
             continue;
@@ -2002,59 +2012,76 @@ NpadButton EmulatedController::GetTurboButtonMask() const {
 
         switch (index) {
         case Settings::NativeButton::A:
-            button_mask.a.Assign(1);
+            turbo_buttons.a.Assign(1);
             break;
         case Settings::NativeButton::B:
-            button_mask.b.Assign(1);
+            turbo_buttons.b.Assign(1);
             break;
         case Settings::NativeButton::X:
-            button_mask.x.Assign(1);
+            turbo_buttons.x.Assign(1);
             break;
         case Settings::NativeButton::Y:
-            button_mask.y.Assign(1);
+            turbo_buttons.y.Assign(1);
             break;
         case Settings::NativeButton::L:
-            button_mask.l.Assign(1);
+            turbo_buttons.l.Assign(1);
             break;
         case Settings::NativeButton::R:
-            button_mask.r.Assign(1);
+            turbo_buttons.r.Assign(1);
             break;
         case Settings::NativeButton::ZL:
-            button_mask.zl.Assign(1);
+            turbo_buttons.zl.Assign(1);
             break;
         case Settings::NativeButton::ZR:
-            button_mask.zr.Assign(1);
+            turbo_buttons.zr.Assign(1);
             break;
         case Settings::NativeButton::DLeft:
-            button_mask.left.Assign(1);
+            turbo_buttons.left.Assign(1);
             break;
         case Settings::NativeButton::DUp:
-            button_mask.up.Assign(1);
+            turbo_buttons.up.Assign(1);
             break;
         case Settings::NativeButton::DRight:
-            button_mask.right.Assign(1);
+            turbo_buttons.right.Assign(1);
             break;
         case Settings::NativeButton::DDown:
-            button_mask.down.Assign(1);
+            turbo_buttons.down.Assign(1);
             break;
         case Settings::NativeButton::SLLeft:
-            button_mask.left_sl.Assign(1);
+            turbo_buttons.left_sl.Assign(1);
             break;
         case Settings::NativeButton::SLRight:
-            button_mask.right_sl.Assign(1);
+            turbo_buttons.right_sl.Assign(1);
             break;
         case Settings::NativeButton::SRLeft:
-            button_mask.left_sr.Assign(1);
+            turbo_buttons.left_sr.Assign(1);
             break;
         case Settings::NativeButton::SRRight:
-            button_mask.right_sr.Assign(1);
+            turbo_buttons.right_sr.Assign(1);
             break;
         default:
             break;
         }
     }
 
-    return static_cast<NpadButton>(~button_mask.raw);
+    pad_state.Write({
+        .npad_button_state = controller.npad_button_state,
+        .debug_pad_button_state = controller.debug_pad_button_state,
+        .analog_stick_state = controller.analog_stick_state,
+        .gc_trigger_state = controller.gc_trigger_state,
+        .home_button_state = controller.home_button_state,
+        .capture_button_state = controller.capture_button_state,
+        .turbo_buttons = turbo_buttons.raw,
+        .is_configuring = is_configuring,
+    });
+}
+
+NpadButton EmulatedController::GetTurboButtonMask(const ControllerPadState& state) const {
+    // Apply no mask when disabled
+    if (turbo_button_state < TURBO_BUTTON_DELAY) {
+        return {NpadButton::All};
+    }
+    return static_cast<NpadButton>(~static_cast<u64>(state.turbo_buttons));
 }
 
 } // namespace Core::HID
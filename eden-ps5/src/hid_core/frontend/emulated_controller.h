@@ -13,6 +13,7 @@
 #include "common/common_types.h"
 #include "common/input.h"
 #include "common/param_package.h"
+#include "common/seqlock.h"
 #include "common/settings.h"
 #include "common/vector_math.h"
 #include "hid_core/frontend/motion_input.h"
@@ -147,6 +148,18 @@ struct ControllerStatus {
     Common::Input::PollingMode right_polling_mode{};
 };
 
+// Pad state read by HID services on every update, published without holding the controller mutex
+struct ControllerPadState {
+    NpadButtonState npad_button_state{};
+    DebugPadButton debug_pad_button_state{};
+    AnalogSticks analog_stick_state{};
+    NpadGcTriggerState gc_trigger_state{};
+    HomeButtonState home_button_state{};
+    CaptureButtonState capture_button_state{};
+    NpadButton turbo_buttons{};
+    bool is_configuring{};
+};
+
 enum class ControllerTriggerType {
     Button,
     Stick,
@@ -568,7 +581,10 @@ private:
      */
     void TriggerOnChange(ControllerTriggerType type, bool is_service_update);
 
-    NpadButton GetTurboButtonMask() const;
+    /// Publishes the pad state to lock-free readers, must be called with the mutex held
+    void PublishPadState();
+
+    NpadButton GetTurboButtonMask(const ControllerPadState& pad_state) const;
 
     const NpadIdType npad_id_type;
     NpadStyleIndex npad_type{NpadStyleIndex::None};
@@ -635,6 +651,9 @@ private:
 
     // Stores the current status of all controller input
     ControllerStatus controller;
+
+    // Copy of the pad state of the controller status for HID services
+    Common::SeqLock<ControllerPadState> pad_state;
 };
 
 } // namespace Core::HID
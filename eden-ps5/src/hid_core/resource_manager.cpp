@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 #include "common/logging/log.h"
+#include "common/subsystem_profiler.h"
 #include "core/core.h"
 #include "core/core_timing.h"
 #include "core/hle/service/ipc_helpers.h"
@@ -268,6 +269,7 @@ void ResourceManager::InitializeTouchScreenSampler() {
         "HID::TouchUpdateCallback",
         [this](s64 time,
                std::chrono::nanoseconds ns_late) -> std::optional<std::chrono::nanoseconds> {
+            const Common::ScopedSubsystemTimer timer{Common::Subsystem::Hid};
             touch_resource->OnTouchUpdate(time);
             return std::nullopt;
         });
@@ -471,6 +473,7 @@ Result ResourceManager::GetTouchScreenFirmwareVersion(Core::HID::FirmwareVersion
 }
 
 void ResourceManager::UpdateControllers(std::chrono::nanoseconds ns_late) {
+    const Common::ScopedSubsystemTimer timer{Common::Subsystem::Hid};
     auto& core_timing = system.CoreTiming();
     debug_pad->OnUpdate(core_timing);
     digitizer->OnUpdate(core_timing);
@@ -482,11 +485,13 @@ void ResourceManager::UpdateControllers(std::chrono::nanoseconds ns_late) {
 }
 
 void ResourceManager::UpdateNpad(std::chrono::nanoseconds ns_late) {
+    const Common::ScopedSubsystemTimer timer{Common::Subsystem::Hid};
     auto& core_timing = system.CoreTiming();
     npad->OnUpdate(core_timing);
 }
 
 void ResourceManager::UpdateMouseKeyboard(std::chrono::nanoseconds ns_late) {
+    const Common::ScopedSubsystemTimer timer{Common::Subsystem::Hid};
     auto& core_timing = system.CoreTiming();
     mouse->OnUpdate(core_timing);
     debug_mouse->OnUpdate(core_timing);
@@ -494,6 +499,7 @@ void ResourceManager::UpdateMouseKeyboard(std::chrono::nanoseconds ns_late) {
 }
 
 void ResourceManager::UpdateMotion(std::chrono::nanoseconds ns_late) {
+    const Common::ScopedSubsystemTimer timer{Common::Subsystem::Hid};
     auto& core_timing = system.CoreTiming();
     six_axis->OnUpdate(core_timing);
     seven_six_axis->OnUpdate(core_timing);
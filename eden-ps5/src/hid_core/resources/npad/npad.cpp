@@ -25,6 +25,17 @@
 
 namespace Service::HID {
 
+namespace {
+// The npad update event runs every 1ms while the hardware samples pads every 4ms
+constexpr u32 UpdatesPerSample = 4;
+
+bool IsSameInput(const NPadGenericState& lhs, const NPadGenericState& rhs) {
+    return lhs.npad_buttons.raw == rhs.npad_buttons.raw && lhs.l_stick.x == rhs.l_stick.x &&
+           lhs.l_stick.y == rhs.l_stick.y && lhs.r_stick.x == rhs.r_stick.x &&
+           lhs.r_stick.y == rhs.r_stick.y;
+}
+} // Anonymous namespace
+
 NPad::NPad(Core::HID::HIDCore& hid_core_, KernelHelpers::ServiceContext& service_context_)
     : hid_core{hid_core_}, service_context{service_context_}, npad_resource{service_context} {
     for (std::size_t aruid_index = 0; aruid_index < AruidIndexMax; ++aruid_index) {
@@ -169,6 +180,7 @@ void NPad::ControllerUpdate(Core::HID::ControllerTriggerType type, std::size_t c
 
 void NPad::InitNewlyAddedController(u64 aruid, Core::HID::NpadIdType npad_id) {
     auto& controller = GetControllerFromNpadIdType(aruid, npad_id);
+    controller.force_write = true;
     if (!npad_resource.IsControllerSupported(aruid, controller.device->GetNpadStyleIndex())) {
         return;
     }
@@ -481,9 +493,11 @@ void NPad::OnUpdate(const Core::Timing::CoreTiming& core_timing) {
 
         for (std::size_t i = 0; i < controller_data[aruid_index].size(); ++i) {
             auto& controller = controller_data[aruid_index][i];
-            controller.shared_memory =
-                &data->shared_memory_format->npad.npad_entry[i].internal_state;
-            auto* npad = controller.shared_memory;
+            auto* npad = &data->shared_memory_format->npad.npad_entry[i].internal_state;
+            if (controller.shared_memory != npad) {
+                controller.shared_memory = npad;
+                controller.force_write = true;
+            }
 
             const auto& controller_type = controller.device->GetNpadStyleIndex();
 
@@ -505,6 +519,23 @@ void NPad::OnUpdate(const Core::Timing::CoreTiming& core_timing) {
             auto& libnx_state = controller.npad_libnx_state;
             auto& trigger_state = controller.npad_trigger_state;
 
+            // Unchanged input is only sampled at the hardware rate, new input is written as soon
+            // as it arrives
+            const bool is_input_changed =
+                controller.force_write || controller.written_style != controller_type ||
+                !IsSameInput(controller.written_pad_state, pad_state) ||
+                controller.written_trigger_state.l_analog != trigger_state.l_analog ||
+                controller.written_trigger_state.r_analog != trigger_state.r_analog;
+            if (!is_input_changed && ++controller.updates_since_write < UpdatesPerSample) {
+                press_state |= static_cast<u64>(pad_state.npad_buttons.raw);
+                continue;
+            }
+            controller.written_style = controller_type;
+            controller.written_pad_state = pad_state;
+            controller.written_trigger_state = trigger_state;
+            controller.updates_since_write = 0;
+            controller.force_write = false;
+
             // LibNX exclusively uses this section, so we always update it since LibNX doesn't
             // activate any controllers.
             libnx_state.connection_status.raw = 0;
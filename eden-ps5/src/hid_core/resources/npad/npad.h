@@ -178,6 +178,13 @@ private:
         NPadGenericState npad_libnx_state{};
         NpadGcTriggerState npad_trigger_state{};
         int callback_key{};
+
+        // Input of the last entry written to the lifos
+        Core::HID::NpadStyleIndex written_style{};
+        NPadGenericState written_pad_state{};
+        NpadGcTriggerState written_trigger_state{};
+        u32 updates_since_write{};
+        bool force_write{true};
     };
 
     void ControllerUpdate(Core::HID::ControllerTriggerType type, std::size_t controller_idx);
@@ -262,6 +262,9 @@ void UDPClient::OnPadData(Response::PadData data, std::size_t client) {
         .delta_timestamp = time_difference,
     };
     const PadIdentifier identifier = GetPadIdentifier(pad_index);
+
+    // A packet updates every input of the pad, notify pollers once it is fully applied
+    BeginUpdateBatch();
     SetMotion(identifier, 0, motion);
 
     for (std::size_t id = 0; id < data.touch.size(); ++id) {
@@ -323,6 +326,7 @@ void UDPClient::OnPadData(Response::PadData data, std::size_t client) {
     SetButton(identifier, static_cast<int>(PadButton::TouchHardPress), data.touch_hard_press != 0);
 
     SetBattery(identifier, GetBatteryLevel(data.info.battery));
+    EndUpdateBatch();
 }
 
 void UDPClient::StartCommunication(std::size_t client, const std::string& host, u16 port) {
@@ -3,11 +3,42 @@
 // SPDX-FileCopyrightText: Copyright 2021 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+
 #include "common/logging/log.h"
 #include "input_common/input_engine.h"
 
 namespace InputCommon {
 
+namespace {
+template <typename T>
+void StoreSlot(std::atomic<T>& slot, T value) {
+    slot.store(value, std::memory_order_relaxed);
+}
+
+void StoreSlot(Common::SeqLock<BasicMotion>& slot, const BasicMotion& value) {
+    slot.Write(value);
+}
+} // Anonymous namespace
+
+template <typename Slot, typename T>
+void InputEngine::StoreValue(const PadIdentifier& identifier,
+                             std::unordered_map<int, Slot> ControllerData::*slots, int index,
+                             const T& value) {
+    {
+        std::shared_lock lock{mutex};
+        auto& controller_slots = controller_list.at(identifier).*slots;
+        if (const auto it = controller_slots.find(index); it != controller_slots.end()) {
+            StoreSlot(it->second, value);
+            return;
+        }
+    }
+    // First value of this input
+    std::scoped_lock lock{mutex};
+    auto& controller_slots = controller_list.at(identifier).*slots;
+    StoreSlot(controller_slots.try_emplace(index).first->second, value);
+}
+
 void InputEngine::PreSetController(const PadIdentifier& identifier) {
     std::scoped_lock lock{mutex};
     controller_list.try_emplace(identifier);
@@ -38,34 +69,22 @@ void InputEngine::PreSetMotion(const PadIdentifier& identifier, int motion) {
 }
 
 void InputEngine::SetButton(const PadIdentifier& identifier, int button, bool value) {
-    {
-        std::scoped_lock lock{mutex};
-        ControllerData& controller = controller_list.at(identifier);
-        if (!configuring) {
-            controller.buttons.insert_or_assign(button, value);
-        }
+    if (!configuring) {
+        StoreValue(identifier, &ControllerData::buttons, button, value);
     }
     TriggerOnButtonChange(identifier, button, value);
 }
 
 void InputEngine::SetHatButton(const PadIdentifier& identifier, int button, u8 value) {
-    {
-        std::scoped_lock lock{mutex};
-        ControllerData& controller = controller_list.at(identifier);
-        if (!configuring) {
-            controller.hat_buttons.insert_or_assign(button, value);
-        }
+    if (!configuring) {
+        StoreValue(identifier, &ControllerData::hat_buttons, button, value);
     }
     TriggerOnHatButtonChange(identifier, button, value);
 }
 
 void InputEngine::SetAxis(const PadIdentifier& identifier, int axis, f32 value) {
-    {
-        std::scoped_lock lock{mutex};
-        ControllerData& controller = controller_list.at(identifier);
-        if (!configuring) {
-            controller.axes.insert_or_assign(axis, value);
-        }
+    if (!configuring) {
+        StoreValue(identifier, &ControllerData::axes, axis, value);
     }
     TriggerOnAxisChange(identifier, axis, value);
 }
@@ -93,12 +112,8 @@ void InputEngine::SetColor(const PadIdentifier& identifier, Common::Input::BodyC
 }
 
 void InputEngine::SetMotion(const PadIdentifier& identifier, int motion, const BasicMotion& value) {
-    {
-        std::scoped_lock lock{mutex};
-        ControllerData& controller = controller_list.at(identifier);
-        if (!configuring) {
-            controller.motions.insert_or_assign(motion, value);
-        }
+    if (!configuring) {
+        StoreValue(identifier, &ControllerData::motions, motion, value);
     }
     TriggerOnMotionChange(identifier, motion, value);
 }
@@ -127,7 +142,7 @@ void InputEngine::SetNfc(const PadIdentifier& identifier, const Common::Input::N
 }
 
 bool InputEngine::GetButton(const PadIdentifier& identifier, int button) const {
-    std::scoped_lock lock{mutex};
+    std::shared_lock lock{mutex};
     const auto controller_iter = controller_list.find(identifier);
     if (controller_iter == controller_list.cend()) {
         LOG_ERROR(Input, "Invalid identifier guid={}, pad={}, port={}", identifier.guid.RawString(),
@@ -140,11 +155,11 @@ bool InputEngine::GetButton(const PadIdentifier& identifier, int button) const {
         LOG_ERROR(Input, "Invalid button {}", button);
         return false;
     }
-    return button_iter->second;
+    return button_iter->second.load(std::memory_order_relaxed);
 }
 
 bool InputEngine::GetHatButton(const PadIdentifier& identifier, int button, u8 direction) const {
-    std::scoped_lock lock{mutex};
+    std::shared_lock lock{mutex};
     const auto controller_iter = controller_list.find(identifier);
     if (controller_iter == controller_list.cend()) {
         LOG_ERROR(Input, "Invalid identifier guid={}, pad={}, port={}", identifier.guid.RawString(),
@@ -157,11 +172,11 @@ bool InputEngine::GetHatButton(const PadIdentifier& identifier, int button, u8 d
         LOG_ERROR(Input, "Invalid hat button {}", button);
         return false;
     }
-    return (hat_iter->second & direction) != 0;
+    return (hat_iter->second.load(std::memory_order_relaxed) & direction) != 0;
 }
 
 f32 InputEngine::GetAxis(const PadIdentifier& identifier, int axis) const {
-    std::scoped_lock lock{mutex};
+    std::shared_lock lock{mutex};
     const auto controller_iter = controller_list.find(identifier);
     if (controller_iter == controller_list.cend()) {
         LOG_ERROR(Input, "Invalid identifier guid={}, pad={}, port={}", identifier.guid.RawString(),
@@ -174,11 +189,11 @@ f32 InputEngine::GetAxis(const PadIdentifier& identifier, int axis) const {
         LOG_ERROR(Input, "Invalid axis {}", axis);
         return 0.0f;
     }
-    return axis_iter->second;
+    return axis_iter->second.load(std::memory_order_relaxed);
 }
 
 Common::Input::BatteryLevel InputEngine::GetBattery(const PadIdentifier& identifier) const {
-    std::scoped_lock lock{mutex};
+    std::shared_lock lock{mutex};
     const auto controller_iter = controller_list.find(identifier);
     if (controller_iter == controller_list.cend()) {
         LOG_ERROR(Input, "Invalid identifier guid={}, pad={}, port={}", identifier.guid.RawString(),
@@ -190,7 +205,7 @@ Common::Input::BatteryLevel InputEngine::GetBattery(const PadIdentifier& identif
 }
 
 Common::Input::BodyColorStatus InputEngine::GetColor(const PadIdentifier& identifier) const {
-    std::scoped_lock lock{mutex};
+    std::shared_lock lock{mutex};
     const auto controller_iter = controller_list.find(identifier);
     if (controller_iter == controller_list.cend()) {
         LOG_ERROR(Input, "Invalid identifier guid={}, pad={}, port={}", identifier.guid.RawString(),
@@ -202,7 +217,7 @@ Common::Input::BodyColorStatus InputEngine::GetColor(const PadIdentifier& identi
 }
 
 BasicMotion InputEngine::GetMotion(const PadIdentifier& identifier, int motion) const {
-    std::scoped_lock lock{mutex};
+    std::shared_lock lock{mutex};
     const auto controller_iter = controller_list.find(identifier);
     if (controller_iter == controller_list.cend()) {
         LOG_ERROR(Input, "Invalid identifier guid={}, pad={}, port={}", identifier.guid.RawString(),
@@ -210,11 +225,11 @@ BasicMotion InputEngine::GetMotion(const PadIdentifier& identifier, int motion)
         return {};
     }
     const ControllerData& controller = controller_iter->second;
-    return controller.motions.at(motion);
+    return controller.motions.at(motion).Read();
 }
 
 Common::Input::CameraStatus InputEngine::GetCamera(const PadIdentifier& identifier) const {
-    std::scoped_lock lock{mutex};
+    std::shared_lock lock{mutex};
     const auto controller_iter = controller_list.find(identifier);
     if (controller_iter == controller_list.cend()) {
         LOG_ERROR(Input, "Invalid identifier guid={}, pad={}, port={}", identifier.guid.RawString(),
@@ -226,7 +241,7 @@ Common::Input::CameraStatus InputEngine::GetCamera(const PadIdentifier& identifi
 }
 
 Common::Input::NfcStatus InputEngine::GetNfc(const PadIdentifier& identifier) const {
-    std::scoped_lock lock{mutex};
+    std::shared_lock lock{mutex};
     const auto controller_iter = controller_list.find(identifier);
     if (controller_iter == controller_list.cend()) {
         LOG_ERROR(Input, "Invalid identifier guid={}, pad={}, port={}", identifier.guid.RawString(),
@@ -238,35 +253,45 @@ Common::Input::NfcStatus InputEngine::GetNfc(const PadIdentifier& identifier) co
 }
 
 void InputEngine::ResetButtonState() {
-    for (const auto& controller : controller_list) {
-        for (const auto& button : controller.second.buttons) {
-            SetButton(controller.first, button.first, false);
-        }
-        for (const auto& button : controller.second.hat_buttons) {
-            SetHatButton(controller.first, button.first, 0);
+    std::vector<std::pair<PadIdentifier, int>> buttons;
+    std::vector<std::pair<PadIdentifier, int>> hat_buttons;
+    {
+        std::shared_lock lock{mutex};
+        for (const auto& controller : controller_list) {
+            for (const auto& button : controller.second.buttons) {
+                buttons.emplace_back(controller.first, button.first);
+            }
+            for (const auto& button : controller.second.hat_buttons) {
+                hat_buttons.emplace_back(controller.first, button.first);
+            }
         }
     }
+    for (const auto& [identifier, button] : buttons) {
+        SetButton(identifier, button, false);
+    }
+    for (const auto& [identifier, button] : hat_buttons) {
+        SetHatButton(identifier, button, 0);
+    }
 }
 
 void InputEngine::ResetAnalogState() {
-    for (const auto& controller : controller_list) {
-        for (const auto& axis : controller.second.axes) {
-            SetAxis(controller.first, axis.first, 0.0f);
+    std::vector<std::pair<PadIdentifier, int>> axes;
+    {
+        std::shared_lock lock{mutex};
+        for (const auto& controller : controller_list) {
+            for (const auto& axis : controller.second.axes) {
+                axes.emplace_back(controller.first, axis.first);
+            }
         }
     }
+    for (const auto& [identifier, axis] : axes) {
+        SetAxis(identifier, axis, 0.0f);
+    }
 }
 
 void InputEngine::TriggerOnButtonChange(const PadIdentifier& identifier, int button, bool value) {
     std::scoped_lock lock{mutex_callback};
-    for (const auto& poller_pair : callback_list) {
-        const InputIdentifier& poller = poller_pair.second;
-        if (!IsInputIdentifierEqual(poller, identifier, EngineInputType::Button, button)) {
-            continue;
-        }
-        if (poller.callback.on_change) {
-            poller.callback.on_change();
-        }
-    }
+    NotifyCallbacks(identifier, EngineInputType::Button, button);
     if (!configuring || !mapping_callback.on_data) {
         return;
     }
@@ -286,15 +311,7 @@ void InputEngine::TriggerOnButtonChange(const PadIdentifier& identifier, int but
 
 void InputEngine::TriggerOnHatButtonChange(const PadIdentifier& identifier, int button, u8 value) {
     std::scoped_lock lock{mutex_callback};
-    for (const auto& poller_pair : callback_list) {
-        const InputIdentifier& poller = poller_pair.second;
-        if (!IsInputIdentifierEqual(poller, identifier, EngineInputType::HatButton, button)) {
-            continue;
-        }
-        if (poller.callback.on_change) {
-            poller.callback.on_change();
-        }
-    }
+    NotifyCallbacks(identifier, EngineInputType::HatButton, button);
     if (!configuring || !mapping_callback.on_data) {
         return;
     }
@@ -315,15 +332,7 @@ void InputEngine::TriggerOnHatButtonChange(const PadIdentifier& identifier, int
 
 void InputEngine::TriggerOnAxisChange(const PadIdentifier& identifier, int axis, f32 value) {
     std::scoped_lock lock{mutex_callback};
-    for (const auto& poller_pair : callback_list) {
-        const InputIdentifier& poller = poller_pair.second;
-        if (!IsInputIdentifierEqual(poller, identifier, EngineInputType::Analog, axis)) {
-            continue;
-        }
-        if (poller.callback.on_change) {
-            poller.callback.on_change();
-        }
-    }
+    NotifyCallbacks(identifier, EngineInputType::Analog, axis);
     if (!configuring || !mapping_callback.on_data) {
         return;
     }
@@ -342,43 +351,19 @@ void InputEngine::TriggerOnAxisChange(const PadIdentifier& identifier, int axis,
 void InputEngine::TriggerOnBatteryChange(const PadIdentifier& identifier,
                                          [[maybe_unused]] Common::Input::BatteryLevel value) {
     std::scoped_lock lock{mutex_callback};
-    for (const auto& poller_pair : callback_list) {
-        const InputIdentifier& poller = poller_pair.second;
-        if (!IsInputIdentifierEqual(poller, identifier, EngineInputType::Battery, 0)) {
-            continue;
-        }
-        if (poller.callback.on_change) {
-            poller.callback.on_change();
-        }
-    }
+    NotifyCallbacks(identifier, EngineInputType::Battery, 0);
 }
 
 void InputEngine::TriggerOnColorChange(const PadIdentifier& identifier,
                                        [[maybe_unused]] Common::Input::BodyColorStatus value) {
     std::scoped_lock lock{mutex_callback};
-    for (const auto& poller_pair : callback_list) {
-        const InputIdentifier& poller = poller_pair.second;
-        if (!IsInputIdentifierEqual(poller, identifier, EngineInputType::Color, 0)) {
-            continue;
-        }
-        if (poller.callback.on_change) {
-            poller.callback.on_change();
-        }
-    }
+    NotifyCallbacks(identifier, EngineInputType::Color, 0);
 }
 
 void InputEngine::TriggerOnMotionChange(const PadIdentifier& identifier, int motion,
                                         const BasicMotion& value) {
     std::scoped_lock lock{mutex_callback};
-    for (const auto& poller_pair : callback_list) {
-        const InputIdentifier& poller = poller_pair.second;
-        if (!IsInputIdentifierEqual(poller, identifier, EngineInputType::Motion, motion)) {
-            continue;
-        }
-        if (poller.callback.on_change) {
-            poller.callback.on_change();
-        }
-    }
+    NotifyCallbacks(identifier, EngineInputType::Motion, motion);
     if (!configuring || !mapping_callback.on_data) {
         return;
     }
@@ -409,29 +394,59 @@ void InputEngine::TriggerOnMotionChange(const PadIdentifier& identifier, int mot
 void InputEngine::TriggerOnCameraChange(const PadIdentifier& identifier,
                                         [[maybe_unused]] const Common::Input::CameraStatus& value) {
     std::scoped_lock lock{mutex_callback};
-    for (const auto& poller_pair : callback_list) {
-        const InputIdentifier& poller = poller_pair.second;
-        if (!IsInputIdentifierEqual(poller, identifier, EngineInputType::Camera, 0)) {
-            continue;
-        }
-        if (poller.callback.on_change) {
-            poller.callback.on_change();
-        }
-    }
+    NotifyCallbacks(identifier, EngineInputType::Camera, 0);
 }
 
 void InputEngine::TriggerOnNfcChange(const PadIdentifier& identifier,
                                      [[maybe_unused]] const Common::Input::NfcStatus& value) {
     std::scoped_lock lock{mutex_callback};
-    for (const auto& poller_pair : callback_list) {
-        const InputIdentifier& poller = poller_pair.second;
-        if (!IsInputIdentifierEqual(poller, identifier, EngineInputType::Nfc, 0)) {
+    NotifyCallbacks(identifier, EngineInputType::Nfc, 0);
+}
+
+void InputEngine::NotifyCallbacks(const PadIdentifier& identifier, EngineInputType type,
+                                  int index) {
+    const bool is_batched = batch_thread == std::this_thread::get_id() && !configuring;
+    for (const auto& [key, poller] : callback_list) {
+        if (!IsInputIdentifierEqual(poller, identifier, type, index)) {
+            continue;
+        }
+        if (!poller.callback.on_change) {
             continue;
         }
-        if (poller.callback.on_change) {
+        if (!is_batched) {
             poller.callback.on_change();
+            continue;
+        }
+        if (std::find(batched_callbacks.begin(), batched_callbacks.end(), key) ==
+            batched_callbacks.end()) {
+            batched_callbacks.push_back(key);
+        }
+    }
+}
+
+void InputEngine::BeginUpdateBatch() {
+    std::scoped_lock lock{mutex_callback};
+    if (batch_thread != std::thread::id{}) {
+        // Another thread is batching, notify this one immediately
+        return;
+    }
+    batch_thread = std::this_thread::get_id();
+}
+
+void InputEngine::EndUpdateBatch() {
+    std::scoped_lock lock{mutex_callback};
+    if (batch_thread != std::this_thread::get_id()) {
+        return;
+    }
+    batch_thread = {};
+    for (const int key : batched_callbacks) {
+        // The callback could have been deleted during the batch
+        const auto iterator = callback_list.find(key);
+        if (iterator != callback_list.end()) {
+            iterator->second.callback.on_change();
         }
     }
+    batched_callbacks.clear();
 }
 
 bool InputEngine::IsInputIdentifierEqual(const InputIdentifier& input_identifier,
@@ -3,13 +3,18 @@
 
 #pragma once
 
+#include <atomic>
 #include <functional>
 #include <mutex>
+#include <shared_mutex>
+#include <thread>
 #include <unordered_map>
+#include <vector>
 
 #include "common/common_types.h"
 #include "common/input.h"
 #include "common/param_package.h"
+#include "common/seqlock.h"
 #include "common/uuid.h"
 #include "input_common/main.h"
 
@@ -261,16 +266,22 @@ protected:
     void SetCamera(const PadIdentifier& identifier, const Common::Input::CameraStatus& value);
     void SetNfc(const PadIdentifier& identifier, const Common::Input::NfcStatus& value);
 
+    // Delays the change notifications of the calling thread until EndUpdateBatch, each callback is
+    // then notified once with the latest state. Notifications are not delayed while configuring.
+    void BeginUpdateBatch();
+    void EndUpdateBatch();
+
     virtual std::string GetHatButtonName([[maybe_unused]] u8 direction_value) const {
         return "Unknown";
     }
 
 private:
+    // Input values are read and written under a shared lock, only adding inputs is exclusive
     struct ControllerData {
-        std::unordered_map<int, bool> buttons;
-        std::unordered_map<int, u8> hat_buttons;
-        std::unordered_map<int, float> axes;
-        std::unordered_map<int, BasicMotion> motions;
+        std::unordered_map<int, std::atomic<bool>> buttons;
+        std::unordered_map<int, std::atomic<u8>> hat_buttons;
+        std::unordered_map<int, std::atomic<f32>> axes;
+        std::unordered_map<int, Common::SeqLock<BasicMotion>> motions;
         Common::Input::BatteryLevel battery{};
         Common::Input::BodyColorStatus color{};
         Common::Input::CameraStatus camera{};
@@ -289,18 +300,30 @@ private:
                                const Common::Input::CameraStatus& value);
     void TriggerOnNfcChange(const PadIdentifier& identifier, const Common::Input::NfcStatus& value);
 
+    template <typename Slot, typename T>
+    void StoreValue(const PadIdentifier& identifier,
+                    std::unordered_map<int, Slot> ControllerData::*slots, int index,
+                    const T& value);
+
+    // Calls the callbacks listening to an input, must be called with mutex_callback held
+    void NotifyCallbacks(const PadIdentifier& identifier, EngineInputType type, int index);
+
     bool IsInputIdentifierEqual(const InputIdentifier& input_identifier,
                                 const PadIdentifier& identifier, EngineInputType type,
                                 int index) const;
 
-    mutable std::mutex mutex;
+    mutable std::shared_mutex mutex;
     mutable std::mutex mutex_callback;
-    bool configuring{false};
+    std::atomic<bool> configuring{false};
     const std::string input_engine;
     int last_callback_key = 0;
     std::unordered_map<PadIdentifier, ControllerData> controller_list;
     std::unordered_map<int, InputIdentifier> callback_list;
     MappingCallback mapping_callback;
+
+    // Thread running an update batch and the callbacks waiting for the batch to end
+    std::thread::id batch_thread{};
+    std::vector<int> batched_callbacks;
 };
 
 } // namespace InputCommon
@@ -6,12 +6,56 @@
 #else
 #include <arpa/inet.h>
 #endif
+#include <algorithm>
 #include <cstring>
+#include <mutex>
 #include <string>
 #include "network/packet.h"
 
 namespace Network {
 
+namespace {
+/// Storage of destroyed packets. Packets are often built on one thread and destroyed on another,
+/// so the pool is shared between threads.
+class BufferPool {
+public:
+    std::vector<char> Acquire() {
+        std::scoped_lock lk{mutex};
+        if (buffers.empty()) {
+            return {};
+        }
+        std::vector<char> buffer = std::move(buffers.back());
+        buffers.pop_back();
+        return buffer;
+    }
+
+    void Release(std::vector<char>&& buffer) {
+        if (buffer.capacity() > MaxBufferCapacity) {
+            return;
+        }
+        buffer.clear();
+        std::scoped_lock lk{mutex};
+        if (buffers.size() < MaxBuffers) {
+            buffers.push_back(std::move(buffer));
+        }
+    }
+
+private:
+    /// Larger buffers are freed, they are rare and would keep too much memory alive
+    static constexpr std::size_t MaxBufferCapacity = 64 * 1024;
+    static constexpr std::size_t MaxBuffers = 256;
+
+    std::mutex mutex;
+    std::vector<std::vector<char>> buffers;
+};
+
+BufferPool& GetBufferPool() {
+    // Never destroyed, packets owned by other static objects may be destroyed after it
+    static BufferPool* const pool = new BufferPool;
+    return *pool;
+}
+} // Anonymous namespace
+
 #ifndef htonll
 static u64 htonll(u64 x) {
     return ((1 == htonl(1)) ? (x) : ((uint64_t)htonl((x)&0xFFFFFFFF) << 32) | htonl((x) >> 32));
@@ -24,8 +68,15 @@ static u64 ntohll(u64 x) {
 }
 #endif
 
+Packet::~Packet() {
+    if (data.capacity() != 0) {
+        GetBufferPool().Release(std::move(data));
+    }
+}
+
 void Packet::Append(const void* in_data, std::size_t size_in_bytes) {
     if (in_data && (size_in_bytes > 0)) {
+        Reserve(size_in_bytes);
         std::size_t start = data.size();
         data.resize(start + size_in_bytes);
         std::memcpy(&data[start], in_data, size_in_bytes);
@@ -39,6 +90,17 @@ void Packet::Read(void* out_data, std::size_t size_in_bytes) {
     }
 }
 
+void Packet::Reserve(std::size_t size_in_bytes) {
+    if (data.capacity() == 0) {
+        data = GetBufferPool().Acquire();
+    }
+    const std::size_t required = data.size() + size_in_bytes;
+    if (required > data.capacity()) {
+        // Grow geometrically, reserve alone would reallocate on each append
+        data.reserve(std::max(required, data.capacity() * 2));
+    }
+}
+
 void Packet::Clear() {
     data.clear();
     read_pos = 0;
@@ -169,6 +231,32 @@ Packet& Packet::Read(std::string& out_data) {
     return *this;
 }
 
+Packet& Packet::Read(std::string_view& out_data) {
+    u32 length = 0;
+    Read(length);
+
+    out_data = {};
+    if ((length > 0) && CheckSize(length)) {
+        out_data = std::string_view(&data[read_pos], length);
+        read_pos += length;
+    }
+
+    return *this;
+}
+
+Packet& Packet::Read(std::span<const u8>& out_data) {
+    u32 length = 0;
+    Read(length);
+
+    out_data = {};
+    if ((length > 0) && CheckSize(length)) {
+        out_data = std::span(reinterpret_cast<const u8*>(&data[read_pos]), length);
+        read_pos += length;
+    }
+
+    return *this;
+}
+
 Packet& Packet::Write(bool in_data) {
     Write(static_cast<u8>(in_data));
     return *this;
@@ -4,16 +4,25 @@
 #pragma once
 
 #include <array>
+#include <span>
+#include <string_view>
+#include <type_traits>
 #include <vector>
 #include "common/common_types.h"
 
 namespace Network {
 
-/// A class that serializes data for network transfer. It also handles endianness
+/// A class that serializes data for network transfer. It also handles endianness.
+/// The storage of destroyed packets is pooled and reused by new ones.
 class Packet {
 public:
     Packet() = default;
-    ~Packet() = default;
+    ~Packet();
+
+    Packet(const Packet&) = default;
+    Packet& operator=(const Packet&) = default;
+    Packet(Packet&&) noexcept = default;
+    Packet& operator=(Packet&&) noexcept = default;
 
     /**
      * Append data to the end of the packet
@@ -29,6 +38,12 @@ public:
      */
     void Read(void* out_data, std::size_t size_in_bytes);
 
+    /**
+     * Makes room for appending data without reallocating
+     * @param size_in_bytes Number of bytes that will be appended
+     */
+    void Reserve(std::size_t size_in_bytes);
+
     /**
      * Clear the packet
      * After calling Clear, the packet is empty.
@@ -77,6 +92,10 @@ public:
     Packet& Read(double& out_data);
     Packet& Read(char* out_data);
     Packet& Read(std::string& out_data);
+    /// Overloads of read function that return views into the packet instead of copying. The views
+    /// are valid until the packet is modified or destroyed.
+    Packet& Read(std::string_view& out_data);
+    Packet& Read(std::span<const u8>& out_data);
     template <typename T>
     Packet& Read(std::vector<T>& out_data);
     template <typename T, std::size_t S>
@@ -110,6 +129,11 @@ private:
      */
     bool CheckSize(std::size_t size);
 
+    /// Single byte types are serialized as is, so arrays of them are copied in bulk
+    template <typename T>
+    static constexpr bool IsRawByte =
+        sizeof(T) == 1 && std::is_trivially_copyable_v<T> && !std::is_same_v<T, bool>;
+
     // Member data
     std::vector<char> data;   ///< Data stored in the packet
     std::size_t read_pos = 0; ///< Current reading position in the packet
@@ -121,23 +145,35 @@ Packet& Packet::Read(std::vector<T>& out_data) {
     // First extract the size
     u32 size = 0;
     Read(size);
-    out_data.resize(size);
 
     // Then extract the data
-    for (std::size_t i = 0; i < out_data.size(); ++i) {
-        T character;
-        Read(character);
-        out_data[i] = character;
+    if constexpr (IsRawByte<T>) {
+        out_data.clear();
+        if (CheckSize(size)) {
+            out_data.resize(size);
+            Read(out_data.data(), size);
+        }
+    } else {
+        out_data.resize(size);
+        for (std::size_t i = 0; i < out_data.size(); ++i) {
+            T character;
+            Read(character);
+            out_data[i] = character;
+        }
     }
     return *this;
 }
 
 template <typename T, std::size_t S>
 Packet& Packet::Read(std::array<T, S>& out_data) {
-    for (std::size_t i = 0; i < out_data.size(); ++i) {
-        T character;
-        Read(character);
-        out_data[i] = character;
+    if constexpr (IsRawByte<T>) {
+        Read(out_data.data(), S);
+    } else {
+        for (std::size_t i = 0; i < out_data.size(); ++i) {
+            T character;
+            Read(character);
+            out_data[i] = character;
+        }
     }
     return *this;
 }
@@ -148,16 +184,24 @@ Packet& Packet::Write(const std::vector<T>& in_data) {
     Write(static_cast<u32>(in_data.size()));
 
     // Then insert the data
-    for (std::size_t i = 0; i < in_data.size(); ++i) {
-        Write(in_data[i]);
+    if constexpr (IsRawByte<T>) {
+        Append(in_data.data(), in_data.size());
+    } else {
+        for (std::size_t i = 0; i < in_data.size(); ++i) {
+            Write(in_data[i]);
+        }
     }
     return *this;
 }
 
 template <typename T, std::size_t S>
 Packet& Packet::Write(const std::array<T, S>& in_data) {
-    for (std::size_t i = 0; i < in_data.size(); ++i) {
-        Write(in_data[i]);
+    if constexpr (IsRawByte<T>) {
+        Append(in_data.data(), S);
+    } else {
+        for (std::size_t i = 0; i < in_data.size(); ++i) {
+            Write(in_data[i]);
+        }
     }
     return *this;
 }
@@ -44,8 +44,10 @@ public:
         ENetPeer* peer; ///< The remote peer.
     };
     using MemberList = std::vector<Member>;
-    MemberList members;                     ///< Information about the members of this room
-    mutable std::shared_mutex member_mutex; ///< Mutex for locking the members list
+    MemberList members; ///< Information about the members of this room
+    /// Mutex for locking the members list. The list is only modified by the room thread, which
+    /// takes it exclusively to do so and reads the list without locking.
+    mutable std::shared_mutex member_mutex;
 
     UsernameBanList username_ban_list; ///< List of banned usernames
     IPBanList ip_ban_list;             ///< List of banned IP addresses
@@ -63,6 +65,9 @@ public:
     void ServerLoop();
     void StartLoop();
 
+    /// Dispatches a received ENet event to its handler.
+    void HandleEvent(const ENetEvent& event);
+
     /**
      * Parses and answers a room join request from a client.
      * Validates the uniqueness of the username and assigns the MAC address
@@ -220,6 +225,15 @@ public:
      */
     void HandleLdnPacket(const ENetEvent* event);
 
+    /**
+     * Forwards a received proxy or LDN packet without copying it.
+     * @param event The ENet event containing the data
+     * @param broadcast Whether to send the packet to all members except the sender
+     * @param destination_address The fake IP address of the recipient if not broadcasting
+     */
+    void ForwardPacket(const ENetEvent* event, bool broadcast,
+                       const IPv4Address& destination_address);
+
     /**
      * Extracts a chat entry from a received ENet packet and adds it to the chat queue.
      * @param event The ENet event that was received.
@@ -244,64 +258,74 @@ void Room::RoomImpl::ServerLoop() {
     while (state != State::Closed) {
         ENetEvent event;
         if (enet_host_service(server, &event, 5) > 0) {
-            switch (event.type) {
-            case ENET_EVENT_TYPE_RECEIVE:
-                switch (event.packet->data[0]) {
-                case IdJoinRequest:
-                    HandleJoinRequest(&event);
-                    break;
-                case IdSetGameInfo:
-                    HandleGameInfoPacket(&event);
-                    break;
-                case IdProxyPacket:
-                    HandleProxyPacket(&event);
-                    break;
-                case IdLdnPacket:
-                    HandleLdnPacket(&event);
-                    break;
-                case IdChatMessage:
-                    HandleChatPacket(&event);
-                    break;
-                // Moderation
-                case IdModKick:
-                    HandleModKickPacket(&event);
-                    break;
-                case IdModBan:
-                    HandleModBanPacket(&event);
-                    break;
-                case IdModUnban:
-                    HandleModUnbanPacket(&event);
-                    break;
-                case IdModGetBanList:
-                    HandleModGetBanListPacket(&event);
-                    break;
-                }
-                enet_packet_destroy(event.packet);
-                break;
-            case ENET_EVENT_TYPE_DISCONNECT:
-                HandleClientDisconnection(event.peer);
-                break;
-            case ENET_EVENT_TYPE_NONE:
-            case ENET_EVENT_TYPE_CONNECT:
-                break;
-            }
+            // Handle every event received this tick before sending, so that the replies and
+            // forwarded packets to a member are coalesced into as few datagrams as possible.
+            do {
+                HandleEvent(event);
+            } while (enet_host_check_events(server, &event) > 0);
+            enet_host_flush(server);
         }
     }
     // Close the connection to all members:
     SendCloseMessage();
 }
 
+void Room::RoomImpl::HandleEvent(const ENetEvent& event) {
+    switch (event.type) {
+    case ENET_EVENT_TYPE_RECEIVE:
+        switch (event.packet->data[0]) {
+        case IdJoinRequest:
+            HandleJoinRequest(&event);
+            break;
+        case IdSetGameInfo:
+            HandleGameInfoPacket(&event);
+            break;
+        case IdProxyPacket:
+            HandleProxyPacket(&event);
+            break;
+        case IdLdnPacket:
+            HandleLdnPacket(&event);
+            break;
+        case IdChatMessage:
+            HandleChatPacket(&event);
+            break;
+        // Moderation
+        case IdModKick:
+            HandleModKickPacket(&event);
+            break;
+        case IdModBan:
+            HandleModBanPacket(&event);
+            break;
+        case IdModUnban:
+            HandleModUnbanPacket(&event);
+            break;
+        case IdModGetBanList:
+            HandleModGetBanListPacket(&event);
+            break;
+        }
+        // Forwarded packets are referenced by the peers they were queued on, which release them
+        // once sent
+        if (event.packet->referenceCount == 0) {
+            enet_packet_destroy(event.packet);
+        }
+        break;
+    case ENET_EVENT_TYPE_DISCONNECT:
+        HandleClientDisconnection(event.peer);
+        break;
+    case ENET_EVENT_TYPE_NONE:
+    case ENET_EVENT_TYPE_CONNECT:
+        break;
+    }
+}
+
 void Room::RoomImpl::StartLoop() {
     room_thread = std::make_unique<std::thread>(&Room::RoomImpl::ServerLoop, this);
 }
 
 void Room::RoomImpl::HandleJoinRequest(const ENetEvent* event) {
-    {
-        std::lock_guard lock(member_mutex);
-        if (members.size() >= room_information.member_slots) {
-            SendRoomIsFull(event->peer);
-            return;
-        }
+    if (members.size() >= room_information.member_slots) {
+        SendRoomIsFull(event->peer);
+        return;
     }
     Packet packet;
     packet.Append(event->packet->data, event->packet->dataLength);
@@ -441,6 +465,8 @@ void Room::RoomImpl::HandleModKickPacket(const ENetEvent* event) {
         enet_address_get_host_ip(&target_member->peer->address, ip_raw.data(), sizeof(ip_raw) - 1);
         ip = ip_raw.data();
 
+        // Disconnecting drops the unsent packets of the peer
+        enet_host_flush(server);
         enet_peer_disconnect(target_member->peer, 0);
         members.erase(target_member);
     }
@@ -484,6 +510,8 @@ void Room::RoomImpl::HandleModBanPacket(const ENetEvent* event) {
         enet_address_get_host_ip(&target_member->peer->address, ip_raw.data(), sizeof(ip_raw) - 1);
         ip = ip_raw.data();
 
+        // Disconnecting drops the unsent packets of the peer
+        enet_host_flush(server);
         enet_peer_disconnect(target_member->peer, 0);
         members.erase(target_member);
     }
@@ -564,20 +592,17 @@ bool Room::RoomImpl::IsValidNickname(const std::string& nickname) const {
     if (!std::regex_match(nickname, nickname_regex))
         return false;
 
-    std::lock_guard lock(member_mutex);
     return std::all_of(members.begin(), members.end(),
                        [&nickname](const auto& member) { return member.nickname != nickname; });
 }
 
 bool Room::RoomImpl::IsValidFakeIPAddress(const IPv4Address& address) const {
     // An IP address is valid if it is not already taken by anybody else in the room.
-    std::lock_guard lock(member_mutex);
     return std::all_of(members.begin(), members.end(),
                        [&address](const auto& member) { return member.fake_ip != address; });
 }
 
 bool Room::RoomImpl::HasModPermission(const ENetPeer* client) const {
-    std::lock_guard lock(member_mutex);
     const auto sending_member =
         std::find_if(members.begin(), members.end(),
                      [client](const auto& member) { return member.peer == client; });
@@ -603,7 +628,6 @@ void Room::RoomImpl::SendNameCollision(ENetPeer* client) {
     ENetPacket* enet_packet =
         enet_packet_create(packet.GetData(), packet.GetDataSize(), ENET_PACKET_FLAG_RELIABLE);
     enet_peer_send(client, 0, enet_packet);
-    enet_host_flush(server);
 }
 
 void Room::RoomImpl::SendIPCollision(ENetPeer* client) {
@@ -613,7 +637,6 @@ void Room::RoomImpl::SendIPCollision(ENetPeer* client) {
     ENetPacket* enet_packet =
         enet_packet_create(packet.GetData(), packet.GetDataSize(), ENET_PACKET_FLAG_RELIABLE);
     enet_peer_send(client, 0, enet_packet);
-    enet_host_flush(server);
 }
 
 void Room::RoomImpl::SendWrongPassword(ENetPeer* client) {
@@ -623,7 +646,6 @@ void Room::RoomImpl::SendWrongPassword(ENetPeer* client) {
     ENetPacket* enet_packet =
         enet_packet_create(packet.GetData(), packet.GetDataSize(), ENET_PACKET_FLAG_RELIABLE);
     enet_peer_send(client, 0, enet_packet);
-    enet_host_flush(server);
 }
 
 void Room::RoomImpl::SendRoomIsFull(ENetPeer* client) {
@@ -633,7 +655,6 @@ void Room::RoomImpl::SendRoomIsFull(ENetPeer* client) {
     ENetPacket* enet_packet =
         enet_packet_create(packet.GetData(), packet.GetDataSize(), ENET_PACKET_FLAG_RELIABLE);
     enet_peer_send(client, 0, enet_packet);
-    enet_host_flush(server);
 }
 
 void Room::RoomImpl::SendVersionMismatch(ENetPeer* client) {
@@ -644,7 +665,6 @@ void Room::RoomImpl::SendVersionMismatch(ENetPeer* client) {
     ENetPacket* enet_packet =
         enet_packet_create(packet.GetData(), packet.GetDataSize(), ENET_PACKET_FLAG_RELIABLE);
     enet_peer_send(client, 0, enet_packet);
-    enet_host_flush(server);
 }
 
 void Room::RoomImpl::SendJoinSuccess(ENetPeer* client, IPv4Address fake_ip) {
@@ -654,7 +674,6 @@ void Room::RoomImpl::SendJoinSuccess(ENetPeer* client, IPv4Address fake_ip) {
     ENetPacket* enet_packet =
         enet_packet_create(packet.GetData(), packet.GetDataSize(), ENET_PACKET_FLAG_RELIABLE);
     enet_peer_send(client, 0, enet_packet);
-    enet_host_flush(server);
 }
 
 void Room::RoomImpl::SendJoinSuccessAsMod(ENetPeer* client, IPv4Address fake_ip) {
@@ -664,7 +683,6 @@ void Room::RoomImpl::SendJoinSuccessAsMod(ENetPeer* client, IPv4Address fake_ip)
     ENetPacket* enet_packet =
         enet_packet_create(packet.GetData(), packet.GetDataSize(), ENET_PACKET_FLAG_RELIABLE);
     enet_peer_send(client, 0, enet_packet);
-    enet_host_flush(server);
 }
 
 void Room::RoomImpl::SendUserKicked(ENetPeer* client) {
@@ -674,7 +692,6 @@ void Room::RoomImpl::SendUserKicked(ENetPeer* client) {
     ENetPacket* enet_packet =
         enet_packet_create(packet.GetData(), packet.GetDataSize(), ENET_PACKET_FLAG_RELIABLE);
     enet_peer_send(client, 0, enet_packet);
-    enet_host_flush(server);
 }
 
 void Room::RoomImpl::SendUserBanned(ENetPeer* client) {
@@ -684,7 +701,6 @@ void Room::RoomImpl::SendUserBanned(ENetPeer* client) {
     ENetPacket* enet_packet =
         enet_packet_create(packet.GetData(), packet.GetDataSize(), ENET_PACKET_FLAG_RELIABLE);
     enet_peer_send(client, 0, enet_packet);
-    enet_host_flush(server);
 }
 
 void Room::RoomImpl::SendModPermissionDenied(ENetPeer* client) {
@@ -694,7 +710,6 @@ void Room::RoomImpl::SendModPermissionDenied(ENetPeer* client) {
     ENetPacket* enet_packet =
         enet_packet_create(packet.GetData(), packet.GetDataSize(), ENET_PACKET_FLAG_RELIABLE);
     enet_peer_send(client, 0, enet_packet);
-    enet_host_flush(server);
 }
 
 void Room::RoomImpl::SendModNoSuchUser(ENetPeer* client) {
@@ -704,7 +719,6 @@ void Room::RoomImpl::SendModNoSuchUser(ENetPeer* client) {
     ENetPacket* enet_packet =
         enet_packet_create(packet.GetData(), packet.GetDataSize(), ENET_PACKET_FLAG_RELIABLE);
     enet_peer_send(client, 0, enet_packet);
-    enet_host_flush(server);
 }
 
 void Room::RoomImpl::SendModBanListResponse(ENetPeer* client) {
@@ -719,13 +733,11 @@ void Room::RoomImpl::SendModBanListResponse(ENetPeer* client) {
     ENetPacket* enet_packet =
         enet_packet_create(packet.GetData(), packet.GetDataSize(), ENET_PACKET_FLAG_RELIABLE);
     enet_peer_send(client, 0, enet_packet);
-    enet_host_flush(server);
 }
 
 void Room::RoomImpl::SendCloseMessage() {
     Packet packet;
     packet.Write(static_cast<u8>(IdCloseRoom));
-    std::lock_guard lock(member_mutex);
     if (!members.empty()) {
         ENetPacket* enet_packet =
             enet_packet_create(packet.GetData(), packet.GetDataSize(), ENET_PACKET_FLAG_RELIABLE);
@@ -746,7 +758,6 @@ void Room::RoomImpl::SendStatusMessage(StatusMessageTypes type, const std::strin
     packet.Write(static_cast<u8>(type));
     packet.Write(nickname);
     packet.Write(username);
-    std::lock_guard lock(member_mutex);
     if (!members.empty()) {
         ENetPacket* enet_packet =
             enet_packet_create(packet.GetData(), packet.GetDataSize(), ENET_PACKET_FLAG_RELIABLE);
@@ -754,7 +765,6 @@ void Room::RoomImpl::SendStatusMessage(StatusMessageTypes type, const std::strin
             enet_peer_send(member.peer, 0, enet_packet);
         }
     }
-    enet_host_flush(server);
 
     const std::string display_name =
         username.empty() ? nickname : fmt::format("{} ({})", nickname, username);
@@ -789,24 +799,20 @@ void Room::RoomImpl::BroadcastRoomInformation() {
     packet.Write(room_information.host_username);
 
     packet.Write(static_cast<u32>(members.size()));
-    {
-        std::lock_guard lock(member_mutex);
-        for (const auto& member : members) {
-            packet.Write(member.nickname);
-            packet.Write(member.fake_ip);
-            packet.Write(member.game_info.name);
-            packet.Write(member.game_info.id);
-            packet.Write(member.game_info.version);
-            packet.Write(member.user_data.username);
-            packet.Write(member.user_data.display_name);
-            packet.Write(member.user_data.avatar_url);
-        }
+    for (const auto& member : members) {
+        packet.Write(member.nickname);
+        packet.Write(member.fake_ip);
+        packet.Write(member.game_info.name);
+        packet.Write(member.game_info.id);
+        packet.Write(member.game_info.version);
+        packet.Write(member.user_data.username);
+        packet.Write(member.user_data.display_name);
+        packet.Write(member.user_data.avatar_url);
     }
 
     ENetPacket* enet_packet =
         enet_packet_create(packet.GetData(), packet.GetDataSize(), ENET_PACKET_FLAG_RELIABLE);
     enet_host_broadcast(server, 0, enet_packet);
-    enet_host_flush(server);
 }
 
 IPv4Address Room::RoomImpl::GenerateFakeIPAddress() {
@@ -840,43 +846,7 @@ void Room::RoomImpl::HandleProxyPacket(const ENetEvent* event) {
     bool broadcast;
     in_packet.Read(broadcast); // Broadcast
 
-    Packet out_packet;
-    out_packet.Append(event->packet->data, event->packet->dataLength);
-    ENetPacket* enet_packet = enet_packet_create(out_packet.GetData(), out_packet.GetDataSize(),
-                                                 ENET_PACKET_FLAG_RELIABLE);
-
-    const auto& destination_address = remote_ip;
-    if (broadcast) { // Send the data to everyone except the sender
-        std::lock_guard lock(member_mutex);
-        bool sent_packet = false;
-        for (const auto& member : members) {
-            if (member.peer != event->peer) {
-                sent_packet = true;
-                enet_peer_send(member.peer, 0, enet_packet);
-            }
-        }
-
-        if (!sent_packet) {
-            enet_packet_destroy(enet_packet);
-        }
-    } else { // Send the data only to the destination client
-        std::lock_guard lock(member_mutex);
-        auto member = std::find_if(members.begin(), members.end(),
-                                   [destination_address](const Member& member_entry) -> bool {
-                                       return member_entry.fake_ip == destination_address;
-                                   });
-        if (member != members.end()) {
-            enet_peer_send(member->peer, 0, enet_packet);
-        } else {
-            LOG_ERROR(Network,
-                      "Attempting to send to unknown IP address: "
-                      "{}.{}.{}.{}",
-                      destination_address[0], destination_address[1], destination_address[2],
-                      destination_address[3]);
-            enet_packet_destroy(enet_packet);
-        }
-    }
-    enet_host_flush(server);
+    ForwardPacket(event, broadcast, remote_ip);
 }
 
 void Room::RoomImpl::HandleLdnPacket(const ENetEvent* event) {
@@ -894,29 +864,25 @@ void Room::RoomImpl::HandleLdnPacket(const ENetEvent* event) {
     bool broadcast;
     in_packet.Read(broadcast); // Broadcast
 
-    Packet out_packet;
-    out_packet.Append(event->packet->data, event->packet->dataLength);
-    ENetPacket* enet_packet = enet_packet_create(out_packet.GetData(), out_packet.GetDataSize(),
-                                                 ENET_PACKET_FLAG_RELIABLE);
+    ForwardPacket(event, broadcast, remote_ip);
+}
 
-    const auto& destination_address = remote_ip;
+void Room::RoomImpl::ForwardPacket(const ENetEvent* event, bool broadcast,
+                                    const IPv4Address& destination_address) {
+    // The received packet is queued on every recipient as is, its reference count keeps it alive
+    // until the last of them sent it. Forwarded packets are always sent reliably, like the copies
+    // the room used to send, whichever flags the sender used.
+    ENetPacket* enet_packet = event->packet;
+    enet_packet->flags |= ENET_PACKET_FLAG_RELIABLE;
     if (broadcast) { // Send the data to everyone except the sender
-        std::lock_guard lock(member_mutex);
-        bool sent_packet = false;
         for (const auto& member : members) {
             if (member.peer != event->peer) {
-                sent_packet = true;
                 enet_peer_send(member.peer, 0, enet_packet);
             }
         }
-
-        if (!sent_packet) {
-            enet_packet_destroy(enet_packet);
-        }
-    } else {
-        std::lock_guard lock(member_mutex);
+    } else { // Send the data only to the destination client
         auto member = std::find_if(members.begin(), members.end(),
-                                   [destination_address](const Member& member_entry) -> bool {
+                                   [&destination_address](const Member& member_entry) -> bool {
                                        return member_entry.fake_ip == destination_address;
                                    });
         if (member != members.end()) {
@@ -927,10 +893,8 @@ void Room::RoomImpl::HandleLdnPacket(const ENetEvent* event) {
                       "{}.{}.{}.{}",
                       destination_address[0], destination_address[1], destination_address[2],
                       destination_address[3]);
-            enet_packet_destroy(enet_packet);
         }
     }
-    enet_host_flush(server);
 }
 
 void Room::RoomImpl::HandleChatPacket(const ENetEvent* event) {
@@ -944,7 +908,6 @@ void Room::RoomImpl::HandleChatPacket(const ENetEvent* event) {
         return member.peer == event->peer;
     };
 
-    std::lock_guard lock(member_mutex);
     const auto sending_member = std::find_if(members.begin(), members.end(), CompareNetworkAddress);
     if (sending_member == members.end()) {
         return; // Received a chat message from a unknown sender
@@ -973,8 +936,6 @@ void Room::RoomImpl::HandleChatPacket(const ENetEvent* event) {
         enet_packet_destroy(enet_packet);
     }
 
-    enet_host_flush(server);
-
     if (sending_member->user_data.username.empty()) {
         LOG_INFO(Network, "{}: {}", sending_member->nickname, message);
     } else {
@@ -1107,7 +1068,7 @@ Room::BanList Room::GetBanList() const {
 
 std::vector<Member> Room::GetRoomMemberList() const {
     std::vector<Member> member_list;
-    std::lock_guard lock(room_impl->member_mutex);
+    std::shared_lock lock(room_impl->member_mutex);
     for (const auto& member_impl : room_impl->members) {
         Member member;
         member.nickname = member_impl.nickname;
@@ -2,7 +2,6 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <atomic>
-#include <list>
 #include <mutex>
 #include <set>
 #include <thread>
@@ -44,8 +43,10 @@ public:
     std::mutex network_mutex; ///< Mutex that controls access to the `client` variable.
     /// Thread that receives and dispatches network packets
     std::unique_ptr<std::thread> loop_thread;
-    std::mutex send_list_mutex;  ///< Mutex that controls access to the `send_list` variable.
-    std::list<Packet> send_list; ///< A list that stores all packets to send the async
+    std::mutex send_list_mutex;    ///< Mutex that controls access to the `send_list` variable.
+    std::vector<Packet> send_list; ///< A list that stores all packets to send the async
+    /// Packets being sent by the loop thread, swapped with `send_list` to reuse both allocations
+    std::vector<Packet> sending_list;
 
     template <typename T>
     using CallbackSet = std::set<CallbackHandle<T>>;
@@ -257,16 +258,16 @@ void RoomMember::RoomMemberImpl::MemberLoop() {
                 break;
             }
         }
-        std::list<Packet> packets;
         {
             std::lock_guard send_lock(send_list_mutex);
-            packets.swap(send_list);
+            sending_list.swap(send_list);
         }
-        for (const auto& packet : packets) {
+        for (const auto& packet : sending_list) {
             ENetPacket* enetPacket = enet_packet_create(packet.GetData(), packet.GetDataSize(),
                                                         ENET_PACKET_FLAG_RELIABLE);
             enet_peer_send(server, 0, enetPacket);
         }
+        sending_list.clear();
         enet_host_flush(client);
     }
     Disconnect();
@@ -625,7 +626,11 @@ bool RoomMember::IsConnected() const {
 }
 
 void RoomMember::SendProxyPacket(const ProxyPacket& proxy_packet) {
+    // Message type, endpoints, protocol, broadcast flag and data size
+    constexpr std::size_t HeaderSize = 21;
+
     Packet packet;
+    packet.Reserve(HeaderSize + proxy_packet.data.size());
     packet.Write(static_cast<u8>(IdProxyPacket));
 
     packet.Write(static_cast<u8>(proxy_packet.local_endpoint.family));
@@ -644,7 +649,11 @@ void RoomMember::SendProxyPacket(const ProxyPacket& proxy_packet) {
 }
 
 void RoomMember::SendLdnPacket(const LDNPacket& ldn_packet) {
+    // Message type, packet type, addresses, broadcast flag and data size
+    constexpr std::size_t HeaderSize = 15;
+
     Packet packet;
+    packet.Reserve(HeaderSize + ldn_packet.data.size());
     packet.Write(static_cast<u8>(IdLdnPacket));
 
     packet.Write(static_cast<u8>(ldn_packet.type));
@@ -0,0 +1,47 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "shader_recompiler/arena.h"
+
+namespace Shader {
+namespace {
+thread_local std::pmr::memory_resource* current_resource{};
+} // Anonymous namespace
+
+Arena::Arena(size_t initial_size_)
+    : initial_buffer{std::make_unique<std::byte[]>(initial_size_)}, initial_size{initial_size_},
+      monotonic{initial_buffer.get(), initial_size}, counter{&monotonic} {}
+
+Arena::~Arena() = default;
+
+void Arena::Release() {
+    monotonic.release();
+    counter.bytes = 0;
+}
+
+void* Arena::CountingResource::do_allocate(size_t size, size_t alignment) {
+    bytes += size;
+    return upstream->allocate(size, alignment);
+}
+
+void Arena::CountingResource::do_deallocate(void* pointer, size_t size, size_t alignment) {
+    upstream->deallocate(pointer, size, alignment);
+}
+
+bool Arena::CountingResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+    return this == &other;
+}
+
+ArenaScope::ArenaScope(Arena& arena) : previous{current_resource} {
+    current_resource = arena.Resource();
+}
+
+ArenaScope::~ArenaScope() {
+    current_resource = previous;
+}
+
+std::pmr::memory_resource* CurrentArenaResource() noexcept {
+    return current_resource ? current_resource : std::pmr::new_delete_resource();
+}
+
+} // namespace Shader
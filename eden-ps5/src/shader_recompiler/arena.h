@@ -0,0 +1,128 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <memory_resource>
+#include <unordered_map>
+#include <vector>
+
+#include "common/common_funcs.h"
+#include "common/common_types.h"
+
+namespace Shader {
+
+/**
+ * Monotonic allocator for the temporaries of a single shader compilation.
+ *
+ * Memory is never freed individually, it is reclaimed all at once when the arena is released.
+ * The initial buffer is kept across releases so that most compilations never reach the heap.
+ */
+class Arena {
+public:
+    explicit Arena(size_t initial_size = 256 * 1024);
+    ~Arena();
+
+    YUZU_NON_COPYABLE(Arena);
+    YUZU_NON_MOVEABLE(Arena);
+
+    /// Returns the memory resource that allocates from this arena.
+    [[nodiscard]] std::pmr::memory_resource* Resource() noexcept {
+        return &counter;
+    }
+
+    /// Frees every allocation made from the arena.
+    void Release();
+
+    /// Returns the number of bytes allocated since the last release.
+    /// The arena never reuses memory, so this is also the peak usage.
+    [[nodiscard]] size_t BytesAllocated() const noexcept {
+        return counter.bytes;
+    }
+
+private:
+    class CountingResource final : public std::pmr::memory_resource {
+    public:
+        explicit CountingResource(std::pmr::memory_resource* upstream_) : upstream{upstream_} {}
+
+        size_t bytes{};
+
+    private:
+        void* do_allocate(size_t size, size_t alignment) override;
+        void do_deallocate(void* pointer, size_t size, size_t alignment) override;
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+        std::pmr::memory_resource* upstream;
+    };
+
+    std::unique_ptr<std::byte[]> initial_buffer;
+    size_t initial_size;
+    std::pmr::monotonic_buffer_resource monotonic;
+    CountingResource counter;
+};
+
+/// Makes an arena the allocation target of the arena containers created on this thread.
+class ArenaScope {
+public:
+    explicit ArenaScope(Arena& arena);
+    ~ArenaScope();
+
+    YUZU_NON_COPYABLE(ArenaScope);
+    YUZU_NON_MOVEABLE(ArenaScope);
+
+private:
+    std::pmr::memory_resource* previous;
+};
+
+/// Returns the resource of the arena in scope, or the global heap when there is none.
+[[nodiscard]] std::pmr::memory_resource* CurrentArenaResource() noexcept;
+
+/// Allocator that binds to the arena in scope when it is constructed.
+template <typename T>
+class ArenaAllocator {
+public:
+    using value_type = T;
+
+    ArenaAllocator() noexcept : resource{CurrentArenaResource()} {}
+
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) noexcept : resource{other.resource} {}
+
+    [[nodiscard]] T* allocate(size_t count) {
+        return static_cast<T*>(resource->allocate(count * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T* pointer, size_t count) noexcept {
+        resource->deallocate(pointer, count * sizeof(T), alignof(T));
+    }
+
+    template <typename U>
+    bool operator==(const ArenaAllocator<U>& other) const noexcept {
+        return resource == other.resource;
+    }
+
+private:
+    template <typename>
+    friend class ArenaAllocator;
+
+    std::pmr::memory_resource* resource;
+};
+
+template <typename T>
+using ArenaVector = std::vector<T, ArenaAllocator<T>>;
+
+template <typename T>
+using ArenaDeque = std::deque<T, ArenaAllocator<T>>;
+
+template <typename Key, typename T, typename Compare = std::less<Key>>
+using ArenaMap = std::map<Key, T, Compare, ArenaAllocator<std::pair<const Key, T>>>;
+
+template <typename Key, typename T, typename Hash = std::hash<Key>>
+using ArenaUnorderedMap =
+    std::unordered_map<Key, T, Hash, std::equal_to<Key>, ArenaAllocator<std::pair<const Key, T>>>;
+
+} // namespace Shader
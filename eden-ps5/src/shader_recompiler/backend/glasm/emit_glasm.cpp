@@ -13,6 +13,7 @@
 #include "shader_recompiler/backend/glasm/glasm_emit_context.h"
 #include "shader_recompiler/frontend/ir/ir_emitter.h"
 #include "shader_recompiler/frontend/ir/program.h"
+#include "shader_recompiler/ir_opt/passes.h"
 #include "shader_recompiler/profile.h"
 #include "shader_recompiler/runtime_info.h"
 
@@ -400,6 +401,12 @@ std::string_view GetTessSpacing(TessSpacing spacing) {
 
 std::string EmitGLASM(const Profile& profile, const RuntimeInfo& runtime_info, IR::Program& program,
                       Bindings& bindings) {
+    if (profile.optimize_redundant_instructions) {
+        Optimization::LoopInvariantCodeMotionPass(program);
+        Optimization::GlobalValueNumberingPass(program);
+        Optimization::IdentityRemovalPass(program);
+        Optimization::DeadCodeEliminationPass(program);
+    }
     EmitContext ctx{program, bindings, profile, runtime_info};
     Precolor(program);
     EmitCode(ctx, program);
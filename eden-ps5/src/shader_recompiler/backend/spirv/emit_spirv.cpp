@@ -12,11 +12,13 @@
 #include <spirv-tools/optimizer.hpp>
 
 #include "common/settings.h"
+#include "shader_recompiler/arena.h"
 #include "shader_recompiler/backend/spirv/emit_spirv.h"
 #include "shader_recompiler/backend/spirv/emit_spirv_instructions.h"
 #include "shader_recompiler/backend/spirv/spirv_emit_context.h"
 #include "shader_recompiler/frontend/ir/basic_block.h"
 #include "shader_recompiler/frontend/ir/program.h"
+#include "shader_recompiler/ir_opt/passes.h"
 
 namespace Shader::Backend::SPIRV {
 namespace {
@@ -475,7 +477,7 @@ void SetupCapabilities(const Profile& profile, const Info& info, EmitContext& ct
 
 void PatchPhiNodes(IR::Program& program, EmitContext& ctx) {
             // Flatten all leading PHIs from each block into a vector
-            std::vector<IR::Inst*> phi_instructions;
+            ArenaVector<IR::Inst*> phi_instructions;
             for (IR::Block* block : program.blocks) {
                 for (auto it = block->begin(); it != block->end(); ++it) {
                     if (it->GetOpcode() != IR::Opcode::Phi)
@@ -503,6 +505,12 @@ void PatchPhiNodes(IR::Program& program, EmitContext& ctx) {
 
 std::vector<u32> EmitSPIRV(const Profile& profile, const RuntimeInfo& runtime_info,
                            IR::Program& program, Bindings& bindings, bool optimize) {
+    if (profile.optimize_redundant_instructions) {
+        Optimization::LoopInvariantCodeMotionPass(program);
+        Optimization::GlobalValueNumberingPass(program);
+        Optimization::IdentityRemovalPass(program);
+        Optimization::DeadCodeEliminationPass(program);
+    }
     EmitContext ctx{profile, runtime_info, program, bindings};
     const Id main{DefineMain(ctx, program)};
     DefineEntryPoint(program, ctx, main);
@@ -539,6 +547,30 @@ std::vector<u32> EmitSPIRV(const Profile& profile, const RuntimeInfo& runtime_in
     }
 }
 
+void AdvanceBindings(const Profile& profile, const Info& info, Bindings& bindings) {
+    const bool is_unified{profile.unified_descriptor_binding};
+    u32& uniform_binding{is_unified ? bindings.unified : bindings.uniform_buffer};
+    u32& storage_binding{is_unified ? bindings.unified : bindings.storage_buffer};
+    u32& texture_binding{is_unified ? bindings.unified : bindings.texture};
+    u32& image_binding{is_unified ? bindings.unified : bindings.image};
+    if (profile.support_descriptor_aliasing) {
+        uniform_binding += static_cast<u32>(info.constant_buffer_descriptors.size());
+    } else {
+        for (const ConstantBufferDescriptor& desc : info.constant_buffer_descriptors) {
+            uniform_binding += desc.count;
+        }
+    }
+    for (const StorageBufferDescriptor& desc : info.storage_buffers_descriptors) {
+        storage_binding += desc.count;
+    }
+    texture_binding += static_cast<u32>(info.texture_buffer_descriptors.size());
+    image_binding += static_cast<u32>(info.image_buffer_descriptors.size());
+    texture_binding += static_cast<u32>(info.texture_descriptors.size());
+    bindings.texture_scaling_index += static_cast<u32>(info.texture_descriptors.size());
+    image_binding += static_cast<u32>(info.image_descriptors.size());
+    bindings.image_scaling_index += static_cast<u32>(info.image_descriptors.size());
+}
+
 Id EmitPhi(EmitContext& ctx, IR::Inst* inst) {
     const size_t num_args{inst->NumArgs()};
     boost::container::small_vector<Id, 32> blocks;
@@ -36,6 +36,10 @@ constexpr u32 RENDERAREA_LAYOUT_OFFSET = offsetof(RenderAreaLayout, render_area)
 [[nodiscard]] std::vector<u32> EmitSPIRV(const Profile& profile, const RuntimeInfo& runtime_info,
                                          IR::Program& program, Bindings& bindings, bool optimize);
 
+/// Advances bindings past the descriptors of a program, the same way EmitSPIRV does.
+/// Lets the stages of a pipeline be emitted concurrently with their bindings known up front.
+void AdvanceBindings(const Profile& profile, const Info& info, Bindings& bindings);
+
 [[nodiscard]] inline std::vector<u32> EmitSPIRV(const Profile& profile, IR::Program& program,
                                                 bool optimize) {
     Bindings binding;
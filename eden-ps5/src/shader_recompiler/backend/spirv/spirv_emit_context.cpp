@@ -12,6 +12,7 @@
 
 #include "common/common_types.h"
 #include "common/div_ceil.h"
+#include "shader_recompiler/arena.h"
 #include "shader_recompiler/backend/spirv/emit_spirv.h"
 #include "shader_recompiler/backend/spirv/spirv_emit_context.h"
 
@@ -710,8 +711,8 @@ void EmitContext::DefineAttributeMemAccess(const Info& info) {
         const Id base_index{OpShiftRightArithmetic(U32[1], offset, Const(2U))};
         const Id masked_index{OpBitwiseAnd(U32[1], base_index, Const(3U))};
         const Id compare_index{OpShiftRightArithmetic(U32[1], base_index, Const(2U))};
-        std::vector<Sirit::Literal> literals;
-        std::vector<Id> labels;
+        ArenaVector<Sirit::Literal> literals;
+        ArenaVector<Id> labels;
         if (info.loads.AnyComponent(IR::Attribute::PositionX)) {
             literals.push_back(static_cast<u32>(IR::Attribute::PositionX) >> 2);
             labels.push_back(OpLabel());
@@ -798,8 +799,8 @@ void EmitContext::DefineAttributeMemAccess(const Info& info) {
         const Id base_index{OpShiftRightArithmetic(U32[1], offset, Const(2U))};
         const Id masked_index{OpBitwiseAnd(U32[1], base_index, Const(3U))};
         const Id compare_index{OpShiftRightArithmetic(U32[1], base_index, Const(2U))};
-        std::vector<Sirit::Literal> literals;
-        std::vector<Id> labels;
+        ArenaVector<Sirit::Literal> literals;
+        ArenaVector<Id> labels;
         if (info.stores.AnyComponent(IR::Attribute::PositionX)) {
             literals.push_back(static_cast<u32>(IR::Attribute::PositionX) >> 2);
             labels.push_back(OpLabel());
@@ -0,0 +1,112 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <limits>
+#include <utility>
+
+#include "shader_recompiler/exception.h"
+#include "shader_recompiler/frontend/ir/dominator_tree.h"
+
+namespace Shader::IR {
+namespace {
+constexpr u32 UNDEFINED = std::numeric_limits<u32>::max();
+} // Anonymous namespace
+
+DominatorTree::DominatorTree(const Program& program) {
+    blocks.assign(program.post_order_blocks.rbegin(), program.post_order_blocks.rend());
+    const u32 num_blocks{static_cast<u32>(blocks.size())};
+    if (num_blocks == 0) {
+        return;
+    }
+    indices.reserve(num_blocks);
+    for (u32 index = 0; index < num_blocks; ++index) {
+        indices.emplace(blocks[index], index);
+    }
+    nodes.resize(num_blocks, Node{UNDEFINED, 0, 0, {}});
+    nodes[0].idom = 0;
+
+    // "A Simple, Fast Dominance Algorithm" by Cooper, Harvey and Kennedy,
+    // using reverse post order indices so that dominators always have smaller indices
+    const auto intersect{[this](u32 lhs, u32 rhs) {
+        while (lhs != rhs) {
+            while (lhs > rhs) {
+                lhs = nodes[lhs].idom;
+            }
+            while (rhs > lhs) {
+                rhs = nodes[rhs].idom;
+            }
+        }
+        return lhs;
+    }};
+    bool changed{true};
+    while (changed) {
+        changed = false;
+        for (u32 index = 1; index < num_blocks; ++index) {
+            u32 new_idom{UNDEFINED};
+            for (const Block* const pred : blocks[index]->ImmPredecessors()) {
+                const auto it{indices.find(pred)};
+                if (it == indices.end() || nodes[it->second].idom == UNDEFINED) {
+                    continue;
+                }
+                new_idom = new_idom == UNDEFINED ? it->second : intersect(it->second, new_idom);
+            }
+            if (nodes[index].idom != new_idom) {
+                nodes[index].idom = new_idom;
+                changed = true;
+            }
+        }
+    }
+    for (u32 index = 1; index < num_blocks; ++index) {
+        nodes[nodes[index].idom].children.push_back(blocks[index]);
+    }
+
+    // Number the tree in pre and post order, so dominance queries are interval checks
+    ArenaVector<std::pair<u32, size_t>> stack;
+    stack.emplace_back(0, 0);
+    u32 counter{};
+    nodes[0].pre_order = counter++;
+    while (!stack.empty()) {
+        auto& [index, child] = stack.back();
+        Node& node{nodes[index]};
+        if (child == node.children.size()) {
+            node.post_order = counter++;
+            stack.pop_back();
+            continue;
+        }
+        const u32 child_index{indices.at(node.children[child++])};
+        nodes[child_index].pre_order = counter++;
+        stack.emplace_back(child_index, 0);
+    }
+}
+
+bool DominatorTree::IsReachable(const Block* block) const {
+    return indices.contains(block);
+}
+
+bool DominatorTree::Dominates(const Block* dominator, const Block* block) const {
+    const Node& lhs{GetNode(dominator)};
+    const Node& rhs{GetNode(block)};
+    return lhs.pre_order <= rhs.pre_order && rhs.post_order <= lhs.post_order;
+}
+
+Block* DominatorTree::ImmediateDominator(const Block* block) const {
+    const Node& node{GetNode(block)};
+    if (block == Root()) {
+        return nullptr;
+    }
+    return blocks[node.idom];
+}
+
+std::span<Block* const> DominatorTree::Children(const Block* block) const {
+    return GetNode(block).children;
+}
+
+const DominatorTree::Node& DominatorTree::GetNode(const Block* block) const {
+    const auto it{indices.find(block)};
+    if (it == indices.end()) {
+        throw LogicError("Block is not reachable from the entry");
+    }
+    return nodes[it->second];
+}
+
+} // namespace Shader::IR
@@ -0,0 +1,58 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <span>
+
+#include "common/common_types.h"
+#include "shader_recompiler/arena.h"
+#include "shader_recompiler/frontend/ir/basic_block.h"
+#include "shader_recompiler/frontend/ir/program.h"
+
+namespace Shader::IR {
+
+/// Dominator tree of the blocks of a program reachable from its entry.
+class DominatorTree {
+public:
+    explicit DominatorTree(const Program& program);
+
+    /// Returns the entry block of the program.
+    [[nodiscard]] Block* Root() const noexcept {
+        return blocks.empty() ? nullptr : blocks.front();
+    }
+
+    /// Returns true when the block can be reached from the entry.
+    [[nodiscard]] bool IsReachable(const Block* block) const;
+
+    /// Returns true when every path from the entry to block goes through dominator.
+    /// A block dominates itself.
+    [[nodiscard]] bool Dominates(const Block* dominator, const Block* block) const;
+
+    /// Returns the immediate dominator of a block, or nullptr for the entry.
+    [[nodiscard]] Block* ImmediateDominator(const Block* block) const;
+
+    /// Returns the blocks immediately dominated by a block.
+    [[nodiscard]] std::span<Block* const> Children(const Block* block) const;
+
+    /// Returns the reachable blocks in reverse post order.
+    [[nodiscard]] std::span<Block* const> ReversePostOrder() const noexcept {
+        return blocks;
+    }
+
+private:
+    struct Node {
+        u32 idom;
+        u32 pre_order;
+        u32 post_order;
+        ArenaVector<Block*> children;
+    };
+
+    [[nodiscard]] const Node& GetNode(const Block* block) const;
+
+    ArenaVector<Block*> blocks;
+    ArenaVector<Node> nodes;
+    ArenaUnorderedMap<const Block*, u32> indices;
+};
+
+} // namespace Shader::IR
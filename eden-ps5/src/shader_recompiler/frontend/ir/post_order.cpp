@@ -2,10 +2,12 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <algorithm>
+#include <functional>
 
 #include <boost/container/flat_set.hpp>
 #include <boost/container/small_vector.hpp>
 
+#include "shader_recompiler/arena.h"
 #include "shader_recompiler/frontend/ir/basic_block.h"
 #include "shader_recompiler/frontend/ir/post_order.h"
 
@@ -13,7 +15,7 @@ namespace Shader::IR {
 
 BlockList PostOrder(const AbstractSyntaxNode& root) {
     boost::container::small_vector<Block*, 16> block_stack;
-    boost::container::flat_set<Block*> visited;
+    boost::container::flat_set<Block*, std::less<Block*>, ArenaAllocator<Block*>> visited;
     BlockList post_order_blocks;
 
     if (root.type != AbstractSyntaxNode::Type::Block) {
@@ -4,15 +4,14 @@
 #include <algorithm>
 #include <memory>
 #include <string>
-#include <unordered_map>
 #include <utility>
-#include <vector>
 
 #include <fmt/ranges.h>
 
 #include <boost/intrusive/list.hpp>
 
 #include "common/polyfill_ranges.h"
+#include "shader_recompiler/arena.h"
 #include "shader_recompiler/environment.h"
 #include "shader_recompiler/frontend/ir/basic_block.h"
 #include "shader_recompiler/frontend/ir/ir_emitter.h"
@@ -312,7 +311,7 @@ bool NeedsLift(Node goto_stmt, Node label_stmt) noexcept {
 class GotoPass {
 public:
     explicit GotoPass(Flow::CFG& cfg, ObjectPool<Statement>& stmt_pool) : pool{stmt_pool} {
-        std::vector gotos{BuildTree(cfg)};
+        ArenaVector<Node> gotos{BuildTree(cfg)};
         const auto end{gotos.rend()};
         for (auto goto_stmt = gotos.rbegin(); goto_stmt != end; ++goto_stmt) {
             RemoveGoto(*goto_stmt);
@@ -374,20 +373,20 @@ private:
         }
     }
 
-    std::vector<Node> BuildTree(Flow::CFG& cfg) {
+    ArenaVector<Node> BuildTree(Flow::CFG& cfg) {
         u32 label_id{0};
-        std::vector<Node> gotos;
+        ArenaVector<Node> gotos;
         Flow::Function& first_function{cfg.Functions().front()};
         BuildTree(cfg, first_function, label_id, gotos, root_stmt.children.end(), std::nullopt);
         return gotos;
     }
 
     void BuildTree(Flow::CFG& cfg, Flow::Function& function, u32& label_id,
-                   std::vector<Node>& gotos, Node function_insert_point,
+                   ArenaVector<Node>& gotos, Node function_insert_point,
                    std::optional<Node> return_label) {
         Statement* const false_stmt{pool.Create(Identity{}, IR::Condition{false}, &root_stmt)};
         Tree& root{root_stmt.children};
-        std::unordered_map<Flow::Block*, Node> local_labels;
+        ArenaUnorderedMap<Flow::Block*, Node> local_labels;
         local_labels.reserve(function.blocks.size());
 
         for (Flow::Block& block : function.blocks) {
@@ -867,8 +866,8 @@ private:
 
     void DemoteCombinationPass() {
         using Type = IR::AbstractSyntaxNode::Type;
-        std::vector<IR::Block*> demote_blocks;
-        std::vector<IR::U1> demote_conds;
+        ArenaVector<IR::Block*> demote_blocks;
+        ArenaVector<IR::U1> demote_conds;
         u32 num_epilogues{};
         u32 branch_depth{};
         for (const IR::AbstractSyntaxNode& node : syntax_list) {
@@ -0,0 +1,196 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <array>
+#include <bit>
+#include <utility>
+
+#include "common/common_types.h"
+#include "shader_recompiler/arena.h"
+#include "shader_recompiler/frontend/ir/basic_block.h"
+#include "shader_recompiler/frontend/ir/dominator_tree.h"
+#include "shader_recompiler/frontend/ir/value.h"
+#include "shader_recompiler/ir_opt/passes.h"
+
+namespace Shader::Optimization {
+namespace {
+constexpr size_t MAX_ARGS = 5;
+
+struct ValueKey {
+    IR::Opcode opcode;
+    u32 flags;
+    std::array<IR::Value, MAX_ARGS> args;
+
+    bool operator==(const ValueKey& other) const {
+        return opcode == other.opcode && flags == other.flags && args == other.args;
+    }
+};
+
+u64 ValueBits(const IR::Value& value) {
+    if (!value.IsImmediate()) {
+        return std::bit_cast<u64>(value.Inst());
+    }
+    switch (value.Type()) {
+    case IR::Type::Void:
+        return 0;
+    case IR::Type::Reg:
+        return static_cast<u64>(value.Reg());
+    case IR::Type::Pred:
+        return static_cast<u64>(value.Pred());
+    case IR::Type::Attribute:
+        return static_cast<u64>(value.Attribute());
+    case IR::Type::Patch:
+        return static_cast<u64>(value.Patch());
+    case IR::Type::U1:
+        return value.U1() ? 1 : 0;
+    case IR::Type::U8:
+        return value.U8();
+    case IR::Type::U16:
+    case IR::Type::F16:
+        return value.U16();
+    case IR::Type::U32:
+    case IR::Type::F32:
+        return value.U32();
+    case IR::Type::U64:
+    case IR::Type::F64:
+        return value.U64();
+    default:
+        return 0;
+    }
+}
+
+struct ValueKeyHash {
+    size_t operator()(const ValueKey& key) const noexcept {
+        size_t hash{static_cast<size_t>(key.opcode) ^ (static_cast<size_t>(key.flags) << 16)};
+        for (const IR::Value& arg : key.args) {
+            hash = hash * 31 + static_cast<size_t>(arg.Type());
+            hash = hash * 31 + static_cast<size_t>(ValueBits(arg));
+        }
+        return hash;
+    }
+};
+
+bool IsNumberable(const IR::Program& program, const IR::Inst& inst) {
+    if (inst.MayHaveSideEffects() || inst.IsPseudoInstruction() ||
+        inst.HasAssociatedPseudoOperation() || inst.NumArgs() > MAX_ARGS) {
+        return false;
+    }
+    switch (inst.GetOpcode()) {
+    case IR::Opcode::Phi:
+    case IR::Opcode::Identity:
+    case IR::Opcode::Void:
+    // Memory that may be written by the shader
+    case IR::Opcode::LoadGlobalU8:
+    case IR::Opcode::LoadGlobalS8:
+    case IR::Opcode::LoadGlobalU16:
+    case IR::Opcode::LoadGlobalS16:
+    case IR::Opcode::LoadGlobal32:
+    case IR::Opcode::LoadGlobal64:
+    case IR::Opcode::LoadGlobal128:
+    case IR::Opcode::LoadStorageU8:
+    case IR::Opcode::LoadStorageS8:
+    case IR::Opcode::LoadStorageU16:
+    case IR::Opcode::LoadStorageS16:
+    case IR::Opcode::LoadStorage32:
+    case IR::Opcode::LoadStorage64:
+    case IR::Opcode::LoadStorage128:
+    case IR::Opcode::LoadLocal:
+    case IR::Opcode::LoadSharedU8:
+    case IR::Opcode::LoadSharedS8:
+    case IR::Opcode::LoadSharedU16:
+    case IR::Opcode::LoadSharedS16:
+    case IR::Opcode::LoadSharedU32:
+    case IR::Opcode::LoadSharedU64:
+    case IR::Opcode::LoadSharedU128:
+    case IR::Opcode::ImageRead:
+    case IR::Opcode::BindlessImageRead:
+    case IR::Opcode::BoundImageRead:
+    case IR::Opcode::GetPatch:
+    // Results that depend on the active invocations or on demotion
+    case IR::Opcode::IsHelperInvocation:
+    case IR::Opcode::VoteAll:
+    case IR::Opcode::VoteAny:
+    case IR::Opcode::VoteEqual:
+    case IR::Opcode::SubgroupBallot:
+    case IR::Opcode::ShuffleIndex:
+    case IR::Opcode::ShuffleUp:
+    case IR::Opcode::ShuffleDown:
+    case IR::Opcode::ShuffleButterfly:
+    case IR::Opcode::FSwizzleAdd:
+    case IR::Opcode::DPdxFine:
+    case IR::Opcode::DPdyFine:
+    case IR::Opcode::DPdxCoarse:
+    case IR::Opcode::DPdyCoarse:
+        return false;
+    case IR::Opcode::GetAttribute:
+    case IR::Opcode::GetAttributeU32:
+    case IR::Opcode::GetAttributeIndexed:
+        // Tessellation control shaders can read back the outputs they write
+        return program.stage != Stage::TessellationControl;
+    default:
+        return true;
+    }
+}
+
+ValueKey MakeKey(const IR::Inst& inst) {
+    ValueKey key{
+        .opcode = inst.GetOpcode(),
+        .flags = inst.Flags<u32>(),
+        .args{},
+    };
+    const size_t num_args{inst.NumArgs()};
+    for (size_t index = 0; index < num_args; ++index) {
+        key.args[index] = inst.Arg(index).Resolve();
+    }
+    return key;
+}
+} // Anonymous namespace
+
+void GlobalValueNumberingPass(IR::Program& program) {
+    const IR::DominatorTree dom_tree{program};
+    IR::Block* const root{dom_tree.Root()};
+    if (!root) {
+        return;
+    }
+    // Values available in a block are the ones computed in the blocks dominating it. The tree is
+    // walked in pre order, and the values of a subtree are forgotten when the walk leaves it.
+    ArenaUnorderedMap<ValueKey, IR::Inst*, ValueKeyHash> available;
+    ArenaVector<ValueKey> inserted;
+    struct Frame {
+        IR::Block* block;
+        size_t next_child;
+        size_t inserted_mark;
+    };
+    ArenaVector<Frame> stack;
+    const auto visit{[&](IR::Block* block) {
+        stack.push_back(Frame{block, 0, inserted.size()});
+        for (IR::Inst& inst : block->Instructions()) {
+            if (!IsNumberable(program, inst)) {
+                continue;
+            }
+            ValueKey key{MakeKey(inst)};
+            const auto [it, is_new] = available.try_emplace(key, &inst);
+            if (is_new) {
+                inserted.push_back(std::move(key));
+            } else {
+                inst.ReplaceUsesWith(IR::Value{it->second});
+            }
+        }
+    }};
+    visit(root);
+    while (!stack.empty()) {
+        Frame& frame{stack.back()};
+        const std::span<IR::Block* const> children{dom_tree.Children(frame.block)};
+        if (frame.next_child < children.size()) {
+            visit(children[frame.next_child++]);
+            continue;
+        }
+        while (inserted.size() > frame.inserted_mark) {
+            available.erase(inserted.back());
+            inserted.pop_back();
+        }
+        stack.pop_back();
+    }
+}
+
+} // namespace Shader::Optimization
@@ -0,0 +1,209 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <algorithm>
+#include <functional>
+#include <unordered_set>
+
+#include "shader_recompiler/arena.h"
+#include "shader_recompiler/frontend/ir/basic_block.h"
+#include "shader_recompiler/frontend/ir/dominator_tree.h"
+#include "shader_recompiler/frontend/ir/value.h"
+#include "shader_recompiler/ir_opt/passes.h"
+
+namespace Shader::Optimization {
+namespace {
+template <typename T>
+using ArenaSet = std::unordered_set<T, std::hash<T>, std::equal_to<T>, ArenaAllocator<T>>;
+
+struct Loop {
+    IR::Block* header;
+    IR::Block* preheader;
+    ArenaSet<IR::Block*> body;
+};
+
+/// Returns true for instructions that can be executed speculatively before the loop.
+/// Only arithmetic and read-only loads qualify; texture instructions are left in place because
+/// their implicit derivatives depend on the control flow they execute in.
+bool IsHoistable(const IR::Program& program, const IR::Inst& inst) {
+    if (inst.MayHaveSideEffects() || inst.IsPseudoInstruction() ||
+        inst.HasAssociatedPseudoOperation()) {
+        return false;
+    }
+    switch (inst.GetOpcode()) {
+    case IR::Opcode::Phi:
+    case IR::Opcode::Identity:
+    case IR::Opcode::Void:
+    case IR::Opcode::LoadGlobalU8:
+    case IR::Opcode::LoadGlobalS8:
+    case IR::Opcode::LoadGlobalU16:
+    case IR::Opcode::LoadGlobalS16:
+    case IR::Opcode::LoadGlobal32:
+    case IR::Opcode::LoadGlobal64:
+    case IR::Opcode::LoadGlobal128:
+    case IR::Opcode::LoadStorageU8:
+    case IR::Opcode::LoadStorageS8:
+    case IR::Opcode::LoadStorageU16:
+    case IR::Opcode::LoadStorageS16:
+    case IR::Opcode::LoadStorage32:
+    case IR::Opcode::LoadStorage64:
+    case IR::Opcode::LoadStorage128:
+    case IR::Opcode::LoadLocal:
+    case IR::Opcode::LoadSharedU8:
+    case IR::Opcode::LoadSharedS8:
+    case IR::Opcode::LoadSharedU16:
+    case IR::Opcode::LoadSharedS16:
+    case IR::Opcode::LoadSharedU32:
+    case IR::Opcode::LoadSharedU64:
+    case IR::Opcode::LoadSharedU128:
+    case IR::Opcode::GetPatch:
+    case IR::Opcode::IsHelperInvocation:
+    case IR::Opcode::VoteAll:
+    case IR::Opcode::VoteAny:
+    case IR::Opcode::VoteEqual:
+    case IR::Opcode::SubgroupBallot:
+    case IR::Opcode::ShuffleIndex:
+    case IR::Opcode::ShuffleUp:
+    case IR::Opcode::ShuffleDown:
+    case IR::Opcode::ShuffleButterfly:
+    case IR::Opcode::FSwizzleAdd:
+    case IR::Opcode::DPdxFine:
+    case IR::Opcode::DPdyFine:
+    case IR::Opcode::DPdxCoarse:
+    case IR::Opcode::DPdyCoarse:
+    case IR::Opcode::BindlessImageSampleImplicitLod:
+    case IR::Opcode::BindlessImageSampleExplicitLod:
+    case IR::Opcode::BindlessImageSampleDrefImplicitLod:
+    case IR::Opcode::BindlessImageSampleDrefExplicitLod:
+    case IR::Opcode::BindlessImageGather:
+    case IR::Opcode::BindlessImageGatherDref:
+    case IR::Opcode::BindlessImageFetch:
+    case IR::Opcode::BindlessImageQueryDimensions:
+    case IR::Opcode::BindlessImageQueryLod:
+    case IR::Opcode::BindlessImageGradient:
+    case IR::Opcode::BindlessImageRead:
+    case IR::Opcode::BoundImageSampleImplicitLod:
+    case IR::Opcode::BoundImageSampleExplicitLod:
+    case IR::Opcode::BoundImageSampleDrefImplicitLod:
+    case IR::Opcode::BoundImageSampleDrefExplicitLod:
+    case IR::Opcode::BoundImageGather:
+    case IR::Opcode::BoundImageGatherDref:
+    case IR::Opcode::BoundImageFetch:
+    case IR::Opcode::BoundImageQueryDimensions:
+    case IR::Opcode::BoundImageQueryLod:
+    case IR::Opcode::BoundImageGradient:
+    case IR::Opcode::BoundImageRead:
+    case IR::Opcode::ImageSampleImplicitLod:
+    case IR::Opcode::ImageSampleExplicitLod:
+    case IR::Opcode::ImageSampleDrefImplicitLod:
+    case IR::Opcode::ImageSampleDrefExplicitLod:
+    case IR::Opcode::ImageGather:
+    case IR::Opcode::ImageGatherDref:
+    case IR::Opcode::ImageFetch:
+    case IR::Opcode::ImageQueryDimensions:
+    case IR::Opcode::ImageQueryLod:
+    case IR::Opcode::ImageGradient:
+    case IR::Opcode::ImageRead:
+        return false;
+    case IR::Opcode::GetAttribute:
+    case IR::Opcode::GetAttributeU32:
+    case IR::Opcode::GetAttributeIndexed:
+        return program.stage != Stage::TessellationControl;
+    default:
+        return true;
+    }
+}
+
+ArenaVector<Loop> FindLoops(const IR::DominatorTree& dom_tree) {
+    ArenaVector<Loop> loops;
+    for (IR::Block* const header : dom_tree.ReversePostOrder()) {
+        ArenaVector<IR::Block*> worklist;
+        for (IR::Block* const pred : header->ImmPredecessors()) {
+            if (dom_tree.IsReachable(pred) && dom_tree.Dominates(header, pred)) {
+                worklist.push_back(pred);
+            }
+        }
+        if (worklist.empty()) {
+            continue;
+        }
+        // Collect the natural loop of every back edge into the header
+        Loop loop{header, nullptr, {}};
+        loop.body.insert(header);
+        while (!worklist.empty()) {
+            IR::Block* const block{worklist.back()};
+            worklist.pop_back();
+            if (!loop.body.insert(block).second) {
+                continue;
+            }
+            for (IR::Block* const pred : block->ImmPredecessors()) {
+                if (dom_tree.IsReachable(pred)) {
+                    worklist.push_back(pred);
+                }
+            }
+        }
+        // Hoisting needs a single block that enters the loop
+        for (IR::Block* const pred : header->ImmPredecessors()) {
+            if (loop.body.contains(pred) || !dom_tree.IsReachable(pred)) {
+                continue;
+            }
+            if (loop.preheader) {
+                loop.preheader = nullptr;
+                break;
+            }
+            loop.preheader = pred;
+        }
+        if (loop.preheader) {
+            loops.push_back(std::move(loop));
+        }
+    }
+    // Inner loops first, so their invariants can keep moving out through the outer loops
+    std::ranges::sort(loops, {}, [](const Loop& loop) { return loop.body.size(); });
+    return loops;
+}
+
+void HoistInvariants(const IR::Program& program, const IR::DominatorTree& dom_tree,
+                     const Loop& loop) {
+    ArenaSet<const IR::Inst*> loop_insts;
+    for (IR::Block* const block : loop.body) {
+        for (const IR::Inst& inst : block->Instructions()) {
+            loop_insts.insert(&inst);
+        }
+    }
+    const auto is_invariant{[&](const IR::Value& value) {
+        const IR::Value resolved{value.Resolve()};
+        return resolved.IsImmediate() || !loop_insts.contains(resolved.Inst());
+    }};
+    IR::Block::InstructionList& preheader_insts{loop.preheader->Instructions()};
+    // Visit the body in reverse post order so operands are hoisted before their users
+    for (IR::Block* const block : dom_tree.ReversePostOrder()) {
+        if (!loop.body.contains(block)) {
+            continue;
+        }
+        IR::Block::InstructionList& insts{block->Instructions()};
+        for (auto it = insts.begin(); it != insts.end();) {
+            IR::Inst& inst{*it};
+            bool invariant{IsHoistable(program, inst)};
+            const size_t num_args{inst.NumArgs()};
+            for (size_t index = 0; invariant && index < num_args; ++index) {
+                invariant = is_invariant(inst.Arg(index));
+            }
+            if (!invariant) {
+                ++it;
+                continue;
+            }
+            it = insts.erase(it);
+            preheader_insts.insert(preheader_insts.end(), inst);
+            loop_insts.erase(&inst);
+        }
+    }
+}
+} // Anonymous namespace
+
+void LoopInvariantCodeMotionPass(IR::Program& program) {
+    const IR::DominatorTree dom_tree{program};
+    for (const Loop& loop : FindLoops(dom_tree)) {
+        HoistInvariants(program, dom_tree, loop);
+    }
+}
+
+} // namespace Shader::Optimization
@@ -58,6 +58,8 @@ struct Profile {
     /// coordinates with the 16.8 format in the ImageGather instruction than the Maxwell
     /// architecture. Applying an offset does fix this mismatching rounding behaviour.
     bool need_gather_subpixel_offset{};
+    /// Runs global value numbering and loop invariant code motion on the IR before emitting it
+    bool optimize_redundant_instructions{};
 
     /// OpFClamp is broken and OpFMax + OpFMin should be used instead
     bool has_broken_spirv_clamp{};
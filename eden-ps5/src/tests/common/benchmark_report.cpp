@@ -0,0 +1,63 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <chrono>
+#include <string>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/benchmark_report.h"
+
+using namespace Common;
+
+namespace {
+BenchmarkReport MakeReport() {
+    using namespace std::chrono_literals;
+    BenchmarkReport report{};
+    report.program_id = 0x0100000000010000;
+    report.frames_requested = 4;
+    report.frames_run = 4;
+    report.wall_time = 2s;
+    report.frametimes = {20.0, 10.0, 40.0, 30.0};
+    report.subsystem_totals[static_cast<size_t>(Subsystem::Audio)] = {3, 500ms};
+    return report;
+}
+} // Anonymous namespace
+
+TEST_CASE("BenchmarkReport::Header", "[common]") {
+    const std::string formatted = FormatBenchmarkReport(MakeReport());
+    REQUIRE(formatted.starts_with("{\n"));
+    REQUIRE(formatted.ends_with("  }\n}\n"));
+    REQUIRE(formatted.find("  \"program_id\": \"0100000000010000\",\n") != std::string::npos);
+    REQUIRE(formatted.find("  \"multi_core\": false,\n") != std::string::npos);
+    REQUIRE(formatted.find("  \"frames_requested\": 4,\n") != std::string::npos);
+    REQUIRE(formatted.find("  \"frames\": 4,\n") != std::string::npos);
+    REQUIRE(formatted.find("  \"completed\": true,\n") != std::string::npos);
+    REQUIRE(formatted.find("  \"wall_time_ms\": 2000.000,\n") != std::string::npos);
+
+    // The run configuration precedes the results
+    REQUIRE(formatted.find("\"multi_core\"") < formatted.find("\"frames\""));
+}
+
+TEST_CASE("BenchmarkReport::Frametimes", "[common]") {
+    const std::string formatted = FormatBenchmarkReport(MakeReport());
+    REQUIRE(formatted.find("  \"frametime_ms\": {\"mean\": 25.000, \"p50\": 20.000, \"p99\": "
+                           "30.000, \"max\": 40.000},\n") != std::string::npos);
+
+    BenchmarkReport incomplete = MakeReport();
+    incomplete.frames_run = 2;
+    incomplete.frametimes.clear();
+    const std::string empty = FormatBenchmarkReport(incomplete);
+    REQUIRE(empty.find("  \"completed\": false,\n") != std::string::npos);
+    REQUIRE(empty.find("  \"frametime_ms\": {\"mean\": 0.000, \"p50\": 0.000, \"p99\": 0.000, "
+                       "\"max\": 0.000},\n") != std::string::npos);
+}
+
+TEST_CASE("BenchmarkReport::Subsystems", "[common]") {
+    const std::string formatted = FormatBenchmarkReport(MakeReport());
+    REQUIRE(formatted.find("    \"audio\": {\"time_ms\": 500.000, \"ms_per_s\": 250.000, "
+                           "\"count\": 3},\n") != std::string::npos);
+    // The last subsystem closes the object without a trailing comma
+    REQUIRE(formatted.find("    \"hid\": {\"time_ms\": 0.000, \"ms_per_s\": 0.000, "
+                           "\"count\": 0}\n  }\n") != std::string::npos);
+}
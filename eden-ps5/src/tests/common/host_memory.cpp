@@ -1,8 +1,16 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2021 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 
+#include <cstring>
+#include <random>
+
+#include "common/host_mapping_batch.h"
 #include "common/host_memory.h"
 #include "common/literals.h"
 
@@ -184,3 +192,141 @@ TEST_CASE("HostMemory: Partial sparse middle unmap and check bindings", "[common
     REQUIRE(ptr[0x0000] == 19);
     REQUIRE(ptr[0x3fff] == 12);
 }
+
+TEST_CASE("HostMemory: Huge page backing keeps 4K mappings working", "[common]") {
+    HostMemory mem(BACKING_SIZE, VIRTUAL_SIZE, {.huge_pages = true, .numa_local = true});
+    mem.Map(0x200000, 0x400000, 0x400000, PERMS, HEAP);
+    mem.Map(0x5000, 0x401000, 0x1000, PERMS, HEAP);
+
+    volatile u8* const data = mem.VirtualBasePointer();
+    data[0x201000] = 42;
+    REQUIRE(data[0x5000] == 42);
+    REQUIRE(mem.BackingBasePointer()[0x401000] == 42);
+
+    mem.Unmap(0x200000, 0x400000, HEAP);
+    REQUIRE(data[0x5000] == 42);
+}
+
+TEST_CASE("HostMappingBatch: Adjacent operations are coalesced", "[common]") {
+    HostMemory mem(BACKING_SIZE, VIRTUAL_SIZE);
+    Common::HostMappingBatch batch;
+    for (size_t offset = 0; offset < 0x10000; offset += 0x1000) {
+        batch.Map(0x100000 + offset, 0x20000 + offset, 0x1000, PERMS, HEAP);
+    }
+    REQUIRE(batch.NumPending() == 1);
+
+    // Different host offset and permissions start new operations.
+    batch.Map(0x110000, 0x80000, 0x1000, PERMS, HEAP);
+    batch.Protect(0x100000, 0x1000, Common::MemoryPermission::Read);
+    batch.Protect(0x101000, 0x1000, Common::MemoryPermission::Read);
+    REQUIRE(batch.NumPending() == 3);
+
+    // Both maps and protects are reported, so the caller can restore cached page protections.
+    size_t updated_bytes = 0;
+    batch.Flush(mem, [&](size_t, size_t length) { updated_bytes += length; });
+    REQUIRE(batch.Empty());
+    REQUIRE(updated_bytes == 0x13000);
+
+    volatile u8* const data = mem.VirtualBasePointer();
+    data[0x10f000] = 7;
+    data[0x110000] = 9;
+    REQUIRE(mem.BackingBasePointer()[0x2f000] == 7);
+    REQUIRE(mem.BackingBasePointer()[0x80000] == 9);
+}
+
+TEST_CASE("HostMappingBatch: Operations keep their order", "[common]") {
+    HostMemory mem(BACKING_SIZE, VIRTUAL_SIZE);
+    Common::HostMappingBatch batch;
+    batch.Map(0x4000, 0x10000, 0x2000, PERMS, HEAP);
+    batch.Unmap(0x4000, 0x1000, HEAP);
+    batch.Unmap(0x5000, 0x1000, HEAP);
+    batch.Map(0x4000, 0x30000, 0x2000, PERMS, HEAP);
+    REQUIRE(batch.NumPending() == 3);
+    batch.Flush(mem);
+
+    volatile u8* const data = mem.VirtualBasePointer();
+    data[0x5000] = 3;
+    REQUIRE(mem.BackingBasePointer()[0x31000] == 3);
+}
+
+// Benchmarks are hidden from the default run. Use `tests "[benchmark]"` to run them.
+namespace {
+
+constexpr size_t BENCH_REGION_SIZE = 256_MiB;
+constexpr size_t BENCH_BLOCK_SIZE = 2_MiB;
+
+void MapUnmapChurn(HostMemory& mem) {
+    for (size_t offset = 0; offset < BENCH_REGION_SIZE; offset += BENCH_BLOCK_SIZE) {
+        mem.Map(offset, offset, BENCH_BLOCK_SIZE, PERMS, HEAP);
+    }
+    for (size_t offset = 0; offset < BENCH_REGION_SIZE; offset += BENCH_BLOCK_SIZE) {
+        mem.Unmap(offset, BENCH_BLOCK_SIZE, HEAP);
+    }
+}
+
+/// Random 8-byte loads across a large mapped region, like fastmem accesses from JIT code.
+u64 RandomAccess(HostMemory& mem, size_t count) {
+    std::mt19937_64 rng{1234};
+    const u64* const base = reinterpret_cast<const u64*>(mem.VirtualBasePointer());
+    u64 sum = 0;
+    for (size_t i = 0; i < count; i++) {
+        sum += base[rng() % (BENCH_REGION_SIZE / sizeof(u64))];
+    }
+    return sum;
+}
+
+/// Maps a region one page table block at a time and then unmaps it, as MapPhysicalMemory and
+/// UnmapPhysicalMemory do for fragmented physical memory.
+template <typename Sink>
+void BlockwiseMapUnmap(Sink& sink) {
+    constexpr size_t block_size = 64_KiB;
+    for (size_t offset = 0; offset < BENCH_REGION_SIZE; offset += block_size) {
+        sink.Map(offset, offset, block_size, PERMS, HEAP);
+    }
+    for (size_t offset = 0; offset < BENCH_REGION_SIZE; offset += block_size) {
+        sink.Unmap(offset, block_size, HEAP);
+    }
+}
+
+} // Anonymous namespace
+
+TEST_CASE("HostMemory: Map/unmap churn", "[.][benchmark]") {
+    HostMemory mem_small(BACKING_SIZE, VIRTUAL_SIZE);
+    HostMemory mem_huge(BACKING_SIZE, VIRTUAL_SIZE, {.huge_pages = true});
+
+    BENCHMARK("4K pages") {
+        MapUnmapChurn(mem_small);
+    };
+    BENCHMARK("Huge pages") {
+        MapUnmapChurn(mem_huge);
+    };
+}
+
+TEST_CASE("HostMemory: Random access throughput", "[.][benchmark]") {
+    HostMemory mem_small(BACKING_SIZE, VIRTUAL_SIZE);
+    HostMemory mem_huge(BACKING_SIZE, VIRTUAL_SIZE, {.huge_pages = true});
+    for (HostMemory* mem : {&mem_small, &mem_huge}) {
+        mem->Map(0, 0, BENCH_REGION_SIZE, PERMS, HEAP);
+        std::memset(mem->VirtualBasePointer(), 1, BENCH_REGION_SIZE);
+    }
+
+    BENCHMARK("4K pages") {
+        return RandomAccess(mem_small, 1 << 20);
+    };
+    BENCHMARK("Huge pages") {
+        return RandomAccess(mem_huge, 1 << 20);
+    };
+}
+
+TEST_CASE("HostMappingBatch: Blockwise map/unmap", "[.][benchmark]") {
+    HostMemory mem(BACKING_SIZE, VIRTUAL_SIZE);
+    Common::HostMappingBatch batch;
+
+    BENCHMARK("Direct") {
+        BlockwiseMapUnmap(mem);
+    };
+    BENCHMARK("Batched") {
+        BlockwiseMapUnmap(batch);
+        batch.Flush(mem);
+    };
+}
@@ -0,0 +1,90 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <array>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "common/seqlock.h"
+
+namespace {
+struct Sample {
+    u32 id;
+    std::array<u32, 5> values;
+    bool flag;
+};
+} // Anonymous namespace
+
+TEST_CASE("SeqLock: Publish", "[common]") {
+    Common::SeqLock<Sample> seqlock;
+    REQUIRE(seqlock.Read().id == 0);
+
+    const u64 version = seqlock.Version();
+    seqlock.Write({.id = 7, .values = {1, 2, 3, 4, 5}, .flag = true});
+    REQUIRE(seqlock.Version() != version);
+
+    const auto sample = seqlock.Read();
+    REQUIRE(sample.id == 7);
+    REQUIRE(sample.values[4] == 5);
+    REQUIRE(sample.flag);
+}
+
+TEST_CASE("SeqLock: Consistent reads", "[common]") {
+    static constexpr u32 NumWrites = 200'000;
+    Common::SeqLock<Sample> seqlock;
+    std::atomic<bool> done{false};
+    std::atomic<bool> torn{false};
+
+    std::vector<std::jthread> readers;
+    for (int i = 0; i < 3; ++i) {
+        readers.emplace_back([&] {
+            u32 last_id = 0;
+            while (!done.load(std::memory_order_relaxed)) {
+                const auto sample = seqlock.Read();
+                for (const u32 value : sample.values) {
+                    if (value != sample.id) {
+                        torn = true;
+                    }
+                }
+                if (sample.flag != (sample.id % 2 == 1) || sample.id < last_id) {
+                    torn = true;
+                }
+                last_id = sample.id;
+            }
+        });
+    }
+
+    for (u32 id = 1; id <= NumWrites; ++id) {
+        seqlock.Write({.id = id, .values = {id, id, id, id, id}, .flag = id % 2 == 1});
+    }
+    done = true;
+    readers.clear();
+
+    REQUIRE(!torn);
+    REQUIRE(seqlock.Read().id == NumWrites);
+}
+
+TEST_CASE("SeqLock: Concurrent writers", "[common]") {
+    static constexpr u32 NumWrites = 50'000;
+    Common::SeqLock<Sample> seqlock;
+    {
+        std::vector<std::jthread> writers;
+        for (u32 writer = 0; writer < 4; ++writer) {
+            writers.emplace_back([&seqlock, writer] {
+                for (u32 i = 0; i < NumWrites; ++i) {
+                    const u32 id = writer * NumWrites + i;
+                    seqlock.Write({.id = id, .values = {id, id, id, id, id}, .flag = id % 2 == 1});
+                }
+            });
+        }
+    }
+    const auto sample = seqlock.Read();
+    for (const u32 value : sample.values) {
+        REQUIRE(value == sample.id);
+    }
+    REQUIRE(sample.flag == (sample.id % 2 == 1));
+}
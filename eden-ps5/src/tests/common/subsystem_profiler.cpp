@@ -0,0 +1,54 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <chrono>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/subsystem_profiler.h"
+
+using namespace Common;
+
+namespace {
+void TimeAudioScope() {
+    const ScopedSubsystemTimer timer{Subsystem::Audio};
+}
+} // Anonymous namespace
+
+TEST_CASE("SubsystemProfiler::Enable", "[common]") {
+    SubsystemProfiler::Reset();
+    SubsystemProfiler::SetEnabled(false);
+    TimeAudioScope();
+    REQUIRE(SubsystemProfiler::GetTotals()[static_cast<size_t>(Subsystem::Audio)].count == 0);
+
+    SubsystemProfiler::SetEnabled(true);
+    TimeAudioScope();
+    TimeAudioScope();
+    SubsystemProfiler::SetEnabled(false);
+
+    const auto totals = SubsystemProfiler::GetTotals();
+    REQUIRE(totals[static_cast<size_t>(Subsystem::Audio)].count == 2);
+    REQUIRE(totals[static_cast<size_t>(Subsystem::CpuJit)].count == 0);
+}
+
+TEST_CASE("SubsystemProfiler::Accumulate", "[common]") {
+    using namespace std::chrono_literals;
+    SubsystemProfiler::Reset();
+    SubsystemProfiler::Record(Subsystem::Services, 3ms);
+    SubsystemProfiler::Record(Subsystem::Services, 4ms);
+
+    auto totals = SubsystemProfiler::GetTotals()[static_cast<size_t>(Subsystem::Services)];
+    REQUIRE(totals.count == 2);
+    REQUIRE(totals.time == 7ms);
+
+    SubsystemProfiler::Reset();
+    totals = SubsystemProfiler::GetTotals()[static_cast<size_t>(Subsystem::Services)];
+    REQUIRE(totals.count == 0);
+    REQUIRE(totals.time == 0ms);
+}
+
+TEST_CASE("SubsystemProfiler::Names", "[common]") {
+    for (size_t index = 0; index < NumSubsystems; ++index) {
+        REQUIRE(GetSubsystemName(static_cast<Subsystem>(index)) != "unknown");
+    }
+}
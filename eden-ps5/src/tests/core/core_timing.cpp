@@ -1,18 +1,27 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: 2016 Dolphin Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 
+#include <algorithm>
 #include <array>
 #include <bitset>
 #include <chrono>
 #include <cstdlib>
 #include <memory>
 #include <optional>
+#include <random>
 #include <string>
+#include <tuple>
+#include <vector>
 
 #include "core/core.h"
 #include "core/core_timing.h"
+#include "core/hardware_properties.h"
 
 namespace {
 // Numbers are chosen randomly to make sure the correct one is given.
@@ -40,6 +49,33 @@ struct ScopeInit final {
     Core::Timing::CoreTiming core_timing;
 };
 
+/// Single core timing is driven by AddTicks, which makes event times fully deterministic.
+struct SingleCoreInit final {
+    SingleCoreInit() {
+        core_timing.SetMulticore(false);
+        core_timing.Initialize([]() {});
+    }
+
+    /// Advances emulated time by the given amount and fires every event that became due.
+    void Step(std::chrono::nanoseconds ns) {
+        // Round up, so that time always moves forward by at least the requested amount.
+        constexpr u64 ns_per_second = 1'000'000'000;
+        const u64 ticks = (static_cast<u64>(ns.count()) * Core::Hardware::BASE_CLOCK_RATE +
+                           ns_per_second - 1) /
+                          ns_per_second;
+        core_timing.AddTicks(ticks);
+        core_timing.Advance();
+    }
+
+    Core::Timing::CoreTiming core_timing;
+};
+
+struct FiredEvent {
+    s64 time;
+    s64 now;
+    size_t id;
+};
+
 u64 TestTimerSpeed(Core::Timing::CoreTiming& core_timing) {
     const u64 start = core_timing.GetGlobalTimeNs().count();
     volatile u64 placebo = 0;
@@ -139,3 +175,168 @@ TEST_CASE("CoreTiming[BasicOrderNoPausing]", "[core]") {
     printf("HostTimer No Pausing Timer Time: %.3f %.6f\n", timer_time / 1000.f,
            timer_time / 1000000.f);
 }
+
+TEST_CASE("CoreTiming[FiresInOrderAndOnTime]", "[core]") {
+    SingleCoreInit guard;
+    auto& core_timing = guard.core_timing;
+
+    std::vector<FiredEvent> fired;
+    std::vector<std::shared_ptr<Core::Timing::EventType>> events;
+    std::vector<s64> scheduled_times;
+
+    // Spread events over every wheel level, with some sharing the exact same time.
+    std::mt19937_64 rng{42};
+    for (size_t i = 0; i < 512; ++i) {
+        const s64 exponent = static_cast<s64>(rng() % 30);
+        const s64 time = (i % 8 == 7) ? scheduled_times.back()
+                                      : static_cast<s64>(rng() % (s64{1} << exponent)) + 1;
+        scheduled_times.push_back(time);
+        events.push_back(Core::Timing::CreateEvent(
+            "event", [&fired, &core_timing, i](s64 time_, std::chrono::nanoseconds) {
+                fired.push_back({time_, core_timing.GetGlobalTimeNs().count(), i});
+                return std::nullopt;
+            }));
+        core_timing.ScheduleEvent(std::chrono::nanoseconds{time}, events.back(), true);
+    }
+
+    constexpr auto step = std::chrono::microseconds{50};
+    const s64 last_time = *std::ranges::max_element(scheduled_times);
+    while (core_timing.GetGlobalTimeNs().count() <= last_time) {
+        guard.Step(step);
+    }
+
+    REQUIRE(fired.size() == events.size());
+    for (size_t i = 0; i < fired.size(); ++i) {
+        const FiredEvent& evt = fired[i];
+        REQUIRE(evt.time == scheduled_times[evt.id]);
+
+        // Never early, and never later than the step that crossed the event's time.
+        REQUIRE(evt.now >= evt.time);
+        REQUIRE(evt.now - evt.time <= std::chrono::nanoseconds{step}.count() + 1);
+
+        // Sorted by time, events at the same time fire in the order they were scheduled.
+        if (i > 0) {
+            const FiredEvent& prev = fired[i - 1];
+            REQUIRE(std::tie(prev.time, prev.id) < std::tie(evt.time, evt.id));
+        }
+    }
+    REQUIRE(!core_timing.Advance().has_value());
+}
+
+TEST_CASE("CoreTiming[NextEventTime]", "[core]") {
+    SingleCoreInit guard;
+    auto& core_timing = guard.core_timing;
+    auto event = Core::Timing::CreateEvent(
+        "event", [](s64, std::chrono::nanoseconds) { return std::nullopt; });
+
+    // Times on different wheel levels, the earliest one must always be reported.
+    const std::array<s64, 5> times{5'000'000'000, 70'000, 3'000'000, 1'500, 250'000'000};
+    for (const s64 time : times) {
+        core_timing.ScheduleEvent(std::chrono::nanoseconds{time}, event, true);
+    }
+
+    std::vector<s64> sorted_times(times.begin(), times.end());
+    std::ranges::sort(sorted_times);
+    for (const s64 time : sorted_times) {
+        const std::optional<s64> next = core_timing.Advance();
+        REQUIRE(next == time);
+        guard.Step(std::chrono::nanoseconds{time - core_timing.GetGlobalTimeNs().count()} +
+                   std::chrono::nanoseconds{1});
+    }
+    REQUIRE(!core_timing.Advance().has_value());
+}
+
+TEST_CASE("CoreTiming[LoopingEvent]", "[core]") {
+    SingleCoreInit guard;
+    auto& core_timing = guard.core_timing;
+
+    constexpr auto period = std::chrono::microseconds{1000};
+    std::vector<s64> fire_times;
+    auto event = Core::Timing::CreateEvent(
+        "looping", [&fire_times](s64 time, std::chrono::nanoseconds) {
+            fire_times.push_back(time);
+            return std::nullopt;
+        });
+    core_timing.ScheduleLoopingEvent(period, period, event);
+
+    for (int i = 0; i < 1000; ++i) {
+        guard.Step(std::chrono::microseconds{10});
+    }
+    REQUIRE(fire_times.size() == 10);
+    for (size_t i = 0; i < fire_times.size(); ++i) {
+        REQUIRE(fire_times[i] ==
+                static_cast<s64>(i + 1) * std::chrono::nanoseconds{period}.count());
+    }
+
+    core_timing.UnscheduleEvent(event);
+    for (int i = 0; i < 1000; ++i) {
+        guard.Step(std::chrono::microseconds{10});
+    }
+    REQUIRE(fire_times.size() == 10);
+}
+
+TEST_CASE("CoreTiming[Unschedule]", "[core]") {
+    SingleCoreInit guard;
+    auto& core_timing = guard.core_timing;
+
+    std::bitset<2> ran;
+    auto kept = Core::Timing::CreateEvent("kept", [&ran](s64, std::chrono::nanoseconds) {
+        ran.set(0);
+        return std::nullopt;
+    });
+    auto removed = Core::Timing::CreateEvent("removed", [&ran](s64, std::chrono::nanoseconds) {
+        ran.set(1);
+        return std::nullopt;
+    });
+
+    // Place instances of the removed event both in the wheel and in the ready queue.
+    core_timing.ScheduleEvent(std::chrono::microseconds{100}, removed);
+    core_timing.ScheduleEvent(std::chrono::milliseconds{100}, removed);
+    core_timing.ScheduleEvent(std::chrono::microseconds{200}, kept);
+    core_timing.ScheduleEvent(std::chrono::nanoseconds{-1}, removed);
+    core_timing.UnscheduleEvent(removed);
+    REQUIRE(core_timing.HasPendingEvents());
+
+    for (int i = 0; i < 2000; ++i) {
+        guard.Step(std::chrono::microseconds{100});
+    }
+    REQUIRE(ran.test(0));
+    REQUIRE(!ran.test(1));
+    REQUIRE(!core_timing.Advance().has_value());
+}
+
+// Benchmarks are hidden from the default run. Use `tests "[benchmark]"` to run them.
+TEST_CASE("CoreTiming[Throughput]", "[.][benchmark]") {
+    SingleCoreInit guard;
+    auto& core_timing = guard.core_timing;
+
+    u64 fired = 0;
+    std::vector<std::shared_ptr<Core::Timing::EventType>> events;
+    for (size_t i = 0; i < 64; ++i) {
+        events.push_back(Core::Timing::CreateEvent(
+            "event", [&fired](s64, std::chrono::nanoseconds) {
+                ++fired;
+                return std::nullopt;
+            }));
+    }
+
+    std::mt19937_64 rng{1234};
+    BENCHMARK("Schedule and fire 4096 events") {
+        for (size_t i = 0; i < 4096; ++i) {
+            const auto delay = std::chrono::nanoseconds{static_cast<s64>(rng() % 16'000'000)};
+            core_timing.ScheduleEvent(delay, events[i % events.size()]);
+        }
+        while (core_timing.Advance()) {
+            guard.Step(std::chrono::microseconds{100});
+        }
+        return fired;
+    };
+
+    BENCHMARK("Schedule and unschedule") {
+        for (size_t i = 0; i < 4096; ++i) {
+            auto& event = events[i % events.size()];
+            core_timing.ScheduleEvent(std::chrono::milliseconds{1}, event);
+            core_timing.UnscheduleEvent(event, Core::Timing::UnscheduleEventType::NoWait);
+        }
+    };
+}
@@ -0,0 +1,441 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "common/common_types.h"
+#include "core/memory/dmnt_cheat_types.h"
+#include "core/memory/dmnt_cheat_vm.h"
+
+namespace {
+
+using Core::Memory::CheatEntry;
+using Core::Memory::CheatProcessMetadata;
+using Core::Memory::DmntCheatVm;
+
+constexpr u64 RegionSize = 0x400;
+constexpr std::array<u64, 4> RegionBases{0x8000000, 0x10000000, 0x20000000, 0x30000000};
+
+struct RecordedEvent {
+    u32 kind;
+    u64 address;
+    u64 value;
+
+    bool operator==(const RecordedEvent&) const = default;
+};
+
+/// Flat guest memory plus a trace of every side effect observed through the VM callbacks.
+struct FakeProcess {
+    std::array<std::array<u8, RegionSize>, 4> regions{};
+    std::vector<RecordedEvent> events;
+    u64 keys_down{};
+
+    u8* Translate(VAddr address, u64 size) {
+        for (std::size_t i = 0; i < RegionBases.size(); i++) {
+            if (address >= RegionBases[i] && address - RegionBases[i] <= RegionSize - size) {
+                return regions[i].data() + (address - RegionBases[i]);
+            }
+        }
+        return nullptr;
+    }
+};
+
+class FakeCallbacks final : public DmntCheatVm::Callbacks {
+public:
+    explicit FakeCallbacks(FakeProcess& process_) : process{process_} {}
+
+    void MemoryReadUnsafe(VAddr address, void* data, u64 size) override {
+        if (const u8* const src = process.Translate(address, size)) {
+            std::memcpy(data, src, size);
+        } else {
+            std::memset(data, 0, size);
+        }
+    }
+
+    void MemoryWriteUnsafe(VAddr address, const void* data, u64 size) override {
+        u64 value{};
+        std::memcpy(&value, data, size);
+        process.events.push_back({0, address, value});
+        if (u8* const dst = process.Translate(address, size)) {
+            std::memcpy(dst, data, size);
+        }
+    }
+
+    u64 HidKeysDown() override {
+        return process.keys_down;
+    }
+
+    void PauseProcess() override {
+        process.events.push_back({1, 0, 0});
+    }
+
+    void ResumeProcess() override {
+        process.events.push_back({2, 0, 0});
+    }
+
+    void DebugLog(u8 id, u64 value) override {
+        process.events.push_back({3, id, value});
+    }
+
+    void CommandLog(std::string_view data) override {}
+
+    bool IsCommandLogEnabled() const override {
+        return false;
+    }
+
+private:
+    FakeProcess& process;
+};
+
+CheatProcessMetadata MakeMetadata() {
+    CheatProcessMetadata metadata{};
+    metadata.main_nso_extents = {RegionBases[0], RegionSize};
+    metadata.heap_extents = {RegionBases[1], RegionSize};
+    metadata.alias_extents = {RegionBases[2], RegionSize};
+    metadata.aslr_extents = {RegionBases[3], RegionSize};
+    return metadata;
+}
+
+std::vector<CheatEntry> MakeCheats(const std::vector<u32>& opcodes) {
+    std::vector<CheatEntry> cheats(1);
+    cheats[0].enabled = true;
+    cheats[0].definition.num_opcodes = static_cast<u32>(opcodes.size());
+    std::copy(opcodes.begin(), opcodes.end(), cheats[0].definition.opcodes.begin());
+    return cheats;
+}
+
+/// Runs the same program through the interpreter and the pre-decoded executor for a number of
+/// frames and requires identical memory contents and side effects after every frame.
+void RunDifferential(const std::vector<u32>& opcodes, std::size_t frames = 4, u64 seed = 0) {
+    FakeProcess interpreted_process;
+    FakeProcess compiled_process;
+
+    std::mt19937_64 rng{seed};
+    for (std::size_t i = 0; i < RegionBases.size(); i++) {
+        for (auto& byte : interpreted_process.regions[i]) {
+            byte = static_cast<u8>(rng());
+        }
+    }
+    compiled_process.regions = interpreted_process.regions;
+
+    DmntCheatVm interpreted{std::make_unique<FakeCallbacks>(interpreted_process)};
+    DmntCheatVm compiled{std::make_unique<FakeCallbacks>(compiled_process)};
+
+    const auto cheats = MakeCheats(opcodes);
+    REQUIRE(interpreted.LoadProgram(cheats));
+    REQUIRE(compiled.LoadProgram(cheats));
+
+    const auto metadata = MakeMetadata();
+    for (std::size_t frame = 0; frame < frames; frame++) {
+        const u64 keys = rng() & 0xFF;
+        interpreted_process.keys_down = keys;
+        compiled_process.keys_down = keys;
+
+        interpreted.ExecuteInterpreted(metadata);
+        compiled.Execute(metadata);
+
+        REQUIRE(compiled_process.events == interpreted_process.events);
+        REQUIRE(compiled_process.regions == interpreted_process.regions);
+    }
+}
+
+/// Emits random but well-formed cheat programs. Register 0xF is reserved as the loop counter so
+/// that generated loops always terminate.
+class ProgramGenerator {
+public:
+    explicit ProgramGenerator(u64 seed) : rng{seed} {}
+
+    std::vector<u32> Generate(std::size_t length) {
+        out.clear();
+        EmitBlock(length, 0, false);
+        return out;
+    }
+
+private:
+    u32 Rand(u32 bound) {
+        return static_cast<u32>(rng() % bound);
+    }
+
+    u32 Reg() {
+        return Rand(0xF);
+    }
+
+    u32 Width() {
+        static constexpr std::array<u32, 5> widths{1, 2, 4, 8, 3};
+        return widths[Rand(static_cast<u32>(widths.size()))];
+    }
+
+    u64 RelAddress() {
+        // Mostly in bounds, occasionally past the end of the region.
+        return Rand(8) == 0 ? RegionSize + Rand(0x100) : Rand(RegionSize - 8);
+    }
+
+    void EmitValue(u32 width, u64 value) {
+        if (width == 8) {
+            out.push_back(static_cast<u32>(value >> 32));
+        }
+        out.push_back(static_cast<u32>(value));
+    }
+
+    void EmitAddressValue(u64 value) {
+        out.push_back(static_cast<u32>(value >> 32));
+        out.push_back(static_cast<u32>(value));
+    }
+
+    void EmitSimple() {
+        switch (Rand(13)) {
+        case 0: {
+            const u32 width = Width();
+            const u64 rel = RelAddress();
+            out.push_back((width << 24) | (Rand(4) << 20) | (Rand(2) ? Reg() << 16 : 0) |
+                          static_cast<u32>(rel >> 32));
+            out.push_back(static_cast<u32>(rel));
+            EmitValue(width, rng());
+            break;
+        }
+        case 1: {
+            // Load a register with a guest address half of the time so memory ops hit.
+            const u64 value = Rand(2) ? RegionBases[Rand(4)] + Rand(RegionSize - 8) : rng();
+            out.push_back(0x40000000 | (Reg() << 16));
+            EmitAddressValue(value);
+            break;
+        }
+        case 2: {
+            const u64 rel = Rand(2) ? RelAddress() : RegionBases[Rand(4)] + RelAddress();
+            out.push_back(0x50000000 | (Width() << 24) | (Rand(4) << 20) | (Reg() << 16) |
+                          (Rand(2) << 12) | static_cast<u32>((rel >> 32) & 0xFF));
+            out.push_back(static_cast<u32>(rel));
+            break;
+        }
+        case 3:
+            out.push_back(0x60000000 | (Width() << 24) | (Reg() << 16) | (Rand(2) << 12) |
+                          (Rand(2) << 8) | (Reg() << 4));
+            EmitAddressValue(rng());
+            break;
+        case 4: {
+            const u32 math = Rand(6);
+            const u32 value = math == 3 || math == 4 ? Rand(64) : static_cast<u32>(rng());
+            out.push_back(0x70000000 | (Width() << 24) | (Reg() << 16) | (math << 12));
+            out.push_back(value);
+            break;
+        }
+        case 5: {
+            const u32 width = Width();
+            const bool has_immediate = Rand(2) != 0;
+            u32 math = Rand(10);
+            if (!has_immediate && (math == 3 || math == 4)) {
+                math = 0;
+            }
+            out.push_back(0x90000000 | (width << 24) | (math << 20) | (Reg() << 16) |
+                          (Reg() << 12) | (has_immediate ? 1U << 8 : Reg() << 4));
+            if (has_immediate) {
+                EmitValue(width, math == 3 || math == 4 ? Rand(64) : rng());
+            }
+            break;
+        }
+        case 6: {
+            const u32 ofs_type = Rand(6);
+            const u32 x = ofs_type >= 3 ? Rand(4) : Reg();
+            out.push_back(0xA0000000 | (Width() << 24) | (Reg() << 20) | (Reg() << 16) |
+                          (Rand(2) << 12) | (ofs_type << 8) | (x << 4));
+            if (ofs_type == 2 || ofs_type == 4 || ofs_type == 5) {
+                out.push_back(static_cast<u32>(RelAddress()));
+            }
+            break;
+        }
+        case 7:
+            out.push_back(0xC1000000 | (Reg() << 16) | (Reg() << 8) | (Rand(4) << 4));
+            break;
+        case 8:
+            out.push_back(0xC2000000 | (Rand(4) << 20) | Rand(0x8000));
+            break;
+        case 9:
+            out.push_back(0xC3000000 | (Rand(0x100) << 4) | Reg());
+            break;
+        case 10:
+            out.push_back(Rand(2) ? 0xFF000000 : 0xFF100000);
+            break;
+        case 11: {
+            const u32 val_type = Rand(5);
+            u32 operands = 0;
+            switch (val_type) {
+            case 0:
+                operands = Rand(4) << 4;
+                break;
+            case 1:
+                operands = (Rand(4) << 4) | Reg();
+                break;
+            case 2:
+                operands = Reg() << 4;
+                break;
+            case 3:
+            case 4:
+                operands = (Reg() << 4) | Reg();
+                break;
+            }
+            out.push_back(0xFFF00000 | (Width() << 16) | (Rand(16) << 12) | (val_type << 8) |
+                          operands);
+            if (val_type == 0 || val_type == 2) {
+                out.push_back(static_cast<u32>(RelAddress()));
+            }
+            break;
+        }
+        default:
+            // Store a small register-relative value so later conditionals have something to see.
+            out.push_back(0x64000000 | (Reg() << 16));
+            EmitAddressValue(Rand(4));
+            break;
+        }
+    }
+
+    void EmitConditionalBegin() {
+        switch (Rand(3)) {
+        case 0: {
+            const u32 width = Width();
+            const u64 rel = RelAddress();
+            out.push_back(0x10000000 | (width << 24) | (Rand(4) << 20) | ((1 + Rand(6)) << 16) |
+                          static_cast<u32>(rel >> 32));
+            out.push_back(static_cast<u32>(rel));
+            EmitValue(width, Rand(4));
+            break;
+        }
+        case 1:
+            out.push_back(0x80000000 | (1U << Rand(8)));
+            break;
+        default: {
+            const u32 width = Width();
+            const u32 comp_type = Rand(6);
+            u32 operands = 0;
+            switch (comp_type) {
+            case 0:
+                operands = Rand(4) << 4;
+                break;
+            case 1:
+                operands = (Rand(4) << 4) | Reg();
+                break;
+            case 2:
+                operands = Reg() << 4;
+                break;
+            case 3:
+                operands = (Reg() << 4) | Reg();
+                break;
+            case 5:
+                operands = Reg() << 4;
+                break;
+            }
+            out.push_back(0xC0000000 | (width << 20) | ((1 + Rand(6)) << 16) | (Reg() << 12) |
+                          (comp_type << 8) | operands);
+            if (comp_type == 0 || comp_type == 2) {
+                out.push_back(static_cast<u32>(RelAddress()));
+            } else if (comp_type == 4) {
+                EmitValue(width, Rand(4));
+            }
+            break;
+        }
+        }
+    }
+
+    void EmitBlock(std::size_t length, u32 depth, bool in_loop) {
+        for (std::size_t i = 0; i < length; i++) {
+            const u32 choice = Rand(10);
+            if (choice == 0 && depth < 4) {
+                EmitConditionalBegin();
+                EmitBlock(1 + Rand(4), depth + 1, in_loop);
+                if (Rand(2)) {
+                    out.push_back(0x21000000);
+                    EmitBlock(1 + Rand(4), depth + 1, in_loop);
+                }
+                out.push_back(0x20000000);
+            } else if (choice == 1 && !in_loop) {
+                out.push_back(0x30000000 | (0xFU << 20));
+                out.push_back(1 + Rand(4));
+                EmitBlock(1 + Rand(4), depth, true);
+                out.push_back(0x31000000 | (0xFU << 20));
+            } else {
+                EmitSimple();
+            }
+        }
+    }
+
+    std::mt19937_64 rng;
+    std::vector<u32> out;
+};
+
+} // Anonymous namespace
+
+TEST_CASE("DmntCheatVm: Straight-line stores", "[core]") {
+    RunDifferential({
+        // Store static 4 bytes to main + 0x10.
+        0x04000000, 0x00000010, 0xDEADBEEF,
+        // Store static 8 bytes to heap + 0x20, offset by register 1.
+        0x08110000, 0x00000020, 0x01234567, 0x89ABCDEF,
+        // Load register 2 with main + 0x40 and store through it, incrementing.
+        0x40020000, 0x00000000, 0x08000040,
+        0x62021000, 0x00000000, 0x00001234,
+        0x62021000, 0x00000000, 0x00005678,
+    });
+}
+
+TEST_CASE("DmntCheatVm: Nested conditionals and else", "[core]") {
+    RunDifferential({
+        // if (u8 main[0x10] != 0)
+        0x11060000, 0x00000010, 0x00000000,
+        //   if (keys & 1)
+        0x80000001,
+        //     store 1 to main + 0x20
+        0x01000000, 0x00000020, 0x00000001,
+        //   else
+        0x21000000,
+        //     store 2 to main + 0x20
+        0x01000000, 0x00000020, 0x00000002,
+        //   end
+        0x20000000,
+        // else
+        0x21000000,
+        //   store 3 to main + 0x20
+        0x01000000, 0x00000020, 0x00000003,
+        // end
+        0x20000000,
+        // Stray end at depth zero is a no-op.
+        0x20000000,
+        0x01000000, 0x00000021, 0x00000004,
+    });
+}
+
+TEST_CASE("DmntCheatVm: Loops and unterminated blocks", "[core]") {
+    RunDifferential({
+        0x40030000, 0x00000000, 0x08000100,
+        // loop r0, 5 times: store r0 and advance
+        0x30000000, 0x00000005,
+        0xA4031000,
+        0x31000000,
+        // Condition that never holds and has no matching end: skips the rest of the program.
+        0x14050000, 0x00000000, 0xFFFFFFFF,
+        0x04000000, 0x00000000, 0x11111111,
+    });
+}
+
+TEST_CASE("DmntCheatVm: Invalid opcode terminates program", "[core]") {
+    RunDifferential({
+        0x04000000, 0x00000000, 0x22222222,
+        0xB0000000,
+        0x04000000, 0x00000004, 0x33333333,
+    });
+}
+
+TEST_CASE("DmntCheatVm: Randomized programs match interpreter", "[core]") {
+    for (u64 seed = 0; seed < 256; seed++) {
+        ProgramGenerator generator{seed};
+        auto program = generator.Generate(8 + seed % 24);
+        if (program.size() > Core::Memory::CheatDefinition{}.opcodes.size()) {
+            program.resize(Core::Memory::CheatDefinition{}.opcodes.size());
+        }
+        RunDifferential(program, 3, seed);
+    }
+}
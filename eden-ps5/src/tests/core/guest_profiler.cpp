@@ -0,0 +1,66 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <array>
+#include <string_view>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "core/arm/guest_profiler.h"
+
+using Core::GuestProfile;
+
+namespace {
+// Frames are ordered from the leaf to the root
+constexpr std::array<std::string_view, 3> DrawStack{"main`Draw", "main`Frame", "main`Loop"};
+constexpr std::array<std::string_view, 3> UpdateStack{"main`Update", "main`Frame", "main`Loop"};
+constexpr std::array<std::string_view, 4> RecursiveStack{"main`Walk", "main`Walk", "main`Frame",
+                                                         "main`Loop"};
+} // Anonymous namespace
+
+TEST_CASE("GuestProfile[CollapsedStacks]", "[core]") {
+    GuestProfile profile;
+    profile.AddSample(DrawStack);
+    profile.AddSample(DrawStack);
+    profile.AddSample(UpdateStack);
+
+    REQUIRE(profile.GetSampleCount() == 3);
+    REQUIRE(profile.GetCollapsedStacks() == "main`Loop;main`Frame;main`Draw 2\n"
+                                            "main`Loop;main`Frame;main`Update 1\n");
+}
+
+TEST_CASE("GuestProfile[HotSpots]", "[core]") {
+    GuestProfile profile;
+    profile.AddSample(DrawStack);
+    profile.AddSample(DrawStack);
+    profile.AddSample(UpdateStack);
+    profile.AddSample(RecursiveStack);
+
+    const auto hot_spots = profile.GetHotSpots();
+    REQUIRE(hot_spots.size() == 5);
+    REQUIRE(hot_spots[0].name == "main`Draw");
+    REQUIRE(hot_spots[0].self_samples == 2);
+    REQUIRE(hot_spots[0].total_samples == 2);
+
+    for (const auto& function : hot_spots) {
+        if (function.name == "main`Loop") {
+            REQUIRE(function.self_samples == 0);
+            REQUIRE(function.total_samples == 4);
+        } else if (function.name == "main`Walk") {
+            // Recursion counts once per sample
+            REQUIRE(function.self_samples == 1);
+            REQUIRE(function.total_samples == 1);
+        }
+    }
+}
+
+TEST_CASE("GuestProfile[FrameSeparators]", "[core]") {
+    GuestProfile profile;
+    constexpr std::array<std::string_view, 1> stack{"main`operator;"};
+    profile.AddSample(stack);
+    REQUIRE(profile.GetCollapsedStacks() == "main`operator: 1\n");
+
+    profile.Reset();
+    REQUIRE(profile.GetSampleCount() == 0);
+    REQUIRE(profile.GetCollapsedStacks().empty());
+}
@@ -0,0 +1,81 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "core/internal_network/network.h"
+#include "core/internal_network/socket_reactor.h"
+#include "core/internal_network/sockets.h"
+
+namespace {
+
+using namespace std::chrono_literals;
+
+class ReadyCounter {
+public:
+    void Notify() {
+        std::scoped_lock lk{mutex};
+        ++count;
+        cv.notify_all();
+    }
+
+    bool WaitFor(int expected, std::chrono::milliseconds timeout) {
+        std::unique_lock lk{mutex};
+        return cv.wait_for(lk, timeout, [&] { return count >= expected; });
+    }
+
+    int Count() {
+        std::scoped_lock lk{mutex};
+        return count;
+    }
+
+private:
+    std::mutex mutex;
+    std::condition_variable cv;
+    int count = 0;
+};
+
+} // Anonymous namespace
+
+TEST_CASE("SocketReactor: Readiness and deadlines", "[core]") {
+    Network::NetworkInstance network_instance;
+
+    ReadyCounter counter;
+    const auto reactor = Network::SocketReactor::Create([&counter] { counter.Notify(); });
+    if (!reactor) {
+        // Not supported on this host
+        return;
+    }
+
+    Network::Socket socket;
+    REQUIRE(socket.Initialize(Network::Domain::INET, Network::Type::DGRAM,
+                              Network::Protocol::UDP) == Network::Errno::SUCCESS);
+    REQUIRE(socket.Bind(Network::SockAddrIn{Network::Domain::INET, {127, 0, 0, 1}, 0}) ==
+            Network::Errno::SUCCESS);
+    const auto [addr, addr_errno] = socket.GetSockName();
+    REQUIRE(addr_errno == Network::Errno::SUCCESS);
+
+    // Nothing to read yet
+    reactor->Watch(socket.GetFD(), Network::PollEvents::In);
+    REQUIRE(!counter.WaitFor(1, 50ms));
+
+    const std::array<u8, 4> message{1, 2, 3, 4};
+    REQUIRE(socket.SendTo(0, message, &addr).second == Network::Errno::SUCCESS);
+    REQUIRE(counter.WaitFor(1, 1000ms));
+
+    // Readiness is reported once until the socket is watched again
+    REQUIRE(!counter.WaitFor(2, 50ms));
+    reactor->Watch(socket.GetFD(), Network::PollEvents::In);
+    REQUIRE(counter.WaitFor(2, 1000ms));
+
+    reactor->WakeAt(std::chrono::steady_clock::now() + 20ms);
+    REQUIRE(counter.WaitFor(3, 1000ms));
+    REQUIRE(counter.Count() == 3);
+
+    reactor->Forget(socket.GetFD());
+}
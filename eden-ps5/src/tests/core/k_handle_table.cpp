@@ -0,0 +1,198 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <memory>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "core/core.h"
+#include "core/hle/kernel/k_auto_object.h"
+#include "core/hle/kernel/k_handle_table.h"
+#include "core/hle/kernel/k_process.h"
+#include "core/hle/kernel/kernel.h"
+#include "core/hle/kernel/svc_common.h"
+#include "core/hle/kernel/svc_results.h"
+
+using Kernel::Handle;
+
+namespace {
+constexpr u32 HandleIndex(Handle handle) {
+    return handle & 0x7FFF;
+}
+
+constexpr u32 HandleLinearId(Handle handle) {
+    return (handle >> 15) & 0x7FFF;
+}
+
+/// Reference counted object that is not backed by a slab heap.
+class TestObject final : public Kernel::KAutoObject {
+public:
+    explicit TestObject(Kernel::KernelCore& kernel_) : KAutoObject{kernel_} {
+        KAutoObject::Create(this);
+    }
+
+    void Destroy() override {
+        destroyed = true;
+    }
+
+    bool destroyed{};
+};
+
+/// Initializes a kernel for the calling thread, so that table operations can disable dispatch.
+class KernelFixture {
+public:
+    KernelFixture() {
+        system.Initialize();
+        system.Kernel().Initialize();
+        table = std::make_unique<Kernel::KHandleTable>(system.Kernel());
+    }
+
+    ~KernelFixture() {
+        table.reset();
+        system.Kernel().Shutdown();
+    }
+
+    TestObject& MakeObject() {
+        return *objects.emplace_back(std::make_unique<TestObject>(system.Kernel()));
+    }
+
+    /// Drops the reference held since creation, leaving only the table references.
+    void CloseObjects() {
+        for (const auto& object : objects) {
+            object->Close();
+        }
+    }
+
+    Core::System system;
+    std::unique_ptr<Kernel::KHandleTable> table;
+    std::vector<std::unique_ptr<TestObject>> objects;
+};
+} // Anonymous namespace
+
+TEST_CASE("KHandleTable[Allocation]", "[core]") {
+    KernelFixture fixture;
+    auto& table = *fixture.table;
+    REQUIRE(table.Initialize(16).IsSuccess());
+    REQUIRE(table.GetTableSize() == 16);
+
+    TestObject& first = fixture.MakeObject();
+    TestObject& second = fixture.MakeObject();
+    Handle first_handle{};
+    Handle second_handle{};
+    REQUIRE(table.Add(&first_handle, &first).IsSuccess());
+    REQUIRE(table.Add(&second_handle, &second).IsSuccess());
+    REQUIRE(first_handle != second_handle);
+    REQUIRE(HandleLinearId(first_handle) != 0);
+    REQUIRE(table.GetCount() == 2);
+    REQUIRE(first.GetReferenceCount() == 2);
+
+    // Lookups open a reference that is dropped with the scoped object
+    {
+        const auto object = table.GetObject(first_handle);
+        REQUIRE(object.IsNotNull());
+        REQUIRE(object.GetPointerUnsafe() == &first);
+        REQUIRE(first.GetReferenceCount() == 3);
+    }
+    REQUIRE(first.GetReferenceCount() == 2);
+
+    Kernel::KAutoObject* opened[2]{};
+    const Handle handles[2]{first_handle, second_handle};
+    REQUIRE(table.GetMultipleObjects(opened, handles, 2));
+    REQUIRE(opened[0] == &first);
+    REQUIRE(opened[1] == &second);
+    opened[0]->Close();
+    opened[1]->Close();
+
+    // Invalid handles do not resolve
+    REQUIRE(table.GetObject(Handle{0}).IsNull());
+    REQUIRE(table.GetObject(first_handle | (1U << 30)).IsNull());
+    REQUIRE(
+        table.GetObjectWithoutPseudoHandle(Kernel::Svc::PseudoHandle::CurrentThread).IsNull());
+    REQUIRE(!table.Remove(Kernel::Svc::PseudoHandle::CurrentProcess));
+
+    REQUIRE(table.Remove(first_handle));
+    REQUIRE(!table.Remove(first_handle));
+    REQUIRE(table.GetObject(first_handle).IsNull());
+    REQUIRE(table.GetCount() == 1);
+    REQUIRE(table.GetMaxCount() == 2);
+    REQUIRE(first.GetReferenceCount() == 1);
+
+    fixture.CloseObjects();
+    REQUIRE(first.destroyed);
+    REQUIRE(!second.destroyed);
+    REQUIRE(table.Finalize().IsSuccess());
+    REQUIRE(second.destroyed);
+}
+
+TEST_CASE("KHandleTable[Reuse]", "[core]") {
+    KernelFixture fixture;
+    auto& table = *fixture.table;
+    REQUIRE(table.Initialize(16).IsSuccess());
+
+    TestObject& first = fixture.MakeObject();
+    TestObject& second = fixture.MakeObject();
+    Handle stale_handle{};
+    REQUIRE(table.Add(&stale_handle, &first).IsSuccess());
+    REQUIRE(table.Remove(stale_handle));
+
+    // The freed entry is handed out again under a new linear id
+    Handle handle{};
+    REQUIRE(table.Add(&handle, &second).IsSuccess());
+    REQUIRE(HandleIndex(handle) == HandleIndex(stale_handle));
+    REQUIRE(HandleLinearId(handle) != HandleLinearId(stale_handle));
+    REQUIRE(table.GetObject(stale_handle).IsNull());
+    REQUIRE(table.GetObject(handle).GetPointerUnsafe() == &second);
+    REQUIRE(!table.Remove(stale_handle));
+    REQUIRE(table.GetCount() == 1);
+
+    // Reserved entries are reused once they are unreserved
+    Handle reserved{};
+    REQUIRE(table.Reserve(&reserved).IsSuccess());
+    REQUIRE(table.GetObject(reserved).IsNull());
+    table.Unreserve(reserved);
+    Handle registered{};
+    REQUIRE(table.Reserve(&registered).IsSuccess());
+    REQUIRE(HandleIndex(registered) == HandleIndex(reserved));
+    table.Register(registered, &first);
+    REQUIRE(table.GetObject(registered).GetPointerUnsafe() == &first);
+    REQUIRE(table.GetCount() == 2);
+
+    fixture.CloseObjects();
+    REQUIRE(table.Finalize().IsSuccess());
+    REQUIRE(first.destroyed);
+    REQUIRE(second.destroyed);
+}
+
+TEST_CASE("KHandleTable[Exhaustion]", "[core]") {
+    KernelFixture fixture;
+    auto& table = *fixture.table;
+    REQUIRE(table.Initialize(static_cast<s32>(Kernel::KHandleTable::MaxTableSize + 1)) ==
+            Kernel::ResultOutOfMemory);
+    constexpr size_t TableSize = 4;
+    REQUIRE(table.Initialize(static_cast<s32>(TableSize)).IsSuccess());
+
+    TestObject& object = fixture.MakeObject();
+    std::vector<Handle> handles(TableSize);
+    for (Handle& handle : handles) {
+        REQUIRE(table.Add(&handle, &object).IsSuccess());
+    }
+    REQUIRE(table.GetCount() == TableSize);
+    REQUIRE(object.GetReferenceCount() == TableSize + 1);
+
+    Handle overflow{};
+    REQUIRE(table.Add(&overflow, &object) == Kernel::ResultOutOfHandles);
+    REQUIRE(table.Reserve(&overflow) == Kernel::ResultOutOfHandles);
+    REQUIRE(object.GetReferenceCount() == TableSize + 1);
+
+    // Removing any handle makes room for exactly one more
+    REQUIRE(table.Remove(handles[1]));
+    REQUIRE(table.Add(&handles[1], &object).IsSuccess());
+    REQUIRE(table.Add(&overflow, &object) == Kernel::ResultOutOfHandles);
+    REQUIRE(table.GetMaxCount() == TableSize);
+
+    fixture.CloseObjects();
+    REQUIRE(!object.destroyed);
+    REQUIRE(table.Finalize().IsSuccess());
+    REQUIRE(object.destroyed);
+}
@@ -0,0 +1,154 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "input_common/input_engine.h"
+
+namespace {
+
+class TestDriver final : public InputCommon::InputEngine {
+public:
+    explicit TestDriver(std::string name) : InputEngine{std::move(name)} {
+        PreSetController(identifier);
+        PreSetAxis(identifier, 0);
+        PreSetAxis(identifier, 1);
+        PreSetMotion(identifier, 0);
+    }
+
+    using InputEngine::BeginUpdateBatch;
+    using InputEngine::EndUpdateBatch;
+    using InputEngine::SetAxis;
+    using InputEngine::SetMotion;
+
+    int Listen(EngineInputType type, int index, std::function<void()> on_change) {
+        return SetCallback({
+            .identifier = identifier,
+            .type = type,
+            .index = index,
+            .callback = {std::move(on_change)},
+        });
+    }
+
+    const PadIdentifier identifier{
+        .guid = Common::UUID{},
+        .port = 0,
+        .pad = 0,
+    };
+};
+
+BasicMotion MakeSample(u32 sample) {
+    const auto value = static_cast<float>(sample);
+    return {
+        .gyro_x = value,
+        .gyro_y = value,
+        .gyro_z = value,
+        .accel_x = value,
+        .accel_y = value,
+        .accel_z = value,
+        .delta_timestamp = sample,
+    };
+}
+
+bool IsConsistent(const BasicMotion& motion) {
+    const auto value = static_cast<float>(motion.delta_timestamp);
+    return motion.gyro_x == value && motion.gyro_y == value && motion.gyro_z == value &&
+           motion.accel_x == value && motion.accel_y == value && motion.accel_z == value;
+}
+
+} // Anonymous namespace
+
+TEST_CASE("InputEngine: Motion from several drivers at 1 kHz", "[input_common]") {
+    static constexpr size_t NumDrivers = 4;
+    static constexpr u32 NumSamples = 250;
+
+    std::array<std::unique_ptr<TestDriver>, NumDrivers> drivers;
+    std::array<std::atomic<u32>, NumDrivers> notifications{};
+    std::atomic<bool> torn{false};
+    for (size_t index = 0; index < NumDrivers; ++index) {
+        drivers[index] = std::make_unique<TestDriver>("driver" + std::to_string(index));
+        auto* const driver = drivers[index].get();
+        driver->Listen(EngineInputType::Motion, 0, [&, driver, index] {
+            if (!IsConsistent(driver->GetMotion(driver->identifier, 0))) {
+                torn = true;
+            }
+            ++notifications[index];
+        });
+    }
+
+    // The emulation thread reads every device while the drivers write
+    std::atomic<bool> done{false};
+    std::jthread reader([&] {
+        std::array<u64, NumDrivers> last_sample{};
+        while (!done.load(std::memory_order_relaxed)) {
+            for (size_t index = 0; index < NumDrivers; ++index) {
+                const auto& driver = *drivers[index];
+                const auto motion = driver.GetMotion(driver.identifier, 0);
+                if (!IsConsistent(motion) || motion.delta_timestamp < last_sample[index]) {
+                    torn = true;
+                }
+                last_sample[index] = motion.delta_timestamp;
+            }
+        }
+    });
+
+    {
+        std::vector<std::jthread> writers;
+        for (size_t index = 0; index < NumDrivers; ++index) {
+            writers.emplace_back([&driver = *drivers[index]] {
+                auto next = std::chrono::steady_clock::now();
+                for (u32 sample = 1; sample <= NumSamples; ++sample) {
+                    driver.SetMotion(driver.identifier, 0, MakeSample(sample));
+                    next += std::chrono::milliseconds{1};
+                    std::this_thread::sleep_until(next);
+                }
+            });
+        }
+    }
+    done = true;
+    reader.join();
+
+    REQUIRE(!torn);
+    for (size_t index = 0; index < NumDrivers; ++index) {
+        REQUIRE(notifications[index] == NumSamples);
+        const auto& driver = *drivers[index];
+        REQUIRE(driver.GetMotion(driver.identifier, 0).delta_timestamp == NumSamples);
+    }
+}
+
+TEST_CASE("InputEngine: Update batches coalesce notifications", "[input_common]") {
+    TestDriver driver{"batch"};
+    int x_notifications = 0;
+    int y_notifications = 0;
+    float last_x = 0.0f;
+    driver.Listen(EngineInputType::Analog, 0, [&] {
+        ++x_notifications;
+        last_x = driver.GetAxis(driver.identifier, 0);
+    });
+    driver.Listen(EngineInputType::Analog, 1, [&] { ++y_notifications; });
+
+    driver.BeginUpdateBatch();
+    driver.SetAxis(driver.identifier, 0, 0.25f);
+    driver.SetAxis(driver.identifier, 0, 0.5f);
+    driver.SetAxis(driver.identifier, 1, 1.0f);
+    REQUIRE(x_notifications == 0);
+    driver.EndUpdateBatch();
+
+    REQUIRE(x_notifications == 1);
+    REQUIRE(y_notifications == 1);
+    REQUIRE(last_x == 0.5f);
+
+    // Outside of a batch every change is notified
+    driver.SetAxis(driver.identifier, 0, 0.75f);
+    driver.SetAxis(driver.identifier, 0, 1.0f);
+    REQUIRE(x_notifications == 3);
+}
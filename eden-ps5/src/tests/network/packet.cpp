@@ -0,0 +1,195 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <array>
+#include <cstring>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "network/packet.h"
+
+namespace Network {
+namespace {
+std::vector<u8> MakePayload(size_t size) {
+    std::vector<u8> payload(size);
+    for (size_t i = 0; i < size; ++i) {
+        payload[i] = static_cast<u8>(i * 7);
+    }
+    return payload;
+}
+
+std::vector<u8> GetBytes(const Packet& packet) {
+    const auto* const data = static_cast<const u8*>(packet.GetData());
+    return std::vector<u8>(data, data + packet.GetDataSize());
+}
+} // Anonymous namespace
+
+TEST_CASE("Packet: Round trip", "[network]") {
+    const std::vector<u8> payload = MakePayload(300);
+    const std::vector<u16> words{0x1234, 0xABCD};
+    const std::array<u8, 4> ip{192, 168, 1, 2};
+
+    Packet packet;
+    packet.Write(static_cast<u8>(6));
+    packet.Write(ip);
+    packet.Write(true);
+    packet.Write(std::string{"nickname"});
+    packet.Write(payload);
+    packet.Write(words);
+    packet.Write(u64{0x0102030405060708});
+
+    u8 type{};
+    std::array<u8, 4> read_ip{};
+    bool broadcast{};
+    std::string nickname;
+    std::vector<u8> read_payload;
+    std::vector<u16> read_words;
+    u64 value{};
+    packet.Read(type);
+    packet.Read(read_ip);
+    packet.Read(broadcast);
+    packet.Read(nickname);
+    packet.Read(read_payload);
+    packet.Read(read_words);
+    packet.Read(value);
+
+    REQUIRE(packet);
+    REQUIRE(packet.EndOfPacket());
+    REQUIRE(type == 6);
+    REQUIRE(read_ip == ip);
+    REQUIRE(broadcast);
+    REQUIRE(nickname == "nickname");
+    REQUIRE(read_payload == payload);
+    REQUIRE(read_words == words);
+    REQUIRE(value == 0x0102030405060708);
+}
+
+TEST_CASE("Packet: Byte arrays keep the wire format", "[network]") {
+    Packet packet;
+    packet.Write(std::vector<u8>{0xAA, 0xBB});
+    packet.Write(std::array<u8, 2>{0xCC, 0xDD});
+    packet.Write(std::vector<u16>{0x0102});
+
+    const std::vector<u8> expected{0, 0, 0, 2, 0xAA, 0xBB, 0xCC, 0xDD, 0, 0, 0, 1, 0x01, 0x02};
+    REQUIRE(GetBytes(packet) == expected);
+}
+
+TEST_CASE("Packet: Views", "[network]") {
+    const std::vector<u8> payload = MakePayload(64);
+
+    Packet packet;
+    packet.Write(std::string{"room"});
+    packet.Write(payload);
+
+    std::string_view name;
+    std::span<const u8> data;
+    packet.Read(name);
+    packet.Read(data);
+
+    REQUIRE(packet);
+    REQUIRE(name == "room");
+    REQUIRE(std::vector<u8>(data.begin(), data.end()) == payload);
+    REQUIRE(data.data() == static_cast<const u8*>(packet.GetData()) + 12);
+}
+
+TEST_CASE("Packet: Truncated reads", "[network]") {
+    Packet source;
+    source.Write(MakePayload(32));
+
+    Packet packet;
+    packet.Append(source.GetData(), source.GetDataSize() - 1);
+
+    std::vector<u8> data{1, 2, 3};
+    packet.Read(data);
+    REQUIRE(!packet);
+    REQUIRE(data.empty());
+
+    Packet view_packet;
+    view_packet.Append(source.GetData(), source.GetDataSize() - 1);
+    std::span<const u8> view;
+    view_packet.Read(view);
+    REQUIRE(!view_packet);
+    REQUIRE(view.empty());
+}
+
+TEST_CASE("Packet: Pooled storage", "[network]") {
+    const void* storage = nullptr;
+    {
+        Packet packet;
+        packet.Write(MakePayload(128));
+        storage = packet.GetData();
+    }
+    // The storage of the destroyed packet is handed to the next one
+    Packet packet;
+    packet.Write(u8{1});
+    REQUIRE(packet.GetData() == storage);
+
+    Packet moved = std::move(packet);
+    REQUIRE(moved.GetData() == storage);
+    REQUIRE(moved.GetDataSize() == 1);
+}
+
+// Benchmarks are hidden from the default run. Use `tests "[benchmark]"` to run them.
+TEST_CASE("Packet: LDN encode/decode benchmark", "[.][benchmark]") {
+    // Matches RoomMember::SendLdnPacket and HandleLdnPackets
+    const std::vector<u8> payload = MakePayload(1200);
+    const std::array<u8, 4> local_ip{192, 168, 1, 2};
+    const std::array<u8, 4> remote_ip{192, 168, 1, 3};
+
+    const auto encode = [&] {
+        Packet packet;
+        packet.Reserve(15 + payload.size());
+        packet.Write(static_cast<u8>(6));
+        packet.Write(static_cast<u8>(3));
+        packet.Write(local_ip);
+        packet.Write(remote_ip);
+        packet.Write(true);
+        packet.Write(payload);
+        return packet;
+    };
+
+    BENCHMARK("Encode 1200 bytes") {
+        return encode().GetDataSize();
+    };
+
+    const Packet encoded = encode();
+    BENCHMARK("Decode 1200 bytes") {
+        Packet packet;
+        packet.Append(encoded.GetData(), encoded.GetDataSize());
+        u8 type;
+        std::array<u8, 4> ip;
+        bool broadcast;
+        std::vector<u8> data;
+        packet.IgnoreBytes(sizeof(u8));
+        packet.Read(type);
+        packet.Read(ip);
+        packet.Read(ip);
+        packet.Read(broadcast);
+        packet.Read(data);
+        return data.size();
+    };
+
+    BENCHMARK("Decode 1200 bytes as view") {
+        Packet packet;
+        packet.Append(encoded.GetData(), encoded.GetDataSize());
+        u8 type;
+        std::array<u8, 4> ip;
+        bool broadcast;
+        std::span<const u8> data;
+        packet.IgnoreBytes(sizeof(u8));
+        packet.Read(type);
+        packet.Read(ip);
+        packet.Read(ip);
+        packet.Read(broadcast);
+        packet.Read(data);
+        return data.size();
+    };
+}
+
+} // namespace Network
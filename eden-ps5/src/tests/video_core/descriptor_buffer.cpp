@@ -0,0 +1,293 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/alignment.h"
+#include "common/common_types.h"
+#include "common/settings.h"
+#include "video_core/renderer_vulkan/vk_descriptor_buffer.h"
+#include "video_core/renderer_vulkan/vk_update_descriptor.h"
+#include "video_core/vulkan_common/vulkan_device.h"
+#include "video_core/vulkan_common/vulkan_instance.h"
+#include "video_core/vulkan_common/vulkan_library.h"
+#include "video_core/vulkan_common/vulkan_memory_allocator.h"
+#include "video_core/vulkan_common/vulkan_wrapper.h"
+
+// Benchmarks are hidden from the default run. Use `tests "[benchmark]"` to run them.
+// They need a Vulkan driver with VK_EXT_descriptor_buffer, such as lavapipe. Force it with
+// VK_ICD_FILENAMES=/usr/share/vulkan/icd.d/lvp_icd.x86_64.json when testing on a headless machine.
+namespace {
+
+using namespace Vulkan;
+
+// Descriptor layout of a typical draw: a few uniform buffers per stage and some storage buffers
+constexpr u32 NUM_UNIFORM_BUFFERS = 12;
+constexpr u32 NUM_STORAGE_BUFFERS = 4;
+constexpr u32 NUM_BINDINGS = NUM_UNIFORM_BUFFERS + NUM_STORAGE_BUFFERS;
+constexpr u32 NUM_SETS = 256;
+constexpr VkDeviceSize BUFFER_SIZE = 0x10000;
+
+struct HeadlessDevice {
+    HeadlessDevice() {
+        Settings::values.use_descriptor_buffer.SetValue(true);
+    }
+
+    // Other tests in the binary run with the setting they started with
+    ~HeadlessDevice() {
+        Settings::values.use_descriptor_buffer.SetValue(saved_use_descriptor_buffer);
+    }
+
+    bool saved_use_descriptor_buffer{Settings::values.use_descriptor_buffer.GetValue()};
+    std::shared_ptr<Common::DynamicLibrary> library;
+    vk::InstanceDispatch dld;
+    vk::Instance instance;
+    std::optional<Device> device;
+    std::optional<MemoryAllocator> memory_allocator;
+};
+
+std::unique_ptr<HeadlessDevice> CreateHeadlessDevice() try {
+    auto headless = std::make_unique<HeadlessDevice>();
+    headless->library = OpenLibrary();
+    headless->instance = CreateInstance(*headless->library, headless->dld, VK_API_VERSION_1_1);
+    for (const VkPhysicalDevice physical : headless->instance.EnumeratePhysicalDevices()) {
+        headless->device.emplace(*headless->instance, vk::PhysicalDevice(physical, headless->dld),
+                                 nullptr, headless->dld);
+        if (headless->device->IsExtDescriptorBufferSupported()) {
+            headless->memory_allocator.emplace(*headless->device);
+            return headless;
+        }
+        headless->device.reset();
+    }
+    return nullptr;
+} catch (const vk::Exception&) {
+    return nullptr;
+}
+
+std::array<VkDescriptorSetLayoutBinding, NUM_BINDINGS> MakeBindings() {
+    std::array<VkDescriptorSetLayoutBinding, NUM_BINDINGS> bindings{};
+    for (u32 binding = 0; binding < NUM_BINDINGS; ++binding) {
+        bindings[binding] = {
+            .binding = binding,
+            .descriptorType = binding < NUM_UNIFORM_BUFFERS ? VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER
+                                                            : VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+            .descriptorCount = 1,
+            .stageFlags = VK_SHADER_STAGE_ALL_GRAPHICS,
+            .pImmutableSamplers = nullptr,
+        };
+    }
+    return bindings;
+}
+
+vk::DescriptorSetLayout MakeSetLayout(const Device& device,
+                                      std::span<const VkDescriptorSetLayoutBinding> bindings,
+                                      VkDescriptorSetLayoutCreateFlags flags) {
+    return device.GetLogical().CreateDescriptorSetLayout({
+        .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO,
+        .pNext = nullptr,
+        .flags = flags,
+        .bindingCount = static_cast<u32>(bindings.size()),
+        .pBindings = bindings.data(),
+    });
+}
+
+vk::Buffer MakeBuffer(MemoryAllocator& allocator, VkDeviceSize size, VkBufferUsageFlags usage) {
+    return allocator.CreateBuffer(
+        {
+            .sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+            .pNext = nullptr,
+            .flags = 0,
+            .size = size,
+            .usage = usage,
+            .sharingMode = VK_SHARING_MODE_EXCLUSIVE,
+            .queueFamilyIndexCount = 0,
+            .pQueueFamilyIndices = nullptr,
+        },
+        MemoryUsage::Upload);
+}
+
+} // Anonymous namespace
+
+TEST_CASE("DescriptorBuffer: Written descriptors", "[video_core]") {
+    const std::unique_ptr<HeadlessDevice> headless{CreateHeadlessDevice()};
+    if (!headless) {
+        WARN("No Vulkan device with VK_EXT_descriptor_buffer is available");
+        return;
+    }
+    const Device& device{*headless->device};
+    const vk::Device& dev{device.GetLogical()};
+    const auto& properties{device.GetDescriptorBufferProperties()};
+    MemoryAllocator& allocator{*headless->memory_allocator};
+
+    constexpr VkBufferUsageFlags usage{VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT |
+                                       VK_BUFFER_USAGE_STORAGE_BUFFER_BIT |
+                                       VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT};
+    const std::array buffers{MakeBuffer(allocator, BUFFER_SIZE, usage),
+                             MakeBuffer(allocator, BUFFER_SIZE, usage)};
+    const VkDeviceSize alignment{std::max<VkDeviceSize>(device.GetUniformBufferAlignment(),
+                                                        device.GetStorageBufferAlignment())};
+    std::array<DescriptorUpdateEntry, NUM_BINDINGS> payload;
+    for (u32 index = 0; index < NUM_BINDINGS; ++index) {
+        // Bindings alternate between both buffers, so that cached addresses are told apart
+        payload[index] = VkDescriptorBufferInfo{
+            .buffer = *buffers[index % 2],
+            .offset = (index + 1) * alignment,
+            .range = 0x100 + index * 0x10,
+        };
+    }
+    const auto bindings{MakeBindings()};
+    const vk::DescriptorSetLayout set_layout{MakeSetLayout(
+        device, bindings, VK_DESCRIPTOR_SET_LAYOUT_CREATE_DESCRIPTOR_BUFFER_BIT_EXT)};
+    const DescriptorBufferLayout layout(device, *set_layout, bindings);
+    REQUIRE(layout.Size() == dev.GetDescriptorSetLayoutSizeEXT(*set_layout));
+    REQUIRE(layout.NumEntries() == NUM_BINDINGS);
+
+    // Bytes the layout does not cover must be left untouched
+    constexpr u8 SENTINEL = 0xCD;
+    std::vector<u8> written(layout.Size() + 64, SENTINEL);
+    DescriptorBufferAddressCache address_cache(device);
+    layout.Write(payload.data(), written.data(), address_cache);
+    REQUIRE(std::all_of(written.begin() + layout.Size(), written.end(),
+                        [](u8 value) { return value == SENTINEL; }));
+
+    for (u32 index = 0; index < NUM_BINDINGS; ++index) {
+        const VkDescriptorBufferInfo& info{payload[index].buffer};
+        REQUIRE(address_cache.Address(info.buffer) == dev.GetBufferDeviceAddress(info.buffer));
+
+        const bool is_uniform{bindings[index].descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER};
+        const size_t descriptor_size{is_uniform ? properties.robustUniformBufferDescriptorSize
+                                                : properties.robustStorageBufferDescriptorSize};
+        const VkDescriptorAddressInfoEXT address_info{
+            .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_ADDRESS_INFO_EXT,
+            .pNext = nullptr,
+            .address = dev.GetBufferDeviceAddress(info.buffer) + info.offset,
+            .range = info.range,
+            .format = VK_FORMAT_UNDEFINED,
+        };
+        VkDescriptorGetInfoEXT get_info{
+            .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_GET_INFO_EXT,
+            .pNext = nullptr,
+            .type = bindings[index].descriptorType,
+            .data{},
+        };
+        if (is_uniform) {
+            get_info.data.pUniformBuffer = &address_info;
+        } else {
+            get_info.data.pStorageBuffer = &address_info;
+        }
+        std::vector<u8> expected(descriptor_size);
+        dev.GetDescriptorEXT(get_info, descriptor_size, expected.data());
+
+        const VkDeviceSize offset{dev.GetDescriptorSetLayoutBindingOffsetEXT(*set_layout, index)};
+        REQUIRE(offset + descriptor_size <= layout.Size());
+        REQUIRE(std::equal(expected.begin(), expected.end(), written.begin() + offset));
+    }
+}
+
+TEST_CASE("DescriptorBuffer: Per-draw descriptor updates", "[.][benchmark]") {
+    const std::unique_ptr<HeadlessDevice> headless{CreateHeadlessDevice()};
+    if (!headless) {
+        WARN("No Vulkan device with VK_EXT_descriptor_buffer is available");
+        return;
+    }
+    const Device& device{*headless->device};
+    const vk::Device& dev{device.GetLogical()};
+    MemoryAllocator& allocator{*headless->memory_allocator};
+
+    const vk::Buffer buffer{MakeBuffer(allocator, BUFFER_SIZE,
+                                       VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT |
+                                           VK_BUFFER_USAGE_STORAGE_BUFFER_BIT)};
+    std::array<DescriptorUpdateEntry, NUM_BINDINGS> payload;
+    for (u32 index = 0; index < NUM_BINDINGS; ++index) {
+        payload[index] = VkDescriptorBufferInfo{
+            .buffer = *buffer,
+            .offset = index * device.GetUniformBufferAlignment(),
+            .range = 0x100,
+        };
+    }
+    const auto bindings{MakeBindings()};
+
+    // Descriptor sets updated through a template, as the current binding model does
+    const vk::DescriptorSetLayout set_layout{MakeSetLayout(device, bindings, 0)};
+    const std::array pool_sizes{
+        VkDescriptorPoolSize{VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, NUM_UNIFORM_BUFFERS * NUM_SETS},
+        VkDescriptorPoolSize{VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, NUM_STORAGE_BUFFERS * NUM_SETS},
+    };
+    const vk::DescriptorPool pool{dev.CreateDescriptorPool({
+        .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO,
+        .pNext = nullptr,
+        .flags = VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT,
+        .maxSets = NUM_SETS,
+        .poolSizeCount = static_cast<u32>(pool_sizes.size()),
+        .pPoolSizes = pool_sizes.data(),
+    })};
+    const std::vector<VkDescriptorSetLayout> set_layouts(NUM_SETS, *set_layout);
+    const vk::DescriptorSets sets{pool.Allocate({
+        .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO,
+        .pNext = nullptr,
+        .descriptorPool = *pool,
+        .descriptorSetCount = NUM_SETS,
+        .pSetLayouts = set_layouts.data(),
+    })};
+    std::array<VkDescriptorUpdateTemplateEntry, NUM_BINDINGS> entries{};
+    for (u32 index = 0; index < NUM_BINDINGS; ++index) {
+        entries[index] = {
+            .dstBinding = index,
+            .dstArrayElement = 0,
+            .descriptorCount = 1,
+            .descriptorType = bindings[index].descriptorType,
+            .offset = index * sizeof(DescriptorUpdateEntry),
+            .stride = sizeof(DescriptorUpdateEntry),
+        };
+    }
+    const vk::DescriptorUpdateTemplate update_template{dev.CreateDescriptorUpdateTemplate({
+        .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO,
+        .pNext = nullptr,
+        .flags = 0,
+        .descriptorUpdateEntryCount = static_cast<u32>(entries.size()),
+        .pDescriptorUpdateEntries = entries.data(),
+        .templateType = VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET,
+        .descriptorSetLayout = *set_layout,
+        .pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS,
+        .pipelineLayout = VK_NULL_HANDLE,
+        .set = 0,
+    })};
+
+    // The same descriptors written into a persistently mapped descriptor buffer
+    const vk::DescriptorSetLayout buffer_set_layout{MakeSetLayout(
+        device, bindings, VK_DESCRIPTOR_SET_LAYOUT_CREATE_DESCRIPTOR_BUFFER_BIT_EXT)};
+    const DescriptorBufferLayout layout(device, *buffer_set_layout, bindings);
+    const VkDeviceSize stride{
+        Common::AlignUp(layout.Size(),
+                        device.GetDescriptorBufferProperties().descriptorBufferOffsetAlignment)};
+    vk::Buffer descriptor_buffer{MakeBuffer(allocator, stride * NUM_SETS,
+                                            VK_BUFFER_USAGE_RESOURCE_DESCRIPTOR_BUFFER_BIT_EXT |
+                                                VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT)};
+    u8* const mapped{descriptor_buffer.Mapped().data()};
+    REQUIRE(mapped != nullptr);
+    DescriptorBufferAddressCache address_cache(device);
+
+    size_t draw{};
+    BENCHMARK("Descriptor set template update") {
+        const size_t index{draw++ % NUM_SETS};
+        dev.UpdateDescriptorSet(sets[index], *update_template, payload.data());
+        return index;
+    };
+    BENCHMARK("Descriptor buffer write") {
+        const size_t index{draw++ % NUM_SETS};
+        layout.Write(payload.data(), mapped + index * stride, address_cache);
+        return index;
+    };
+    const std::array<DescriptorUpdateEntry, NUM_BINDINGS> previous{payload};
+    BENCHMARK("Descriptor buffer reuse") {
+        return layout.Equal(payload.data(), previous.data());
+    };
+}
@@ -0,0 +1,68 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "video_core/host1x/host1x.h"
+
+namespace {
+using Tegra::Host1x::FrameQueue;
+
+constexpr s32 NVDEC_FD = 1;
+constexpr u64 LUMA_OFFSET = 0x10000;
+} // Anonymous namespace
+
+TEST_CASE("FrameQueue: Frame lookups wait for pending decodes", "[video_core]") {
+    FrameQueue frame_queue;
+    frame_queue.Open(NVDEC_FD);
+    frame_queue.BeginDecode(NVDEC_FD);
+
+    std::atomic<bool> pushed{};
+    std::jthread decoder([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        pushed = true;
+        frame_queue.PushPresentOrder(NVDEC_FD, LUMA_OFFSET, {});
+        frame_queue.EndDecode(NVDEC_FD);
+    });
+
+    REQUIRE(frame_queue.VicFindNvdecFdFromOffset(LUMA_OFFSET) == NVDEC_FD);
+    REQUIRE(pushed);
+}
+
+TEST_CASE("FrameQueue: Decodes without a frame release lookups", "[video_core]") {
+    FrameQueue frame_queue;
+    frame_queue.Open(NVDEC_FD);
+    frame_queue.BeginDecode(NVDEC_FD);
+    frame_queue.BeginDecode(NVDEC_FD);
+
+    std::jthread decoder([&] {
+        // A hidden frame pushes nothing, the visible one after it does
+        frame_queue.EndDecode(NVDEC_FD);
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        frame_queue.PushPresentOrder(NVDEC_FD, LUMA_OFFSET, {});
+        frame_queue.EndDecode(NVDEC_FD);
+    });
+
+    REQUIRE(frame_queue.VicFindNvdecFdFromOffset(LUMA_OFFSET) == NVDEC_FD);
+    decoder.join();
+
+    frame_queue.BeginDecode(NVDEC_FD);
+    frame_queue.EndDecode(NVDEC_FD);
+    REQUIRE(frame_queue.VicFindNvdecFdFromOffset(LUMA_OFFSET + 0x1000) == -1);
+}
+
+TEST_CASE("FrameQueue: Closing releases pending decodes", "[video_core]") {
+    FrameQueue frame_queue;
+    frame_queue.Open(NVDEC_FD);
+    frame_queue.BeginDecode(NVDEC_FD);
+    frame_queue.Close(NVDEC_FD);
+    REQUIRE(frame_queue.VicFindNvdecFdFromOffset(LUMA_OFFSET) == -1);
+    // Ending a decode after the close is ignored
+    frame_queue.EndDecode(NVDEC_FD);
+    REQUIRE(frame_queue.GetFrame(NVDEC_FD, LUMA_OFFSET) == nullptr);
+}
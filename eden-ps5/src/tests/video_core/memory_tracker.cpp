@@ -4,7 +4,9 @@
 #include <memory>
 #include <stdexcept>
 #include <unordered_map>
+#include <vector>
 
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 
 #include "common/common_types.h"
@@ -56,6 +58,19 @@ private:
 
 using MemoryTracker = VideoCommon::MemoryTrackerBase<RasterizerInterface>;
 
+namespace {
+constexpr u64 BENCHMARK_SIZE = HIGH_PAGE_SIZE * 64;
+
+/// Marks one page every stride bytes of a clean region as modified by the CPU and the GPU
+void MarkPattern(MemoryTracker& memory_track, u64 stride) {
+    memory_track.UnmarkRegionAsCpuModified(c, BENCHMARK_SIZE);
+    for (u64 offset = 0; offset < BENCHMARK_SIZE; offset += stride) {
+        memory_track.MarkRegionAsCpuModified(c + offset, PAGE);
+        memory_track.MarkRegionAsGpuModified(c + offset, PAGE);
+    }
+}
+} // Anonymous namespace
+
 TEST_CASE("MemoryTracker: Small region", "[video_core]") {
     RasterizerInterface rasterizer;
     std::unique_ptr<MemoryTracker> memory_track(std::make_unique<MemoryTracker>(rasterizer));
@@ -544,3 +559,99 @@ TEST_CASE("MemoryTracker: Cached write downloads") {
     memory_track->MarkRegionAsCpuModified(c, WORD);
     REQUIRE(rasterizer.Count() == 0);
 }
+
+TEST_CASE("MemoryTracker: Sparse words across regions", "[video_core]") {
+    RasterizerInterface rasterizer;
+    std::unique_ptr<MemoryTracker> memory_track(std::make_unique<MemoryTracker>(rasterizer));
+    constexpr u64 size = HIGH_PAGE_SIZE * 4;
+    memory_track->UnmarkRegionAsCpuModified(c, size);
+    REQUIRE(rasterizer.Count() == size / PAGE);
+
+    std::vector<Range> expected;
+    for (u64 offset = WORD * 3 + PAGE * 5; offset < size; offset += WORD * 7 + PAGE * 3) {
+        memory_track->MarkRegionAsCpuModified(c + offset, PAGE * 2);
+        expected.emplace_back(c + offset, PAGE * 2);
+    }
+    REQUIRE(!memory_track->IsRegionCpuModified(c, WORD * 3));
+    REQUIRE(!memory_track->IsRegionCpuModified(c + WORD * 3 + PAGE * 7, WORD * 7 + PAGE));
+    REQUIRE(memory_track->IsRegionCpuModified(c + WORD * 3 + PAGE * 6, WORD * 7));
+    REQUIRE(memory_track->ModifiedCpuRegion(c, size) ==
+            Range{expected.front().first, expected.back().first + expected.back().second});
+
+    std::vector<Range> uploads;
+    memory_track->ForEachUploadRange(
+        c, size, [&](u64 offset, u64 range_size) { uploads.emplace_back(offset, range_size); });
+    REQUIRE(uploads == expected);
+    REQUIRE(!memory_track->IsRegionCpuModified(c, size));
+    REQUIRE(rasterizer.Count() == size / PAGE);
+
+    memory_track->MarkRegionAsGpuModified(c + WORD * 40 + PAGE * 63, PAGE * 2);
+    REQUIRE(memory_track->ModifiedGpuRegion(c, size) ==
+            Range{c + WORD * 40 + PAGE * 63, c + WORD * 41 + PAGE});
+    int num = 0;
+    memory_track->ForEachDownloadRangeAndClear(c, size, [&](u64 offset, u64 range_size) {
+        REQUIRE(offset == c + WORD * 40 + PAGE * 63);
+        REQUIRE(range_size == PAGE * 2);
+        ++num;
+    });
+    REQUIRE(num == 1);
+    REQUIRE(!memory_track->IsRegionGpuModified(c, size));
+}
+
+TEST_CASE("MemoryTracker: Cached writes across words", "[video_core]") {
+    RasterizerInterface rasterizer;
+    std::unique_ptr<MemoryTracker> memory_track(std::make_unique<MemoryTracker>(rasterizer));
+    memory_track->UnmarkRegionAsCpuModified(c, WORD * 16);
+    memory_track->CachedCpuWrite(c + WORD * 2 + PAGE, PAGE);
+    memory_track->CachedCpuWrite(c + WORD * 13, PAGE);
+    REQUIRE(!memory_track->IsRegionCpuModified(c, WORD * 16));
+    memory_track->FlushCachedWrites();
+    REQUIRE(memory_track->ModifiedCpuRegion(c, WORD * 16) ==
+            Range{c + WORD * 2 + PAGE, c + WORD * 13 + PAGE});
+    memory_track->UnmarkRegionAsCpuModified(c, WORD * 16);
+    REQUIRE(!memory_track->IsRegionCpuModified(c, WORD * 16));
+    memory_track->MarkRegionAsCpuModified(c, WORD * 16);
+    REQUIRE(rasterizer.Count() == 0);
+}
+
+// Benchmarks are hidden from the default run. Use `tests "[benchmark]"` to run them.
+TEST_CASE("MemoryTracker: Sparse scan benchmark", "[.][benchmark]") {
+    RasterizerInterface rasterizer;
+    std::unique_ptr<MemoryTracker> memory_track(std::make_unique<MemoryTracker>(rasterizer));
+    MarkPattern(*memory_track, HIGH_PAGE_SIZE * 4 + PAGE * 17);
+
+    BENCHMARK("Modified CPU region") {
+        return memory_track->ModifiedCpuRegion(c, BENCHMARK_SIZE);
+    };
+    BENCHMARK("Clean CPU query") {
+        return memory_track->IsRegionCpuModified(c + PAGE * 18, HIGH_PAGE_SIZE * 4 - PAGE);
+    };
+    BENCHMARK("GPU download ranges") {
+        u64 total{};
+        memory_track->ForEachDownloadRange(c, BENCHMARK_SIZE, false,
+                                           [&](u64, u64 size) { total += size; });
+        return total;
+    };
+    BENCHMARK("Upload after sparse writes") {
+        memory_track->MarkRegionAsCpuModified(c + HIGH_PAGE_SIZE * 9, PAGE);
+        u64 total{};
+        memory_track->ForEachUploadRange(c, BENCHMARK_SIZE, [&](u64, u64 size) { total += size; });
+        return total;
+    };
+}
+
+TEST_CASE("MemoryTracker: Dense scan benchmark", "[.][benchmark]") {
+    RasterizerInterface rasterizer;
+    std::unique_ptr<MemoryTracker> memory_track(std::make_unique<MemoryTracker>(rasterizer));
+    MarkPattern(*memory_track, PAGE * 2);
+
+    BENCHMARK("Modified CPU region") {
+        return memory_track->ModifiedCpuRegion(c, BENCHMARK_SIZE);
+    };
+    BENCHMARK("GPU download ranges") {
+        u64 total{};
+        memory_track->ForEachDownloadRange(c, BENCHMARK_SIZE, false,
+                                           [&](u64, u64 size) { total += size; });
+        return total;
+    };
+}
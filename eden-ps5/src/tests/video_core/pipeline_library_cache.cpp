@@ -0,0 +1,141 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <array>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "video_core/renderer_vulkan/vk_pipeline_library_cache.h"
+#include "video_core/vulkan_common/vulkan_wrapper.h"
+
+namespace {
+
+using Vulkan::PipelineLayoutHash;
+using Vulkan::PipelineLibraryHash;
+
+constexpr VkGraphicsPipelineLibraryFlagsEXT PRE_RASTERIZATION =
+    VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT;
+constexpr VkGraphicsPipelineLibraryFlagsEXT FRAGMENT_OUTPUT =
+    VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT;
+
+/// State of a pipeline, built separately for each call like the pipelines build theirs.
+struct PipelineState {
+    explicit PipelineState(bool blend_enable) {
+        attachment.blendEnable = blend_enable ? VK_TRUE : VK_FALSE;
+        attachment.colorWriteMask = VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT |
+                                    VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
+    }
+
+    VkGraphicsPipelineCreateInfo PreRasterization() const {
+        return {
+            .sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO,
+            .stageCount = 1,
+            .pStages = &vertex_stage,
+            .pViewportState = &viewport,
+            .pRasterizationState = &rasterization,
+            .pDynamicState = &dynamic,
+            .layout = layout,
+        };
+    }
+
+    VkGraphicsPipelineCreateInfo FragmentOutput() const {
+        return {
+            .sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO,
+            .pMultisampleState = &multisample,
+            .pColorBlendState = &color_blend,
+            .pDynamicState = &dynamic,
+        };
+    }
+
+    // Layouts and modules differ between pipelines, only their hashes identify them
+    VkPipelineLayout layout{reinterpret_cast<VkPipelineLayout>(&layout)};
+    VkPipelineShaderStageCreateInfo vertex_stage{
+        .sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO,
+        .stage = VK_SHADER_STAGE_VERTEX_BIT,
+        .pName = "main",
+    };
+    VkPipelineViewportStateCreateInfo viewport{
+        .sType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO,
+        .viewportCount = 1,
+        .scissorCount = 1,
+    };
+    VkPipelineRasterizationStateCreateInfo rasterization{
+        .sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO,
+        .polygonMode = VK_POLYGON_MODE_FILL,
+        .cullMode = VK_CULL_MODE_BACK_BIT,
+        .frontFace = VK_FRONT_FACE_COUNTER_CLOCKWISE,
+        .lineWidth = 1.0f,
+    };
+    VkPipelineMultisampleStateCreateInfo multisample{
+        .sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO,
+        .rasterizationSamples = VK_SAMPLE_COUNT_1_BIT,
+    };
+    VkPipelineColorBlendAttachmentState attachment{};
+    VkPipelineColorBlendStateCreateInfo color_blend{
+        .sType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO,
+        .attachmentCount = 1,
+        .pAttachments = &attachment,
+    };
+    std::array<VkDynamicState, 2> dynamic_states{VK_DYNAMIC_STATE_VIEWPORT,
+                                                 VK_DYNAMIC_STATE_SCISSOR};
+    VkPipelineDynamicStateCreateInfo dynamic{
+        .sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO,
+        .dynamicStateCount = static_cast<u32>(dynamic_states.size()),
+        .pDynamicStates = dynamic_states.data(),
+    };
+};
+
+constexpr std::array<u64, 1> VERTEX_HASH{0x1234};
+constexpr std::array<u64, 1> OTHER_VERTEX_HASH{0x5678};
+constexpr u64 LAYOUT_HASH = 0x9abc;
+
+} // Anonymous namespace
+
+TEST_CASE("PipelineLibraryHash: Shared subsets", "[video_core]") {
+    const PipelineState opaque{false};
+    const PipelineState blended{true};
+
+    // Pipelines only differing in their blending share the pre-rasterization library
+    REQUIRE(PipelineLibraryHash(PRE_RASTERIZATION, opaque.PreRasterization(), VERTEX_HASH,
+                                LAYOUT_HASH) ==
+            PipelineLibraryHash(PRE_RASTERIZATION, blended.PreRasterization(), VERTEX_HASH,
+                                LAYOUT_HASH));
+    REQUIRE(PipelineLibraryHash(FRAGMENT_OUTPUT, opaque.FragmentOutput(), {}, LAYOUT_HASH) !=
+            PipelineLibraryHash(FRAGMENT_OUTPUT, blended.FragmentOutput(), {}, LAYOUT_HASH));
+
+    // Equal state for different subsets builds different libraries
+    REQUIRE(PipelineLibraryHash(PRE_RASTERIZATION, opaque.FragmentOutput(), {}, LAYOUT_HASH) !=
+            PipelineLibraryHash(FRAGMENT_OUTPUT, opaque.FragmentOutput(), {}, LAYOUT_HASH));
+}
+
+TEST_CASE("PipelineLibraryHash: Shaders and layouts", "[video_core]") {
+    const PipelineState state{false};
+    const u64 hash{
+        PipelineLibraryHash(PRE_RASTERIZATION, state.PreRasterization(), VERTEX_HASH, LAYOUT_HASH)};
+    REQUIRE(hash != PipelineLibraryHash(PRE_RASTERIZATION, state.PreRasterization(),
+                                        OTHER_VERTEX_HASH, LAYOUT_HASH));
+    REQUIRE(hash != PipelineLibraryHash(PRE_RASTERIZATION, state.PreRasterization(), VERTEX_HASH,
+                                        LAYOUT_HASH + 1));
+
+    // Libraries without a layout don't depend on it
+    REQUIRE(PipelineLibraryHash(FRAGMENT_OUTPUT, state.FragmentOutput(), {}, LAYOUT_HASH) ==
+            PipelineLibraryHash(FRAGMENT_OUTPUT, state.FragmentOutput(), {}, LAYOUT_HASH + 1));
+
+    PipelineState culled_front{false};
+    culled_front.rasterization.cullMode = VK_CULL_MODE_FRONT_BIT;
+    REQUIRE(hash != PipelineLibraryHash(PRE_RASTERIZATION, culled_front.PreRasterization(),
+                                        VERTEX_HASH, LAYOUT_HASH));
+
+    const std::array<VkDescriptorSetLayoutBinding, 1> bindings{{{
+        .binding = 0,
+        .descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,
+        .descriptorCount = 1,
+        .stageFlags = VK_SHADER_STAGE_VERTEX_BIT,
+        .pImmutableSamplers = nullptr,
+    }}};
+    const u64 layout_hash{PipelineLayoutHash(bindings, false, false)};
+    REQUIRE(layout_hash == PipelineLayoutHash(bindings, false, false));
+    REQUIRE(layout_hash != PipelineLayoutHash(bindings, true, false));
+    REQUIRE(layout_hash != PipelineLayoutHash({}, false, false));
+}
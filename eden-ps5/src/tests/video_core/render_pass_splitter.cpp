@@ -0,0 +1,163 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "video_core/renderer_vulkan/vk_render_pass_splitter.h"
+
+namespace {
+
+using Vulkan::RenderPassSplitter;
+using Action = RenderPassSplitter::Action;
+
+constexpr u32 INLINE_DRAWS = 4;
+constexpr u32 SECONDARY_DRAWS = 8;
+
+/// Records draws the way the scheduler and the graphics pipelines do, keeping track of the
+/// command buffer each command goes to.
+class Recorder {
+public:
+    explicit Recorder(bool enabled = true) : splitter{enabled, INLINE_DRAWS, SECONDARY_DRAWS} {}
+
+    void RequestRenderpass(u32 framebuffer) {
+        if (framebuffer == current_framebuffer) {
+            return;
+        }
+        EndRenderPass();
+        current_framebuffer = framebuffer;
+        splitter.BeginRenderPass();
+    }
+
+    void EndRenderPass() {
+        if (current_framebuffer == 0) {
+            return;
+        }
+        if (splitter.EndRenderPass()) {
+            ++command_buffer;
+        }
+        current_framebuffer = 0;
+    }
+
+    /// Records a draw, returns true when its geometry is bound in the command buffer it is in.
+    bool Draw(u32 framebuffer, bool uses_queries = false) {
+        switch (splitter.NotifyDraw(uses_queries)) {
+        case Action::None:
+            break;
+        case Action::BeginSecondaries:
+            EndRenderPass();
+            current_framebuffer = framebuffer;
+            splitter.BeginSecondaries();
+            ++command_buffer;
+            ++num_secondaries;
+            break;
+        case Action::SplitSecondary:
+            splitter.SplitSecondary();
+            ++command_buffer;
+            ++num_secondaries;
+            break;
+        case Action::EndSecondaries:
+            EndRenderPass();
+            (void)splitter.ConsumeLostBindings();
+            break;
+        }
+        geometry_command_buffer = command_buffer;
+        RequestRenderpass(framebuffer);
+        if (splitter.ConsumeLostBindings()) {
+            geometry_command_buffer = command_buffer;
+            ++num_rebinds;
+        }
+        return geometry_command_buffer == command_buffer;
+    }
+
+    RenderPassSplitter splitter;
+    u32 current_framebuffer = 0;
+    u32 command_buffer = 0;
+    u32 geometry_command_buffer = 0;
+    u32 num_secondaries = 0;
+    u32 num_rebinds = 0;
+};
+
+} // Anonymous namespace
+
+TEST_CASE("RenderPassSplitter: Secondaries", "[video_core]") {
+    Recorder recorder;
+    // The first draw begins the renderpass
+    for (u32 draw = 0; draw <= INLINE_DRAWS; ++draw) {
+        REQUIRE(recorder.Draw(1));
+        REQUIRE(!recorder.splitter.IsSecondary());
+    }
+    REQUIRE(recorder.Draw(1));
+    REQUIRE(recorder.splitter.IsSecondary());
+    REQUIRE(recorder.num_secondaries == 1);
+
+    for (u32 draw = 1; draw < SECONDARY_DRAWS; ++draw) {
+        REQUIRE(recorder.Draw(1));
+    }
+    REQUIRE(recorder.num_secondaries == 1);
+    REQUIRE(recorder.Draw(1));
+    REQUIRE(recorder.num_secondaries == 2);
+    REQUIRE(recorder.num_rebinds == 0);
+
+    Recorder disabled{false};
+    for (u32 draw = 0; draw < INLINE_DRAWS + SECONDARY_DRAWS * 2; ++draw) {
+        REQUIRE(disabled.Draw(1));
+    }
+    REQUIRE(!disabled.splitter.IsSecondary());
+    REQUIRE(disabled.num_secondaries == 0);
+}
+
+TEST_CASE("RenderPassSplitter: Framebuffer change mid-secondary", "[video_core]") {
+    Recorder recorder;
+    while (!recorder.splitter.IsSecondary()) {
+        REQUIRE(recorder.Draw(1));
+    }
+
+    // The geometry is bound inside of the secondary, before the new renderpass ends it
+    REQUIRE(recorder.Draw(2));
+    REQUIRE(recorder.num_rebinds == 1);
+    REQUIRE(!recorder.splitter.IsSecondary());
+
+    // The loss is only reported to the draw that ended the secondary
+    REQUIRE(recorder.Draw(2));
+    REQUIRE(recorder.num_rebinds == 1);
+
+    // Ending an inline renderpass keeps the bindings of the main command buffer
+    REQUIRE(recorder.Draw(3));
+    REQUIRE(recorder.num_rebinds == 1);
+
+    // Bindings lost between draws are not reported, the state invalidation rebinds them
+    while (!recorder.splitter.IsSecondary()) {
+        REQUIRE(recorder.Draw(3));
+    }
+    recorder.EndRenderPass();
+    REQUIRE(recorder.Draw(3));
+    REQUIRE(recorder.num_rebinds == 1);
+}
+
+TEST_CASE("RenderPassSplitter: Draws using queries", "[video_core]") {
+    Recorder recorder;
+    for (u32 draw = 0; draw < INLINE_DRAWS * 4; ++draw) {
+        REQUIRE(recorder.Draw(1, true));
+        REQUIRE(!recorder.splitter.IsSecondary());
+    }
+
+    while (!recorder.splitter.IsSecondary()) {
+        REQUIRE(recorder.Draw(1));
+    }
+    const u32 num_secondaries = recorder.num_secondaries;
+
+    // The secondaries end before the draw is recorded, so nothing has to be bound again
+    REQUIRE(recorder.Draw(1, true));
+    REQUIRE(!recorder.splitter.IsSecondary());
+    REQUIRE(recorder.num_secondaries == num_secondaries);
+    REQUIRE(recorder.num_rebinds == 0);
+
+    // Draws without queries go back to secondaries after the inline draws
+    for (u32 draw = 0; draw < INLINE_DRAWS; ++draw) {
+        REQUIRE(recorder.Draw(1));
+        REQUIRE(!recorder.splitter.IsSecondary());
+    }
+    REQUIRE(recorder.Draw(1));
+    REQUIRE(recorder.splitter.IsSecondary());
+}
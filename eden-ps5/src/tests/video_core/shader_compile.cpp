@@ -0,0 +1,359 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <fmt/format.h>
+#include <spirv-tools/libspirv.hpp>
+
+#include "common/common_types.h"
+#include "shader_recompiler/arena.h"
+#include "shader_recompiler/backend/spirv/emit_spirv.h"
+#include "shader_recompiler/exception.h"
+#include "shader_recompiler/frontend/ir/basic_block.h"
+#include "shader_recompiler/frontend/ir/ir_emitter.h"
+#include "shader_recompiler/frontend/maxwell/control_flow.h"
+#include "shader_recompiler/frontend/maxwell/translate_program.h"
+#include "shader_recompiler/host_translate_info.h"
+#include "shader_recompiler/ir_opt/passes.h"
+#include "shader_recompiler/object_pool.h"
+#include "shader_recompiler/profile.h"
+#include "shader_recompiler/program_header.h"
+#include "video_core/renderer_vulkan/vk_pipeline_cache.h"
+#include "video_core/shader_environment.h"
+
+// Benchmarks are hidden from the default run. Use `tests "[benchmark]"` to run them.
+// The shader compile benchmarks replay the environments stored in Vulkan pipeline caches. Point
+// EDEN_SHADER_CACHE_DIR to a directory containing them, such as the "shader" folder of the user
+// directory; every vulkan.bin found under it is loaded.
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+enum class Stage : size_t {
+    ControlFlow,
+    Translate,
+    Emit,
+};
+constexpr size_t NUM_STAGES = 3;
+constexpr std::array<const char*, NUM_STAGES> STAGE_NAMES{"CFG", "Translate+Optimize", "EmitSPIRV"};
+
+struct StageStats {
+    std::chrono::nanoseconds total_time{};
+    std::chrono::nanoseconds max_time{};
+    size_t max_arena_bytes{};
+};
+
+/// Reads every environment of a pipeline cache without validating its version.
+void LoadEnvironments(const std::filesystem::path& filename,
+                      std::vector<VideoCommon::FileEnvironment>& envs) try {
+    std::ifstream file(filename, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) {
+        return;
+    }
+    file.exceptions(std::ifstream::failbit);
+    const auto end{file.tellg()};
+    file.seekg(0, std::ios::beg);
+
+    std::array<char, 8> magic_number;
+    u32 cache_version;
+    file.read(magic_number.data(), magic_number.size())
+        .read(reinterpret_cast<char*>(&cache_version), sizeof(cache_version));
+    while (file.tellg() != end) {
+        u32 num_envs{};
+        file.read(reinterpret_cast<char*>(&num_envs), sizeof(num_envs));
+        size_t key_size{sizeof(Vulkan::GraphicsPipelineCacheKey)};
+        for (u32 index = 0; index < num_envs; ++index) {
+            VideoCommon::FileEnvironment& env{envs.emplace_back()};
+            env.Deserialize(file);
+            if (env.ShaderStage() == Shader::Stage::Compute) {
+                key_size = sizeof(Vulkan::ComputePipelineCacheKey);
+            }
+        }
+        file.seekg(key_size, std::ios::cur);
+    }
+} catch (const std::ios_base::failure& e) {
+    WARN(fmt::format("Failed to read {}: {}", filename.string(), e.what()));
+}
+
+/// Loads every pipeline cache under EDEN_SHADER_CACHE_DIR.
+std::vector<VideoCommon::FileEnvironment> LoadCacheEnvironments() {
+    std::vector<VideoCommon::FileEnvironment> envs;
+    const char* const cache_dir{std::getenv("EDEN_SHADER_CACHE_DIR")};
+    if (!cache_dir) {
+        WARN("EDEN_SHADER_CACHE_DIR is not set");
+        return envs;
+    }
+    for (const auto& entry : std::filesystem::recursive_directory_iterator(cache_dir)) {
+        if (entry.is_regular_file() && entry.path().filename() == "vulkan.bin") {
+            LoadEnvironments(entry.path(), envs);
+        }
+    }
+    if (envs.empty()) {
+        WARN("No shader environments were found");
+    }
+    return envs;
+}
+
+/// Returns the number of instructions in a SPIR-V module.
+size_t CountSpirvInstructions(const std::vector<u32>& code) {
+    constexpr size_t HEADER_WORDS = 5;
+    size_t count{};
+    for (size_t word = HEADER_WORDS; word < code.size(); word += std::max(code[word] >> 16, 1U)) {
+        ++count;
+    }
+    return count;
+}
+
+size_t CountOpcode(const Shader::IR::Program& program, Shader::IR::Opcode opcode) {
+    size_t count{};
+    for (const Shader::IR::Block* const block : program.blocks) {
+        for (const Shader::IR::Inst& inst : block->Instructions()) {
+            count += inst.GetOpcode() == opcode ? 1 : 0;
+        }
+    }
+    return count;
+}
+
+void RunRedundancyPasses(Shader::IR::Program& program) {
+    Shader::Optimization::LoopInvariantCodeMotionPass(program);
+    Shader::Optimization::GlobalValueNumberingPass(program);
+    Shader::Optimization::IdentityRemovalPass(program);
+    Shader::Optimization::DeadCodeEliminationPass(program);
+    Shader::Optimization::VerificationPass(program);
+}
+
+} // Anonymous namespace
+
+TEST_CASE("ShaderCompile: Replay pipeline cache environments", "[.][benchmark]") {
+    std::vector<VideoCommon::FileEnvironment> envs{LoadCacheEnvironments()};
+    if (envs.empty()) {
+        return;
+    }
+
+    const Shader::Profile profile{
+        .supported_spirv = 0x00010300,
+        .support_int64 = true,
+    };
+    const Shader::HostTranslateInfo host_info{
+        .support_float64 = true,
+        .support_float16 = true,
+        .support_int64 = true,
+        .min_ssbo_alignment = 16,
+    };
+    Shader::ObjectPool<Shader::IR::Inst> inst_pool{8192};
+    Shader::ObjectPool<Shader::IR::Block> block_pool{32};
+    Shader::ObjectPool<Shader::Maxwell::Flow::Block> flow_block_pool{32};
+    Shader::Arena arena;
+
+    std::array<StageStats, NUM_STAGES> stats{};
+    size_t num_failed{};
+    const auto record{[&](Stage stage, Clock::time_point start) {
+        StageStats& stage_stats{stats[static_cast<size_t>(stage)]};
+        const std::chrono::nanoseconds time{Clock::now() - start};
+        stage_stats.total_time += time;
+        stage_stats.max_time = std::max(stage_stats.max_time, time);
+        stage_stats.max_arena_bytes = std::max(stage_stats.max_arena_bytes, arena.BytesAllocated());
+    }};
+    for (VideoCommon::FileEnvironment& env : envs) {
+        inst_pool.ReleaseContents();
+        block_pool.ReleaseContents();
+        flow_block_pool.ReleaseContents();
+        arena.Release();
+
+        const Shader::ArenaScope arena_scope{arena};
+        const bool is_compute{env.ShaderStage() == Shader::Stage::Compute};
+        const bool is_vertex_a{env.ShaderStage() == Shader::Stage::VertexA};
+        const u32 cfg_offset{is_compute ? env.StartAddress()
+                                        : static_cast<u32>(env.StartAddress() +
+                                                           sizeof(Shader::ProgramHeader))};
+        try {
+            auto start{Clock::now()};
+            Shader::Maxwell::Flow::CFG cfg(env, flow_block_pool, cfg_offset, is_vertex_a);
+            record(Stage::ControlFlow, start);
+
+            start = Clock::now();
+            Shader::IR::Program program{
+                Shader::Maxwell::TranslateProgram(inst_pool, block_pool, env, cfg, host_info)};
+            record(Stage::Translate, start);
+
+            // VertexA programs are merged into VertexB before they are emitted
+            if (is_vertex_a) {
+                continue;
+            }
+            start = Clock::now();
+            const Shader::RuntimeInfo runtime_info{};
+            Shader::Maxwell::ConvertLegacyToGeneric(program, runtime_info);
+            Shader::Backend::Bindings bindings;
+            const std::vector<u32> code{
+                Shader::Backend::SPIRV::EmitSPIRV(profile, runtime_info, program, bindings, false)};
+            record(Stage::Emit, start);
+            CHECK(!code.empty());
+        } catch (const Shader::Exception&) {
+            ++num_failed;
+        }
+    }
+
+    fmt::print("Compiled {} shaders, {} failed\n", envs.size() - num_failed, num_failed);
+    for (size_t stage = 0; stage < NUM_STAGES; ++stage) {
+        const StageStats& stage_stats{stats[stage]};
+        fmt::print("{:>20}: {:>10} us total, {:>8} us max, {:>8} KiB peak arena\n",
+                   STAGE_NAMES[stage],
+                   std::chrono::duration_cast<std::chrono::microseconds>(stage_stats.total_time)
+                       .count(),
+                   std::chrono::duration_cast<std::chrono::microseconds>(stage_stats.max_time)
+                       .count(),
+                   stage_stats.max_arena_bytes / 1024);
+    }
+}
+
+TEST_CASE("ShaderCompile: Value numbering merges dominated duplicates", "[video_core]") {
+    using namespace Shader;
+    ObjectPool<IR::Inst> inst_pool;
+    ObjectPool<IR::Block> block_pool;
+    // entry -> (left | right) -> merge
+    IR::Block* const entry{block_pool.Create(inst_pool)};
+    IR::Block* const left{block_pool.Create(inst_pool)};
+    IR::Block* const right{block_pool.Create(inst_pool)};
+    IR::Block* const merge{block_pool.Create(inst_pool)};
+    entry->AddBranch(left);
+    entry->AddBranch(right);
+    left->AddBranch(merge);
+    right->AddBranch(merge);
+
+    IR::Program program;
+    program.blocks = {entry, left, right, merge};
+    program.post_order_blocks = {merge, right, left, entry};
+
+    IR::IREmitter entry_ir{*entry};
+    IR::IREmitter left_ir{*left};
+    IR::IREmitter right_ir{*right};
+    IR::IREmitter merge_ir{*merge};
+    const IR::U32 entry_cbuf{entry_ir.GetCbuf(entry_ir.Imm32(0), entry_ir.Imm32(16))};
+    // Dominated by the entry load, so it is replaced
+    const IR::U32 left_cbuf{left_ir.GetCbuf(left_ir.Imm32(0), left_ir.Imm32(16))};
+    const IR::U32 sum{left_ir.IAdd(entry_cbuf, left_cbuf)};
+    left_ir.SetAttribute(IR::Attribute::Generic0X, left_ir.BitCast<IR::F32>(sum), left_ir.Imm32(0));
+    // Loads in sibling blocks do not dominate each other, so both stay
+    const IR::U32 right_cbuf{right_ir.GetCbuf(right_ir.Imm32(0), right_ir.Imm32(32))};
+    right_ir.SetAttribute(IR::Attribute::Generic0Y, right_ir.BitCast<IR::F32>(right_cbuf),
+                          right_ir.Imm32(0));
+    const IR::U32 merge_cbuf{merge_ir.GetCbuf(merge_ir.Imm32(0), merge_ir.Imm32(32))};
+    merge_ir.SetAttribute(IR::Attribute::Generic0Z, merge_ir.BitCast<IR::F32>(merge_cbuf),
+                          merge_ir.Imm32(0));
+
+    REQUIRE(CountOpcode(program, IR::Opcode::GetCbufU32) == 4);
+    RunRedundancyPasses(program);
+    REQUIRE(CountOpcode(program, IR::Opcode::GetCbufU32) == 3);
+    const IR::Inst& add{*std::ranges::find(left->Instructions(), IR::Opcode::IAdd32,
+                                           &IR::Inst::GetOpcode)};
+    REQUIRE(add.Arg(0) == add.Arg(1));
+}
+
+TEST_CASE("ShaderCompile: Loop invariant code motion", "[video_core]") {
+    using namespace Shader;
+    ObjectPool<IR::Inst> inst_pool;
+    ObjectPool<IR::Block> block_pool;
+    // preheader -> header -> (body -> header | exit)
+    IR::Block* const preheader{block_pool.Create(inst_pool)};
+    IR::Block* const header{block_pool.Create(inst_pool)};
+    IR::Block* const body{block_pool.Create(inst_pool)};
+    IR::Block* const exit{block_pool.Create(inst_pool)};
+    preheader->AddBranch(header);
+    header->AddBranch(body);
+    header->AddBranch(exit);
+    body->AddBranch(header);
+
+    IR::Program program;
+    program.blocks = {preheader, header, body, exit};
+    program.post_order_blocks = {exit, body, header, preheader};
+
+    IR::IREmitter ir{*body};
+    const IR::U32 invariant{ir.IAdd(ir.GetCbuf(ir.Imm32(0), ir.Imm32(0)), ir.Imm32(4))};
+    ir.SetAttribute(IR::Attribute::Generic0X, ir.BitCast<IR::F32>(invariant), ir.Imm32(0));
+
+    RunRedundancyPasses(program);
+    REQUIRE(CountOpcode(program, IR::Opcode::GetCbufU32) == 1);
+    REQUIRE(std::ranges::count(preheader->Instructions(), IR::Opcode::IAdd32,
+                               &IR::Inst::GetOpcode) == 1);
+    REQUIRE(std::ranges::count(body->Instructions(), IR::Opcode::SetAttribute,
+                               &IR::Inst::GetOpcode) == 1);
+}
+
+TEST_CASE("ShaderCompile: Redundant instruction elimination on pipeline cache environments",
+          "[.][benchmark]") {
+    std::vector<VideoCommon::FileEnvironment> envs{LoadCacheEnvironments()};
+    if (envs.empty()) {
+        return;
+    }
+    const Shader::Profile profile{
+        .supported_spirv = 0x00010300,
+        .support_int64 = true,
+    };
+    const Shader::HostTranslateInfo host_info{
+        .support_float64 = true,
+        .support_float16 = true,
+        .support_int64 = true,
+        .min_ssbo_alignment = 16,
+    };
+    Shader::ObjectPool<Shader::IR::Inst> inst_pool{8192};
+    Shader::ObjectPool<Shader::IR::Block> block_pool{32};
+    Shader::ObjectPool<Shader::Maxwell::Flow::Block> flow_block_pool{32};
+    const spvtools::SpirvTools spirv_tools{SPV_ENV_VULKAN_1_1};
+
+    // Each environment is compiled twice from scratch, without and with the passes. Both modules
+    // must be valid SPIR-V and the optimized IR has to pass the verification pass, which checks
+    // that every use still refers to a dominating definition with matching use counts.
+    const auto compile{[&](VideoCommon::FileEnvironment& env, bool optimize) {
+        inst_pool.ReleaseContents();
+        block_pool.ReleaseContents();
+        flow_block_pool.ReleaseContents();
+        const bool is_compute{env.ShaderStage() == Shader::Stage::Compute};
+        const u32 cfg_offset{is_compute ? env.StartAddress()
+                                        : static_cast<u32>(env.StartAddress() +
+                                                           sizeof(Shader::ProgramHeader))};
+        Shader::Maxwell::Flow::CFG cfg(env, flow_block_pool, cfg_offset);
+        Shader::IR::Program program{
+            Shader::Maxwell::TranslateProgram(inst_pool, block_pool, env, cfg, host_info)};
+        const Shader::RuntimeInfo runtime_info{};
+        Shader::Maxwell::ConvertLegacyToGeneric(program, runtime_info);
+        if (optimize) {
+            RunRedundancyPasses(program);
+        }
+        Shader::Backend::Bindings bindings;
+        return Shader::Backend::SPIRV::EmitSPIRV(profile, runtime_info, program, bindings, false);
+    }};
+    size_t num_compiled{};
+    size_t instructions_before{};
+    size_t instructions_after{};
+    for (VideoCommon::FileEnvironment& env : envs) {
+        if (env.ShaderStage() == Shader::Stage::VertexA) {
+            continue;
+        }
+        try {
+            const std::vector<u32> reference{compile(env, false)};
+            const std::vector<u32> optimized{compile(env, true)};
+            if (spirv_tools.Validate(reference)) {
+                CHECK(spirv_tools.Validate(optimized));
+            }
+            instructions_before += CountSpirvInstructions(reference);
+            instructions_after += CountSpirvInstructions(optimized);
+            ++num_compiled;
+        } catch (const Shader::Exception&) {
+            continue;
+        }
+    }
+    fmt::print("{} shaders: {} SPIR-V instructions before, {} after ({:.1f}% removed)\n",
+               num_compiled, instructions_before, instructions_after,
+               instructions_before == 0
+                   ? 0.0
+                   : 100.0 * static_cast<double>(instructions_before - instructions_after) /
+                         static_cast<double>(instructions_before));
+}
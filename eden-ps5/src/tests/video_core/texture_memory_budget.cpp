@@ -0,0 +1,114 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "common/literals.h"
+#include "common/lru_cache.h"
+#include "video_core/texture_cache/memory_budget.h"
+
+namespace {
+using namespace Common::Literals;
+using VideoCommon::ImageBudgetClass;
+using VideoCommon::MemoryBudget;
+using VideoCommon::MemoryPressure;
+
+struct LRUItemParams {
+    using ObjectType = u32;
+    using TickType = u64;
+};
+} // Anonymous namespace
+
+TEST_CASE("MemoryBudget: Pressure levels", "[video_core]") {
+    MemoryBudget budget;
+    budget.SetLimits(256_MiB, 1_GiB, 2_GiB);
+    REQUIRE(budget.GetPressure(128_MiB) == MemoryPressure::None);
+    REQUIRE(budget.GetPressure(512_MiB) == MemoryPressure::Low);
+    REQUIRE(budget.GetPressure(1_GiB) == MemoryPressure::High);
+    REQUIRE(budget.GetPressure(3_GiB) == MemoryPressure::Critical);
+
+    // Higher pressure evicts younger images and more of them
+    REQUIRE(MemoryBudget::GetMinimumAge(MemoryPressure::Critical) <
+            MemoryBudget::GetMinimumAge(MemoryPressure::Low));
+    REQUIRE(MemoryBudget::GetMaxEvictions(MemoryPressure::None) == 0);
+    REQUIRE(MemoryBudget::GetMaxEvictions(MemoryPressure::Critical) >
+            MemoryBudget::GetMaxEvictions(MemoryPressure::Low));
+}
+
+TEST_CASE("MemoryBudget: Cheap images are evicted first", "[video_core]") {
+    const u64 sampled = MemoryBudget::GetEvictionPriority(ImageBudgetClass::Sampled, 30);
+    const u64 decoded = MemoryBudget::GetEvictionPriority(ImageBudgetClass::AsyncDecoded, 30);
+    const u64 render_target = MemoryBudget::GetEvictionPriority(ImageBudgetClass::RenderTarget, 30);
+    REQUIRE(sampled > decoded);
+    REQUIRE(decoded > render_target);
+
+    // A render target unused for long enough goes before a recently used texture
+    REQUIRE(MemoryBudget::GetEvictionPriority(ImageBudgetClass::RenderTarget, 400) > sampled);
+}
+
+TEST_CASE("MemoryBudget: Class accounting and stats", "[video_core]") {
+    MemoryBudget budget;
+    budget.SetLimits(0, 1_GiB, 2_GiB);
+    budget.Add(ImageBudgetClass::Sampled, 64_MiB);
+    budget.Add(ImageBudgetClass::RenderTarget, 32_MiB);
+    budget.Remove(ImageBudgetClass::Sampled, 16_MiB);
+    budget.Add(ImageBudgetClass::Rescaled, 16_MiB);
+    REQUIRE(budget.GetClassBytes(ImageBudgetClass::Sampled) == 48_MiB);
+
+    budget.RecordEviction(ImageBudgetClass::Sampled, 8_MiB);
+    budget.Remove(ImageBudgetClass::Sampled, 8_MiB);
+    budget.TickFrame(80_MiB);
+
+    const auto& stats = budget.GetStats();
+    REQUIRE(stats.used_bytes == 80_MiB);
+    REQUIRE(stats.expected_bytes == 1_GiB);
+    REQUIRE(stats.pressure == MemoryPressure::Low);
+    REQUIRE(stats.class_bytes[static_cast<size_t>(ImageBudgetClass::Sampled)] == 40_MiB);
+    REQUIRE(stats.class_bytes[static_cast<size_t>(ImageBudgetClass::RenderTarget)] == 32_MiB);
+    REQUIRE(stats.evictions[static_cast<size_t>(ImageBudgetClass::Sampled)] == 1);
+    REQUIRE(stats.evicted_bytes == 8_MiB);
+
+    // Eviction counters are per frame
+    budget.TickFrame(80_MiB);
+    REQUIRE(budget.GetStats().evicted_bytes == 0);
+}
+
+TEST_CASE("MemoryBudget: Recompression savings", "[video_core]") {
+    MemoryBudget budget;
+    budget.SetLimits(0, 1_GiB, 2_GiB);
+    budget.AddRecompressionSavings(28_MiB);
+    budget.AddRecompressionSavings(12_MiB);
+    budget.RemoveRecompressionSavings(12_MiB);
+    budget.TickFrame(4_MiB);
+    REQUIRE(budget.GetStats().recompression_saved_bytes == 28_MiB);
+
+    // Savings are held by live images, they are not reset every frame
+    budget.TickFrame(4_MiB);
+    REQUIRE(budget.GetStats().recompression_saved_bytes == 28_MiB);
+}
+
+TEST_CASE("LeastRecentlyUsedCache: Visits items with their ticks", "[video_core]") {
+    Common::LeastRecentlyUsedCache<LRUItemParams> lru_cache;
+    lru_cache.Insert(1, 10);
+    const size_t touched = lru_cache.Insert(2, 20);
+    lru_cache.Insert(3, 30);
+    lru_cache.Touch(touched, 40);
+
+    u64 tick_sum = 0;
+    u32 visited = 0;
+    lru_cache.ForEachItemBelow(35, [&](u32, u64 tick) {
+        tick_sum += tick;
+        ++visited;
+    });
+    REQUIRE(visited == 2);
+    REQUIRE(tick_sum == 40);
+
+    // Returning true stops the walk
+    visited = 0;
+    lru_cache.ForEachItemBelow(100, [&](u32) {
+        ++visited;
+        return true;
+    });
+    REQUIRE(visited == 1);
+}
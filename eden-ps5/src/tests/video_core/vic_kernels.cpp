@@ -0,0 +1,278 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "video_core/host1x/vic_kernels.h"
+
+namespace Tegra::Host1x {
+// Found through argument dependent lookup when comparing containers of pixels
+bool operator==(const Pixel& lhs, const Pixel& rhs) {
+    return lhs.r == rhs.r && lhs.g == rhs.g && lhs.b == rhs.b && lhs.a == rhs.a;
+}
+} // namespace Tegra::Host1x
+
+namespace {
+using namespace Tegra::Host1x;
+
+constexpr std::array ISAS{VicIsa::SSE41, VicIsa::AVX2, VicIsa::NEON};
+constexpr std::array<const char*, 4> ISA_NAMES{"Scalar", "SSE4.1", "AVX2", "NEON"};
+
+// Widths around every vector size, plus a full row
+constexpr std::array<u32, 12> WIDTHS{1, 2, 3, 7, 8, 15, 16, 17, 31, 33, 100, 1920};
+
+constexpr u32 FRAME_WIDTH = 1920;
+constexpr u32 FRAME_HEIGHT = 1080;
+
+// BT.601 limited range YUV to RGB, as written by games
+constexpr ColorMatrix BT601_MATRIX{
+    .coeffs{{
+        {76309, 0, 104597, -14609},
+        {76309, -25675, -53279, 8883},
+        {76309, 132201, 0, -18148},
+    }},
+    .shift = 16,
+    .clamp_min = 0,
+    .clamp_max = 1023,
+};
+
+std::vector<u8> RandomBytes(std::mt19937& rng, size_t size) {
+    std::uniform_int_distribution<u32> dist(0, 0xFF);
+    std::vector<u8> bytes(size);
+    for (u8& byte : bytes) {
+        byte = static_cast<u8>(dist(rng));
+    }
+    return bytes;
+}
+
+// Pixels hold 10-bit channels
+std::vector<Pixel> RandomPixels(std::mt19937& rng, size_t size) {
+    std::uniform_int_distribution<u32> dist(0, 1023);
+    std::vector<Pixel> pixels(size);
+    for (Pixel& pixel : pixels) {
+        pixel = {
+            .r = static_cast<u16>(dist(rng)),
+            .g = static_cast<u16>(dist(rng)),
+            .b = static_cast<u16>(dist(rng)),
+            .a = static_cast<u16>(dist(rng)),
+        };
+    }
+    return pixels;
+}
+
+ColorMatrix RandomMatrix(std::mt19937& rng) {
+    std::uniform_int_distribution<s32> coeff(-(1 << 17), 1 << 17);
+    std::uniform_int_distribution<s32> shift(0, 15);
+    std::uniform_int_distribution<s32> clamp(0, 1023);
+    ColorMatrix matrix{};
+    for (auto& row : matrix.coeffs) {
+        for (s32& value : row) {
+            value = coeff(rng);
+        }
+    }
+    matrix.shift = shift(rng);
+    matrix.clamp_min = clamp(rng);
+    matrix.clamp_max = clamp(rng);
+    if (matrix.clamp_min > matrix.clamp_max) {
+        std::swap(matrix.clamp_min, matrix.clamp_max);
+    }
+    return matrix;
+}
+
+// Calls func with the kernels of every instruction set the host supports, besides the scalar ones
+template <typename Func>
+void ForEachVectorIsa(Func&& func) {
+    for (const VicIsa isa : ISAS) {
+        if (const VicKernels* const kernels = GetVicKernels(isa)) {
+            func(*kernels);
+        }
+    }
+}
+} // Anonymous namespace
+
+TEST_CASE("VicKernels: Scalar kernels are always available", "[video_core]") {
+    REQUIRE(GetVicKernels(VicIsa::Scalar) != nullptr);
+    const VicKernels& best = GetBestVicKernels();
+    REQUIRE(best.read_planar != nullptr);
+    REQUIRE(best.write_chroma != nullptr);
+}
+
+TEST_CASE("VicKernels: Scalar reads", "[video_core]") {
+    const VicKernels& scalar = *GetVicKernels(VicIsa::Scalar);
+    const std::array<u8, 4> luma{0x00, 0x40, 0xFF, 0x80};
+    const std::array<u8, 2> chroma_u{0x10, 0x20};
+    const std::array<u8, 2> chroma_v{0x30, 0x40};
+    const std::array<u8, 4> chroma_uv{0x10, 0x30, 0x20, 0x40};
+
+    std::array<Pixel, 4> planar{};
+    std::array<Pixel, 4> semiplanar{};
+    scalar.read_planar(planar.data(), luma.data(), chroma_u.data(), chroma_v.data(), 4, 0x3FF);
+    scalar.read_semiplanar(semiplanar.data(), luma.data(), chroma_uv.data(), 4, 0x3FF);
+
+    REQUIRE(planar[1] == Pixel{0x100, 0x40, 0xC0, 0x3FF});
+    REQUIRE(planar[2] == Pixel{0x3FC, 0x80, 0x100, 0x3FF});
+    REQUIRE(planar == semiplanar);
+}
+
+TEST_CASE("VicKernels: Scalar writes", "[video_core]") {
+    const VicKernels& scalar = *GetVicKernels(VicIsa::Scalar);
+    const std::array<Pixel, 2> pixels{Pixel{0x3FC, 0x100, 0x40, 0x3FF},
+                                      Pixel{0x004, 0x008, 0x00C, 0x010}};
+    std::array<u8, 8> abgr{};
+    std::array<u8, 8> argb{};
+    std::array<u8, 2> luma{};
+    std::array<u8, 2> chroma{};
+    scalar.write_abgr(abgr.data(), pixels.data(), 2);
+    scalar.write_argb(argb.data(), pixels.data(), 2);
+    scalar.write_luma(luma.data(), pixels.data(), 2);
+    scalar.write_chroma(chroma.data(), pixels.data(), 2);
+
+    REQUIRE(abgr == std::array<u8, 8>{0xFF, 0x40, 0x10, 0xFF, 0x01, 0x02, 0x03, 0x04});
+    REQUIRE(argb == std::array<u8, 8>{0x10, 0x40, 0xFF, 0xFF, 0x03, 0x02, 0x01, 0x04});
+    REQUIRE(luma == std::array<u8, 2>{0xFF, 0x01});
+    REQUIRE(chroma == std::array<u8, 2>{0x40, 0x10});
+}
+
+TEST_CASE("VicKernels: Vector reads match scalar", "[video_core]") {
+    const VicKernels& scalar = *GetVicKernels(VicIsa::Scalar);
+    std::mt19937 rng(0x1C);
+    ForEachVectorIsa([&](const VicKernels& kernels) {
+        for (const u32 width : WIDTHS) {
+            const auto luma = RandomBytes(rng, width);
+            const auto chroma_u = RandomBytes(rng, (width + 1) / 2);
+            const auto chroma_v = RandomBytes(rng, (width + 1) / 2);
+            const auto chroma_uv = RandomBytes(rng, (width + 1) & ~1U);
+
+            std::vector<Pixel> expected(width);
+            std::vector<Pixel> result(width);
+            scalar.read_planar(expected.data(), luma.data(), chroma_u.data(), chroma_v.data(),
+                               width, 0x2A5);
+            kernels.read_planar(result.data(), luma.data(), chroma_u.data(), chroma_v.data(),
+                                width, 0x2A5);
+            REQUIRE(result == expected);
+
+            scalar.read_semiplanar(expected.data(), luma.data(), chroma_uv.data(), width, 0x3FF);
+            kernels.read_semiplanar(result.data(), luma.data(), chroma_uv.data(), width, 0x3FF);
+            REQUIRE(result == expected);
+        }
+    });
+}
+
+TEST_CASE("VicKernels: Vector blend matches scalar", "[video_core]") {
+    const VicKernels& scalar = *GetVicKernels(VicIsa::Scalar);
+    std::mt19937 rng(0x2C);
+    ForEachVectorIsa([&](const VicKernels& kernels) {
+        for (const u32 width : WIDTHS) {
+            const auto pixels = RandomPixels(rng, width);
+            for (const ColorMatrix& matrix : {BT601_MATRIX, RandomMatrix(rng), RandomMatrix(rng)}) {
+                std::vector<Pixel> expected(width);
+                std::vector<Pixel> result(width);
+                scalar.blend(expected.data(), pixels.data(), width, matrix);
+                kernels.blend(result.data(), pixels.data(), width, matrix);
+                REQUIRE(result == expected);
+            }
+        }
+    });
+}
+
+TEST_CASE("VicKernels: Vector writes match scalar", "[video_core]") {
+    const VicKernels& scalar = *GetVicKernels(VicIsa::Scalar);
+    std::mt19937 rng(0x3C);
+    ForEachVectorIsa([&](const VicKernels& kernels) {
+        for (const u32 width : WIDTHS) {
+            const auto pixels = RandomPixels(rng, width);
+            std::vector<u8> expected(width * 4);
+            std::vector<u8> result(width * 4);
+
+            scalar.write_abgr(expected.data(), pixels.data(), width);
+            kernels.write_abgr(result.data(), pixels.data(), width);
+            REQUIRE(result == expected);
+
+            scalar.write_argb(expected.data(), pixels.data(), width);
+            kernels.write_argb(result.data(), pixels.data(), width);
+            REQUIRE(result == expected);
+
+            std::ranges::fill(expected, u8{0});
+            std::ranges::fill(result, u8{0});
+            scalar.write_luma(expected.data(), pixels.data(), width);
+            kernels.write_luma(result.data(), pixels.data(), width);
+            REQUIRE(result == expected);
+
+            scalar.write_chroma(expected.data(), pixels.data(), width);
+            kernels.write_chroma(result.data(), pixels.data(), width);
+            REQUIRE(result == expected);
+        }
+    });
+}
+
+TEST_CASE("VicKernels: Row splitter covers every row once", "[video_core]") {
+    for (const size_t num_workers : {size_t{0}, size_t{1}, size_t{3}}) {
+        VicRowSplitter splitter(num_workers);
+        for (const u32 num_rows : {0U, 1U, 63U, 64U, 129U, FRAME_HEIGHT}) {
+            std::vector<std::atomic<u32>> visits(num_rows);
+            std::atomic<bool> odd_begin{};
+            splitter.ForEachRows(num_rows, [&](u32 begin, u32 end) {
+                if (begin % 2 != 0) {
+                    odd_begin = true;
+                }
+                for (u32 row = begin; row < end; row++) {
+                    ++visits[row];
+                }
+            });
+            REQUIRE(!odd_begin);
+            for (const auto& count : visits) {
+                REQUIRE(count == 1);
+            }
+        }
+    }
+}
+
+// Benchmarks are hidden from the default run. Use `tests "[benchmark]"` to run them.
+TEST_CASE("VicKernels: Frame benchmark", "[.][benchmark]") {
+    std::mt19937 rng(0x4C);
+    const auto luma = RandomBytes(rng, FRAME_WIDTH * FRAME_HEIGHT);
+    const auto chroma_u = RandomBytes(rng, FRAME_WIDTH * FRAME_HEIGHT / 4);
+    const auto chroma_v = RandomBytes(rng, FRAME_WIDTH * FRAME_HEIGHT / 4);
+    std::vector<Pixel> slot(FRAME_WIDTH * FRAME_HEIGHT);
+    std::vector<Pixel> output(FRAME_WIDTH * FRAME_HEIGHT);
+    std::vector<u8> abgr(FRAME_WIDTH * FRAME_HEIGHT * 4);
+
+    const auto run_frame = [&](const VicKernels& kernels, VicRowSplitter& splitter) {
+        splitter.ForEachRows(FRAME_HEIGHT, [&](u32 begin, u32 end) {
+            for (u32 y = begin; y < end; y++) {
+                const size_t row = size_t{y} * FRAME_WIDTH;
+                const size_t chroma_row = size_t{y / 2} * (FRAME_WIDTH / 2);
+                kernels.read_planar(&slot[row], &luma[row], &chroma_u[chroma_row],
+                                    &chroma_v[chroma_row], FRAME_WIDTH, 0x3FF);
+                kernels.blend(&output[row], &slot[row], FRAME_WIDTH, BT601_MATRIX);
+                kernels.write_abgr(&abgr[row * 4], &output[row], FRAME_WIDTH);
+            }
+        });
+        return abgr[0];
+    };
+
+    VicRowSplitter inline_splitter(0);
+    VicRowSplitter threaded_splitter(3);
+    for (const VicIsa isa : {VicIsa::Scalar, VicIsa::SSE41, VicIsa::AVX2, VicIsa::NEON}) {
+        const VicKernels* const kernels = GetVicKernels(isa);
+        if (!kernels) {
+            continue;
+        }
+        const std::string name{ISA_NAMES[static_cast<size_t>(isa)]};
+        BENCHMARK(name + " 1080p frame") {
+            return run_frame(*kernels, inline_splitter);
+        };
+        BENCHMARK(name + " 1080p frame, 4 threads") {
+            return run_frame(*kernels, threaded_splitter);
+        };
+    }
+}
@@ -20,6 +20,7 @@ namespace VideoCommon {
 constexpr u64 PAGES_PER_WORD = 64;
 constexpr u64 BYTES_PER_PAGE = Core::DEVICE_PAGESIZE;
 constexpr u64 BYTES_PER_WORD = PAGES_PER_WORD * BYTES_PER_PAGE;
+constexpr u64 WORDS_PER_SUMMARY = 64;
 
 enum class Type {
     CPU,
@@ -48,18 +49,26 @@ struct WordsArray {
 
 template <size_t stack_words = 1>
 struct Words {
+    static constexpr size_t summary_stack_words = Common::DivCeil(stack_words, WORDS_PER_SUMMARY);
+
     explicit Words() = default;
     explicit Words(u64 size_bytes_) : size_bytes{size_bytes_} {
         num_words = Common::DivCeil(size_bytes, BYTES_PER_WORD);
+        num_summary_words = Common::DivCeil(num_words, WORDS_PER_SUMMARY);
         if (IsShort()) {
             cpu.stack.fill(~u64{0});
             gpu.stack.fill(0);
             cached_cpu.stack.fill(0);
             untracked.stack.fill(~u64{0});
             preflushable.stack.fill(0);
+            cpu_summary.stack.fill(0);
+            gpu_summary.stack.fill(0);
+            cached_cpu_summary.stack.fill(0);
+            untracked_summary.stack.fill(0);
+            preflushable_summary.stack.fill(0);
         } else {
             // Share allocation between CPU and GPU pages and set their default values
-            u64* const alloc = new u64[num_words * 5];
+            u64* const alloc = new u64[(num_words + num_summary_words) * 5];
             cpu.heap = alloc;
             gpu.heap = alloc + num_words;
             cached_cpu.heap = alloc + num_words * 2;
@@ -70,6 +79,13 @@ struct Words {
             std::fill_n(cached_cpu.heap, num_words, 0);
             std::fill_n(untracked.heap, num_words, ~u64{0});
             std::fill_n(preflushable.heap, num_words, 0);
+            u64* const summary_alloc = alloc + num_words * 5;
+            cpu_summary.heap = summary_alloc;
+            gpu_summary.heap = summary_alloc + num_summary_words;
+            cached_cpu_summary.heap = summary_alloc + num_summary_words * 2;
+            untracked_summary.heap = summary_alloc + num_summary_words * 3;
+            preflushable_summary.heap = summary_alloc + num_summary_words * 4;
+            std::fill_n(summary_alloc, num_summary_words * 5, 0);
         }
         // Clean up tailing bits
         const u64 last_word_size = size_bytes % BYTES_PER_WORD;
@@ -78,6 +94,14 @@ struct Words {
         const u64 last_word = (~u64{0} << shift) >> shift;
         cpu.Pointer(IsShort())[NumWords() - 1] = last_word;
         untracked.Pointer(IsShort())[NumWords() - 1] = last_word;
+        // Every word starts CPU modified and untracked
+        u64* const cpu_summary_words = cpu_summary.Pointer(IsShort());
+        u64* const untracked_summary_words = untracked_summary.Pointer(IsShort());
+        for (size_t word_index = 0; word_index < num_words; ++word_index) {
+            const u64 bit = u64{1} << (word_index % WORDS_PER_SUMMARY);
+            cpu_summary_words[word_index / WORDS_PER_SUMMARY] |= bit;
+            untracked_summary_words[word_index / WORDS_PER_SUMMARY] |= bit;
+        }
     }
 
     ~Words() {
@@ -93,13 +117,23 @@ struct Words {
         cached_cpu = rhs.cached_cpu;
         untracked = rhs.untracked;
         preflushable = rhs.preflushable;
+        num_summary_words = rhs.num_summary_words;
+        cpu_summary = rhs.cpu_summary;
+        gpu_summary = rhs.gpu_summary;
+        cached_cpu_summary = rhs.cached_cpu_summary;
+        untracked_summary = rhs.untracked_summary;
+        preflushable_summary = rhs.preflushable_summary;
         rhs.cpu.heap = nullptr;
         return *this;
     }
 
     Words(Words&& rhs) noexcept
         : size_bytes{rhs.size_bytes}, num_words{rhs.num_words}, cpu{rhs.cpu}, gpu{rhs.gpu},
-          cached_cpu{rhs.cached_cpu}, untracked{rhs.untracked}, preflushable{rhs.preflushable} {
+          cached_cpu{rhs.cached_cpu}, untracked{rhs.untracked}, preflushable{rhs.preflushable},
+          num_summary_words{rhs.num_summary_words}, cpu_summary{rhs.cpu_summary},
+          gpu_summary{rhs.gpu_summary}, cached_cpu_summary{rhs.cached_cpu_summary},
+          untracked_summary{rhs.untracked_summary},
+          preflushable_summary{rhs.preflushable_summary} {
         rhs.cpu.heap = nullptr;
     }
 
@@ -154,6 +188,38 @@ struct Words {
         }
     }
 
+    /// Returns the summary of a state, with one bit set for each word that has any page set
+    template <Type type>
+    std::span<u64> Summary() noexcept {
+        if constexpr (type == Type::CPU) {
+            return std::span<u64>(cpu_summary.Pointer(IsShort()), num_summary_words);
+        } else if constexpr (type == Type::GPU) {
+            return std::span<u64>(gpu_summary.Pointer(IsShort()), num_summary_words);
+        } else if constexpr (type == Type::CachedCPU) {
+            return std::span<u64>(cached_cpu_summary.Pointer(IsShort()), num_summary_words);
+        } else if constexpr (type == Type::Untracked) {
+            return std::span<u64>(untracked_summary.Pointer(IsShort()), num_summary_words);
+        } else if constexpr (type == Type::Preflushable) {
+            return std::span<u64>(preflushable_summary.Pointer(IsShort()), num_summary_words);
+        }
+    }
+
+    template <Type type>
+    std::span<const u64> Summary() const noexcept {
+        if constexpr (type == Type::CPU) {
+            return std::span<const u64>(cpu_summary.Pointer(IsShort()), num_summary_words);
+        } else if constexpr (type == Type::GPU) {
+            return std::span<const u64>(gpu_summary.Pointer(IsShort()), num_summary_words);
+        } else if constexpr (type == Type::CachedCPU) {
+            return std::span<const u64>(cached_cpu_summary.Pointer(IsShort()), num_summary_words);
+        } else if constexpr (type == Type::Untracked) {
+            return std::span<const u64>(untracked_summary.Pointer(IsShort()), num_summary_words);
+        } else if constexpr (type == Type::Preflushable) {
+            return std::span<const u64>(preflushable_summary.Pointer(IsShort()),
+                                        num_summary_words);
+        }
+    }
+
     u64 size_bytes = 0;
     size_t num_words = 0;
     WordsArray<stack_words> cpu;
@@ -161,6 +227,12 @@ struct Words {
     WordsArray<stack_words> cached_cpu;
     WordsArray<stack_words> untracked;
     WordsArray<stack_words> preflushable;
+    size_t num_summary_words = 0;
+    WordsArray<summary_stack_words> cpu_summary;
+    WordsArray<summary_stack_words> gpu_summary;
+    WordsArray<summary_stack_words> cached_cpu_summary;
+    WordsArray<summary_stack_words> untracked_summary;
+    WordsArray<summary_stack_words> preflushable_summary;
 };
 
 template <class DeviceTracker, size_t stack_words = 1>
@@ -198,20 +270,7 @@ public:
     void IterateWords(size_t offset, size_t size, Func&& func) const {
         using FuncReturn = std::invoke_result_t<Func, std::size_t, u64>;
         static constexpr bool BOOL_BREAK = std::is_same_v<FuncReturn, bool>;
-        const size_t start = static_cast<size_t>(std::max<s64>(static_cast<s64>(offset), 0LL));
-        const size_t end = static_cast<size_t>(std::max<s64>(static_cast<s64>(offset + size), 0LL));
-        if (start >= SizeBytes() || end <= start) {
-            return;
-        }
-        auto [start_word, start_page] = GetWordPage(start);
-        auto [end_word, end_page] = GetWordPage(end + BYTES_PER_PAGE - 1ULL);
-        const size_t num_words = NumWords();
-        start_word = std::min(start_word, num_words);
-        end_word = std::min(end_word, num_words);
-        const size_t diff = end_word - start_word;
-        end_word += (end_page + PAGES_PER_WORD - 1ULL) / PAGES_PER_WORD;
-        end_word = std::min(end_word, num_words);
-        end_page += diff * PAGES_PER_WORD;
+        auto [start_word, end_word, start_page, end_page] = GetWordRange(offset, size);
         constexpr u64 base_mask{~0ULL};
         for (size_t word_index = start_word; word_index < end_word; word_index++) {
             const u64 mask = ExtractBits(base_mask, start_page, end_page);
@@ -227,6 +286,41 @@ public:
         }
     }
 
+    /**
+     * Same as IterateWords, but skips the words that are not marked in a summary.
+     * Clean words are skipped a summary word at a time instead of being loaded one by one.
+     *
+     * @param summary Function returning the summary word for a given summary index
+     */
+    template <typename Summary, typename Func>
+    void IterateMarkedWords(size_t offset, size_t size, Summary&& summary, Func&& func) const {
+        using FuncReturn = std::invoke_result_t<Func, std::size_t, u64>;
+        static constexpr bool BOOL_BREAK = std::is_same_v<FuncReturn, bool>;
+        const auto [start_word, end_word, start_page, end_page] = GetWordRange(offset, size);
+        constexpr u64 base_mask{~0ULL};
+        for (size_t summary_index = start_word / WORDS_PER_SUMMARY;
+             summary_index * WORDS_PER_SUMMARY < end_word; ++summary_index) {
+            const size_t base_word = summary_index * WORDS_PER_SUMMARY;
+            const size_t first_bit = start_word > base_word ? start_word - base_word : 0;
+            u64 marked = summary(summary_index) & ExtractBits(base_mask, first_bit,
+                                                               end_word - base_word);
+            while (marked != 0) {
+                const size_t word_index = base_word + std::countr_zero(marked);
+                marked &= marked - 1;
+                const size_t word_page = (word_index - start_word) * PAGES_PER_WORD;
+                const u64 mask = ExtractBits(base_mask, word_index == start_word ? start_page : 0,
+                                             end_page - word_page);
+                if constexpr (BOOL_BREAK) {
+                    if (func(word_index, mask)) {
+                        return;
+                    }
+                } else {
+                    func(word_index, mask);
+                }
+            }
+        }
+    }
+
     template <typename Func>
     void IteratePages(u64 mask, Func&& func) const {
         size_t offset = 0;
@@ -275,6 +369,13 @@ public:
                     untracked_words[index] &= ~mask;
                 }
             }
+            UpdateSummary<type>(index);
+            if constexpr (type == Type::CPU || type == Type::CachedCPU) {
+                UpdateSummary<Type::Untracked>(index);
+            }
+            if constexpr (type == Type::CPU) {
+                UpdateSummary<Type::CachedCPU>(index);
+            }
         });
     }
 
@@ -301,7 +402,18 @@ public:
             func(cpu_addr + pending_offset * BYTES_PER_PAGE,
                  (pending_pointer - pending_offset) * BYTES_PER_PAGE);
         };
-        IterateWords(offset, size, [&](size_t index, u64 mask) {
+        const std::span<const u64> state_summary = words.template Summary<type>();
+        [[maybe_unused]] const std::span<const u64> untracked_summary =
+            words.template Summary<Type::Untracked>();
+        const auto summary = [&](size_t summary_index) {
+            // Clearing CPU writes also untracks pages, so untracked words have to be visited
+            if constexpr (clear && (type == Type::CPU || type == Type::CachedCPU)) {
+                return state_summary[summary_index] | untracked_summary[summary_index];
+            } else {
+                return state_summary[summary_index];
+            }
+        };
+        IterateMarkedWords(offset, size, summary, [&](size_t index, u64 mask) {
             if constexpr (type == Type::GPU) {
                 mask &= ~untracked_words[index];
             }
@@ -317,6 +429,13 @@ public:
                 if constexpr (type == Type::CPU) {
                     cached_words[index] &= ~word;
                 }
+                UpdateSummary<type>(index);
+                if constexpr (type == Type::CPU || type == Type::CachedCPU) {
+                    UpdateSummary<Type::Untracked>(index);
+                }
+                if constexpr (type == Type::CPU) {
+                    UpdateSummary<Type::CachedCPU>(index);
+                }
             }
             const size_t base_offset = index * PAGES_PER_WORD;
             IteratePages(word, [&](size_t pages_offset, size_t pages_size) {
@@ -355,8 +474,10 @@ public:
         const std::span<const u64> state_words = words.template Span<type>();
         [[maybe_unused]] const std::span<const u64> untracked_words =
             words.template Span<Type::Untracked>();
+        const std::span<const u64> summary = words.template Summary<type>();
         bool result = false;
-        IterateWords(offset, size, [&](size_t index, u64 mask) {
+        const auto get_summary = [&](size_t summary_index) { return summary[summary_index]; };
+        IterateMarkedWords(offset, size, get_summary, [&](size_t index, u64 mask) {
             if constexpr (type == Type::GPU) {
                 mask &= ~untracked_words[index];
             }
@@ -382,9 +503,11 @@ public:
         const std::span<const u64> state_words = words.template Span<type>();
         [[maybe_unused]] const std::span<const u64> untracked_words =
             words.template Span<Type::Untracked>();
+        const std::span<const u64> summary = words.template Summary<type>();
         u64 begin = std::numeric_limits<u64>::max();
         u64 end = 0;
-        IterateWords(offset, size, [&](size_t index, u64 mask) {
+        const auto get_summary = [&](size_t summary_index) { return summary[summary_index]; };
+        IterateMarkedWords(offset, size, get_summary, [&](size_t index, u64 mask) {
             if constexpr (type == Type::GPU) {
                 mask &= ~untracked_words[index];
             }
@@ -418,20 +541,70 @@ public:
     }
 
     void FlushCachedWrites() noexcept {
-        const u64 num_words = NumWords();
         u64* const cached_words = Array<Type::CachedCPU>();
         u64* const untracked_words = Array<Type::Untracked>();
         u64* const cpu_words = Array<Type::CPU>();
-        for (u64 word_index = 0; word_index < num_words; ++word_index) {
-            const u64 cached_bits = cached_words[word_index];
-            NotifyRasterizer<false>(word_index, untracked_words[word_index], cached_bits);
-            untracked_words[word_index] |= cached_bits;
-            cpu_words[word_index] |= cached_bits;
-            cached_words[word_index] = 0;
+        const std::span<u64> cached_summary = words.template Summary<Type::CachedCPU>();
+        const std::span<u64> untracked_summary = words.template Summary<Type::Untracked>();
+        const std::span<u64> cpu_summary = words.template Summary<Type::CPU>();
+        for (size_t summary_index = 0; summary_index < cached_summary.size(); ++summary_index) {
+            // Only words with cached writes have anything to flush
+            u64 marked = cached_summary[summary_index];
+            untracked_summary[summary_index] |= marked;
+            cpu_summary[summary_index] |= marked;
+            cached_summary[summary_index] = 0;
+            while (marked != 0) {
+                const u64 word_index =
+                    summary_index * WORDS_PER_SUMMARY + std::countr_zero(marked);
+                marked &= marked - 1;
+                const u64 cached_bits = cached_words[word_index];
+                NotifyRasterizer<false>(word_index, untracked_words[word_index], cached_bits);
+                untracked_words[word_index] |= cached_bits;
+                cpu_words[word_index] |= cached_bits;
+                cached_words[word_index] = 0;
+            }
         }
     }
 
 private:
+    struct WordRange {
+        size_t start_word;
+        size_t end_word;
+        size_t start_page;
+        size_t end_page;
+    };
+
+    /// Returns the words covered by a byte range, with the page bounds relative to the first word
+    WordRange GetWordRange(size_t offset, size_t size) const {
+        const size_t start = static_cast<size_t>(std::max<s64>(static_cast<s64>(offset), 0LL));
+        const size_t end = static_cast<size_t>(std::max<s64>(static_cast<s64>(offset + size), 0LL));
+        if (start >= SizeBytes() || end <= start) {
+            return WordRange{};
+        }
+        auto [start_word, start_page] = GetWordPage(start);
+        auto [end_word, end_page] = GetWordPage(end + BYTES_PER_PAGE - 1ULL);
+        const size_t num_words = NumWords();
+        start_word = std::min(start_word, num_words);
+        end_word = std::min(end_word, num_words);
+        const size_t diff = end_word - start_word;
+        end_word += (end_page + PAGES_PER_WORD - 1ULL) / PAGES_PER_WORD;
+        end_word = std::min(end_word, num_words);
+        end_page += diff * PAGES_PER_WORD;
+        return WordRange{start_word, end_word, start_page, end_page};
+    }
+
+    /// Updates the summary bit of a word after its state has changed
+    template <Type type>
+    void UpdateSummary(size_t word_index) noexcept {
+        const u64 bit = u64{1} << (word_index % WORDS_PER_SUMMARY);
+        u64& summary = words.template Summary<type>()[word_index / WORDS_PER_SUMMARY];
+        if (words.template Span<type>()[word_index] != 0) {
+            summary |= bit;
+        } else {
+            summary &= ~bit;
+        }
+    }
+
     template <Type type>
     u64* Array() noexcept {
         if constexpr (type == Type::CPU) {
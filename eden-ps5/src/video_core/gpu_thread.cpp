@@ -7,6 +7,7 @@
 #include "common/assert.h"
 #include "common/scope_exit.h"
 #include "common/settings.h"
+#include "common/subsystem_profiler.h"
 #include "common/thread.h"
 #include "core/core.h"
 #include "core/frontend/graphics_context.h"
@@ -39,16 +40,20 @@ static void RunThread(std::stop_token stop_token, Core::System& system,
         if (stop_token.stop_requested()) {
             break;
         }
-        if (auto* submit_list = std::get_if<SubmitListCommand>(&next.data)) {
-            scheduler.Push(submit_list->channel, std::move(submit_list->entries));
-        } else if (std::holds_alternative<GPUTickCommand>(next.data)) {
-            system.GPU().TickWork();
-        } else if (const auto* flush = std::get_if<FlushRegionCommand>(&next.data)) {
-            rasterizer->FlushRegion(flush->addr, flush->size);
-        } else if (const auto* invalidate = std::get_if<InvalidateRegionCommand>(&next.data)) {
-            rasterizer->OnCacheInvalidation(invalidate->addr, invalidate->size);
-        } else {
-            ASSERT(false);
+        {
+            const Common::ScopedSubsystemTimer timer{Common::Subsystem::GpuThread};
+            if (auto* submit_list = std::get_if<SubmitListCommand>(&next.data)) {
+                scheduler.Push(submit_list->channel, std::move(submit_list->entries));
+            } else if (std::holds_alternative<GPUTickCommand>(next.data)) {
+                system.GPU().TickWork();
+            } else if (const auto* flush = std::get_if<FlushRegionCommand>(&next.data)) {
+                rasterizer->FlushRegion(flush->addr, flush->size);
+            } else if (const auto* invalidate =
+                           std::get_if<InvalidateRegionCommand>(&next.data)) {
+                rasterizer->OnCacheInvalidation(invalidate->addr, invalidate->size);
+            } else {
+                ASSERT(false);
+            }
         }
         state.signaled_fence.store(next.fence);
         if (next.block) {
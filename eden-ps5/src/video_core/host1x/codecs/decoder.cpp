@@ -14,32 +14,58 @@ namespace Tegra {
 
 Decoder::Decoder(Host1x::Host1x& host1x_, s32 id_, const Host1x::NvdecCommon::NvdecRegisters& regs_,
                  Host1x::FrameQueue& frame_queue_)
-    : host1x(host1x_), memory_manager{host1x.GMMU()}, regs{regs_}, id{id_}, frame_queue{
-                                                                                frame_queue_} {}
+    : host1x(host1x_), memory_manager{host1x.GMMU()}, regs{regs_}, id{id_},
+      frame_queue{frame_queue_}, decode_worker{1, "NvdecDecoder"} {}
 
-Decoder::~Decoder() = default;
+Decoder::~Decoder() {
+    decode_worker.WaitForRequests();
+}
 
 void Decoder::Decode() {
     if (!initialized) {
         return;
     }
 
+    // Everything read from the registers and guest memory is captured here, as the channel keeps
+    // processing commands while ffmpeg decodes. The frame queue holds back Vic reads of this
+    // decoder until the frame has been pushed, so the syncpoint increments that follow stay
+    // ordered with the frame from the guest point of view.
     const auto packet_data = ComposeFrame();
+    std::vector<u8> packet(packet_data.begin(), packet_data.end());
+    const bool interlaced = IsInterlaced();
+    std::array<u64, 2> luma_offsets{};
+    if (interlaced) {
+        const auto [luma_top, luma_bottom, chroma_top, chroma_bottom] = GetInterlacedOffsets();
+        luma_offsets = {luma_top, luma_bottom};
+    } else {
+        luma_offsets[0] = std::get<0>(GetProgressiveOffsets());
+    }
+
+    frame_queue.BeginDecode(id);
+    decode_worker.QueueWork([this, packet = std::move(packet), hidden = vp9_hidden_frame,
+                             interlaced, luma_offsets]() mutable {
+        DecodePacket(std::move(packet), hidden, interlaced, luma_offsets);
+        frame_queue.EndDecode(id);
+    });
+}
+
+void Decoder::DecodePacket(std::vector<u8>&& packet, bool hidden, bool interlaced,
+                           std::array<u64, 2> luma_offsets) {
     // Send assembled bitstream to decoder.
-    if (!decode_api.SendPacket(packet_data)) {
+    if (!decode_api.SendPacket(packet)) {
         return;
     }
 
     // Only receive/store visible frames.
-    if (vp9_hidden_frame) {
+    if (hidden) {
         return;
     }
 
     // Receive output frames from decoder.
     auto frame = decode_api.ReceiveFrame();
 
-    if (IsInterlaced()) {
-        auto [luma_top, luma_bottom, chroma_top, chroma_bottom] = GetInterlacedOffsets();
+    if (interlaced) {
+        const auto [luma_top, luma_bottom] = luma_offsets;
         auto frame_copy = frame;
 
         if (!frame.get()) {
@@ -56,7 +82,7 @@ void Decoder::Decode() {
             frame_queue.PushPresentOrder(id, luma_bottom, std::move(frame_copy));
         }
     } else {
-        auto [luma_offset, chroma_offset] = GetProgressiveOffsets();
+        const auto luma_offset = luma_offsets[0];
 
         if (!frame.get()) {
             LOG_ERROR(HW_GPU, "Nvdec {} failed to decode progressive frame for luma {:#X}", id,
@@ -3,14 +3,17 @@
 
 #pragma once
 
+#include <array>
 #include <memory>
 #include <mutex>
 #include <optional>
 #include <string_view>
 #include <unordered_map>
 #include <queue>
+#include <vector>
 
 #include "common/common_types.h"
+#include "common/thread_worker.h"
 #include "video_core/host1x/ffmpeg/ffmpeg.h"
 #include "video_core/host1x/nvdec_common.h"
 
@@ -25,7 +28,7 @@ class Decoder {
 public:
     virtual ~Decoder();
 
-    /// Call decoders to construct headers, decode AVFrame with ffmpeg
+    /// Call decoders to construct headers, then queue the AVFrame decode with ffmpeg
     void Decode();
 
     bool UsingDecodeOrder() const {
@@ -59,6 +62,15 @@ protected:
     FFmpeg::DecodeApi decode_api;
     bool initialized{};
     bool vp9_hidden_frame{};
+
+private:
+    /// Sends a composed packet to ffmpeg and hands the decoded frame to the frame queue
+    void DecodePacket(std::vector<u8>&& packet, bool hidden, bool interlaced,
+                      std::array<u64, 2> luma_offsets);
+
+    /// Decodes packets in submission order while the channel moves on to the next command.
+    /// Declared last so it is drained before the rest of the decoder is destroyed.
+    Common::ThreadWorker decode_worker;
 };
 
 } // namespace Tegra
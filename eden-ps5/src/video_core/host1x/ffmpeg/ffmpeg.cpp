@@ -204,6 +204,8 @@ bool HardwareContext::InitializeWithType(AVHWDeviceType type) {
 DecoderContext::DecoderContext(const Decoder& decoder) : m_decoder{decoder} {
 	m_codec_context = avcodec_alloc_context3(m_decoder.GetCodec());
 	av_opt_set(m_codec_context->priv_data, "tune", "zerolatency", 0);
+	// Slice threading decodes every packet as soon as it is sent. Frame threading would hold frames
+	// back until later packets arrive, while the guest waits for each frame before sending the next.
 	m_codec_context->thread_count = 0;
 	m_codec_context->thread_type &= ~FF_THREAD_FRAME;
 }
@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <condition_variable>
+#include <mutex>
 #include <unordered_map>
 #include <unordered_set>
 #include <queue>
@@ -35,13 +37,37 @@ public:
     }
 
     void Close(s32 fd) {
+        {
+            std::scoped_lock l{m_mutex};
+            m_presentation_order.erase(fd);
+            m_decode_order.erase(fd);
+            m_pending_decodes.erase(fd);
+        }
+        m_decode_cv.notify_all();
+    }
+
+    /// Marks a frame of fd as being decoded. Frame lookups wait until it is pushed.
+    void BeginDecode(s32 fd) {
         std::scoped_lock l{m_mutex};
-        m_presentation_order.erase(fd);
-        m_decode_order.erase(fd);
+        ++m_pending_decodes[fd];
+    }
+
+    /// Ends a decode started with BeginDecode, whether or not it pushed a frame.
+    void EndDecode(s32 fd) {
+        {
+            std::scoped_lock l{m_mutex};
+            const auto it = m_pending_decodes.find(fd);
+            if (it == m_pending_decodes.end() || --it->second != 0) {
+                return;
+            }
+            m_pending_decodes.erase(it);
+        }
+        m_decode_cv.notify_all();
     }
 
     s32 VicFindNvdecFdFromOffset(u64 search_offset) {
-        std::scoped_lock l{m_mutex};
+        std::unique_lock l{m_mutex};
+        m_decode_cv.wait(l, [this] { return m_pending_decodes.empty(); });
         // Vic does not know which nvdec is producing frames for it, so search all the fds here for
         // the given offset.
         for (auto& map : m_presentation_order) {
@@ -86,7 +112,8 @@ public:
             return {};
         }
 
-        std::scoped_lock l{m_mutex};
+        std::unique_lock l{m_mutex};
+        m_decode_cv.wait(l, [this, fd] { return !m_pending_decodes.contains(fd); });
         auto present_map = m_presentation_order.find(fd);
         if (present_map != m_presentation_order.end() && present_map->second.size() > 0) {
             return GetPresentOrderLocked(fd);
@@ -126,8 +153,10 @@ private:
     using FramePtr = std::shared_ptr<FFmpeg::Frame>;
 
     std::mutex m_mutex{};
+    std::condition_variable m_decode_cv;
     std::unordered_map<s32, std::deque<std::pair<u64, FramePtr>>> m_presentation_order;
     std::unordered_map<s32, std::unordered_map<u64, FramePtr>> m_decode_order;
+    std::unordered_map<s32, u32> m_pending_decodes;
 };
 
 enum class ChannelType : u32 {
@@ -12,18 +12,12 @@
 #include "common/common_types.h"
 #include "common/scratch_buffer.h"
 #include "video_core/cdma_pusher.h"
+#include "video_core/host1x/vic_kernels.h"
 
 namespace Tegra::Host1x {
 class Host1x;
 class Nvdec;
 
-struct Pixel {
-    u16 r;
-    u16 g;
-    u16 b;
-    u16 a;
-};
-
 // One underscore represents separate pixels.
 // Double underscore represents separate planes.
 // _N represents chroma subsampling, not a separate pixel.
@@ -636,7 +630,8 @@ private:
     VicRegisters regs{};
     FrameQueue& frame_queue;
 
-    const bool has_sse41{false};
+    const VicKernels& kernels;
+    VicRowSplitter row_splitter;
 
     Common::ScratchBuffer<Pixel> output_surface;
     Common::ScratchBuffer<Pixel> slot_surface;
@@ -0,0 +1,492 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <algorithm>
+
+#if defined(ARCHITECTURE_x86_64)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <immintrin.h>
+#endif
+#elif defined(ARCHITECTURE_arm64)
+#include <arm_neon.h>
+#endif
+
+#include "common/alignment.h"
+#include "common/div_ceil.h"
+#include "video_core/host1x/vic_kernels.h"
+
+#if defined(ARCHITECTURE_x86_64)
+#include "common/x64/cpu_detect.h"
+#endif
+
+namespace Tegra::Host1x {
+
+#if defined(ARCHITECTURE_x86_64)
+/// Defined in vic_kernels_avx2.cpp, which is the only file built with AVX2 enabled.
+const VicKernels& GetAVX2VicKernels();
+#endif
+
+namespace {
+void ReadPlanarScalar(Pixel* dst, const u8* luma, const u8* chroma_u, const u8* chroma_v,
+                      u32 width, u16 alpha) {
+    for (u32 x = 0; x < width; x++) {
+        // Chroma samples are duplicated horizontally.
+        dst[x] = {
+            .r = static_cast<u16>(luma[x] << 2),
+            .g = static_cast<u16>(chroma_u[x / 2] << 2),
+            .b = static_cast<u16>(chroma_v[x / 2] << 2),
+            .a = alpha,
+        };
+    }
+}
+
+void ReadSemiplanarScalar(Pixel* dst, const u8* luma, const u8* chroma_uv, u32 width, u16 alpha) {
+    for (u32 x = 0; x < width; x++) {
+        dst[x] = {
+            .r = static_cast<u16>(luma[x] << 2),
+            .g = static_cast<u16>(chroma_uv[(x & ~1U) + 0] << 2),
+            .b = static_cast<u16>(chroma_uv[(x & ~1U) + 1] << 2),
+            .a = alpha,
+        };
+    }
+}
+
+void BlendScalar(Pixel* dst, const Pixel* src, u32 width, const ColorMatrix& matrix) {
+    for (u32 x = 0; x < width; x++) {
+        const s32 r = src[x].r;
+        const s32 g = src[x].g;
+        const s32 b = src[x].b;
+        const s32 a = src[x].a;
+        const auto convert = [&](const std::array<s32, 4>& row) {
+            // The last column ignores the shift, then the S12.8 result is converted to an integer
+            const s32 value = ((r * row[0] + g * row[1] + b * row[2]) >> matrix.shift) + row[3];
+            return static_cast<u16>(std::clamp(value >> 8, matrix.clamp_min, matrix.clamp_max));
+        };
+        dst[x] = {
+            .r = convert(matrix.coeffs[0]),
+            .g = convert(matrix.coeffs[1]),
+            .b = convert(matrix.coeffs[2]),
+            .a = static_cast<u16>(std::clamp(a, matrix.clamp_min, matrix.clamp_max)),
+        };
+    }
+}
+
+template <bool SwapRB>
+void WriteRGBAScalar(u8* dst, const Pixel* src, u32 width) {
+    for (u32 x = 0; x < width; x++) {
+        dst[x * 4 + 0] = static_cast<u8>((SwapRB ? src[x].b : src[x].r) >> 2);
+        dst[x * 4 + 1] = static_cast<u8>(src[x].g >> 2);
+        dst[x * 4 + 2] = static_cast<u8>((SwapRB ? src[x].r : src[x].b) >> 2);
+        dst[x * 4 + 3] = static_cast<u8>(src[x].a >> 2);
+    }
+}
+
+void WriteLumaScalar(u8* dst, const Pixel* src, u32 width) {
+    for (u32 x = 0; x < width; x++) {
+        dst[x] = static_cast<u8>(src[x].r >> 2);
+    }
+}
+
+void WriteChromaScalar(u8* dst, const Pixel* src, u32 width) {
+    for (u32 x = 0; x < width; x += 2) {
+        dst[x + 0] = static_cast<u8>(src[x].g >> 2);
+        dst[x + 1] = static_cast<u8>(src[x].b >> 2);
+    }
+}
+
+constexpr VicKernels SCALAR_KERNELS{
+    .read_planar = ReadPlanarScalar,
+    .read_semiplanar = ReadSemiplanarScalar,
+    .blend = BlendScalar,
+    .write_abgr = WriteRGBAScalar<false>,
+    .write_argb = WriteRGBAScalar<true>,
+    .write_luma = WriteLumaScalar,
+    .write_chroma = WriteChromaScalar,
+};
+
+#if defined(ARCHITECTURE_x86_64)
+template <bool Planar>
+void ReadSSE41(Pixel* dst, const u8* luma, const u8* chroma_u, const u8* chroma_v, u32 width,
+               u16 alpha) {
+    const auto alpha_mask = _mm_slli_epi64(_mm_set1_epi64x(static_cast<s64>(alpha)), 48);
+    const auto shuffle_mask = _mm_set_epi8(13, 15, 14, 12, 9, 11, 10, 8, 5, 7, 6, 4, 1, 3, 2, 0);
+
+    u32 x = 0;
+    for (; x + 16 <= width; x += 16) {
+        // clang-format off
+        // Load 8 bytes * 2 of 8-bit luma samples
+        // luma0 = 00 00 00 00 00 00 00 00 LL LL LL LL LL LL LL LL
+        auto luma0 = _mm_loadl_epi64((const __m128i*)&luma[x + 0]);
+        auto luma1 = _mm_loadl_epi64((const __m128i*)&luma[x + 8]);
+
+        __m128i chroma;
+        if constexpr (Planar) {
+            // If Chroma is planar, we have separate U and V planes, load 8 bytes of each and
+            // interleave them into a single 16 byte reg
+            // chroma = VV UU VV UU VV UU VV UU VV UU VV UU VV UU VV UU
+            const auto chroma_u0 = _mm_loadl_epi64((const __m128i*)&chroma_u[x / 2]);
+            const auto chroma_v0 = _mm_loadl_epi64((const __m128i*)&chroma_v[x / 2]);
+            chroma = _mm_unpacklo_epi8(chroma_u0, chroma_v0);
+        } else {
+            // Chroma is already interleaved in semiplanar format, just load 16 bytes
+            chroma = _mm_loadu_si128((const __m128i*)&chroma_u[x]);
+        }
+
+        // Convert the 8-bit luma into 16-bit luma
+        // luma0 = [00 LL] [00 LL] [00 LL] [00 LL] [00 LL] [00 LL] [00 LL] [00 LL]
+        luma0 = _mm_cvtepu8_epi16(luma0);
+        luma1 = _mm_cvtepu8_epi16(luma1);
+
+        // Treat the chroma bytes as 16-bit channels, so the U and V are moved together. Using
+        // chroma twice duplicates the values horizontally, as chroma is half the width of luma.
+        // chroma00 = [VV4 UU4] [VV4 UU4] [VV3 UU3] [VV3 UU3] [VV2 UU2] [VV2 UU2] [VV1 UU1] [VV1 UU1]
+        const auto chroma00 = _mm_unpacklo_epi16(chroma, chroma);
+        const auto chroma01 = _mm_unpackhi_epi16(chroma, chroma);
+
+        // Interleave the 16-bit luma and chroma.
+        // yuv0 = [VV4 UU4 004 LL4] [VV3 UU3 003 LL3] [VV2 UU2 002 LL2] [VV1 UU1 001 LL1]
+        auto yuv0 = _mm_unpacklo_epi16(luma0, chroma00);
+        auto yuv1 = _mm_unpackhi_epi16(luma0, chroma00);
+        auto yuv2 = _mm_unpacklo_epi16(luma1, chroma01);
+        auto yuv3 = _mm_unpackhi_epi16(luma1, chroma01);
+
+        // Shuffle into the channel order we want, using the zero high byte of the luma as alpha.
+        // yuv0 = [AA4 VV4 UU4 LL4] [AA3 VV3 UU3 LL3] [AA2 VV2 UU2 LL2] [AA1 VV1 UU1 LL1]
+        yuv0 = _mm_shuffle_epi8(yuv0, shuffle_mask);
+        yuv1 = _mm_shuffle_epi8(yuv1, shuffle_mask);
+        yuv2 = _mm_shuffle_epi8(yuv2, shuffle_mask);
+        yuv3 = _mm_shuffle_epi8(yuv3, shuffle_mask);
+
+        // Extend the 8-bit channels to 16 bits, shift them to 10 bits and insert the alpha.
+        // yuv01 = [AA AA] [VV VV] [UU UU] [LL LL] [AA AA] [VV VV] [UU UU] [LL LL]
+        const auto store = [&](u32 offset, __m128i samples) {
+            samples = _mm_slli_epi16(_mm_cvtepu8_epi16(samples), 2);
+            _mm_storeu_si128((__m128i*)&dst[x + offset], _mm_or_si128(samples, alpha_mask));
+        };
+        store(0, yuv0);
+        store(2, _mm_srli_si128(yuv0, 8));
+        store(4, yuv1);
+        store(6, _mm_srli_si128(yuv1, 8));
+        store(8, yuv2);
+        store(10, _mm_srli_si128(yuv2, 8));
+        store(12, yuv3);
+        store(14, _mm_srli_si128(yuv3, 8));
+        // clang-format on
+    }
+    if constexpr (Planar) {
+        ReadPlanarScalar(dst + x, luma + x, chroma_u + x / 2, chroma_v + x / 2, width - x, alpha);
+    } else {
+        ReadSemiplanarScalar(dst + x, luma + x, chroma_u + x, width - x, alpha);
+    }
+}
+
+void ReadSemiplanarSSE41(Pixel* dst, const u8* luma, const u8* chroma_uv, u32 width, u16 alpha) {
+    ReadSSE41<false>(dst, luma, chroma_uv, nullptr, width, alpha);
+}
+
+void BlendSSE41(Pixel* dst, const Pixel* src, u32 width, const ColorMatrix& matrix) {
+    const auto& m = matrix.coeffs;
+    // Fill the columns, e.g
+    // c0 = [00 00 00 00] [r2c0 r2c0 r2c0 r2c0] [r1c0 r1c0 r1c0 r1c0] [r0c0 r0c0 r0c0 r0c0]
+    const auto c0 = _mm_set_epi32(0, m[2][0], m[1][0], m[0][0]);
+    const auto c1 = _mm_set_epi32(0, m[2][1], m[1][1], m[0][1]);
+    const auto c2 = _mm_set_epi32(0, m[2][2], m[1][2], m[0][2]);
+    const auto c3 = _mm_set_epi32(0, m[2][3], m[1][3], m[0][3]);
+
+    // Set the matrix right-shift as a single element.
+    const auto shift = _mm_set_epi32(0, 0, 0, matrix.shift);
+
+    // Set every 16-bit value to the soft clamp values for clamping every 16-bit channel.
+    const auto clamp_min = _mm_set1_epi16(static_cast<s16>(matrix.clamp_min));
+    const auto clamp_max = _mm_set1_epi16(static_cast<s16>(matrix.clamp_max));
+
+    const auto mat_mul = [&](__m128i p) {
+        // Duplicate the 32-bit channels and multiply them with the columns, then add them all
+        // together vertically, such that out[0] = (r * c0[0]) + (g * c1[0]) + (b * c2[0])
+        const auto r = _mm_mullo_epi32(_mm_shuffle_epi32(p, 0x0), c0);
+        const auto g = _mm_mullo_epi32(_mm_shuffle_epi32(p, 0x55), c1);
+        const auto b = _mm_mullo_epi32(_mm_shuffle_epi32(p, 0xAA), c2);
+        auto out = _mm_sra_epi32(_mm_add_epi32(_mm_add_epi32(r, g), b), shift);
+
+        // As per the TRM, the last column ignores r_shift, so it's just added after shifting.
+        // Then shift the result back from S12.8 to integer values.
+        return _mm_srai_epi32(_mm_add_epi32(out, c3), 8);
+    };
+
+    u32 x = 0;
+    for (; x + 2 <= width; x += 2) {
+        // Convert the 16-bit channels into 32-bit, as the matrix values are 32-bit
+        const auto p01 = _mm_loadu_si128((const __m128i*)&src[x]);
+        const auto p0 = _mm_cvtepu16_epi32(p01);
+        const auto p1 = _mm_cvtepu16_epi32(_mm_srli_si128(p01, 8));
+
+        // Pack the pixels back into 16-bit using unsigned saturation, then blend the original
+        // alpha back in, as the matrix multiply only gives us a 3-channel output.
+        auto done = _mm_packus_epi32(mat_mul(p0), mat_mul(p1));
+        done = _mm_blend_epi16(done, p01, 0x88);
+
+        // Clamp the 16-bit channels to the soft-clamp min/max.
+        done = _mm_min_epu16(_mm_max_epu16(done, clamp_min), clamp_max);
+        _mm_storeu_si128((__m128i*)&dst[x], done);
+    }
+    BlendScalar(dst + x, src + x, width - x, matrix);
+}
+
+template <bool SwapRB>
+void WriteRGBASSE41(u8* dst, const Pixel* src, u32 width) {
+    const auto shuffle = _mm_set_epi8(15, 12, 13, 14, 11, 8, 9, 10, 7, 4, 5, 6, 3, 0, 1, 2);
+    u32 x = 0;
+    for (; x + 4 <= width; x += 4) {
+        const auto pixel01 = _mm_srli_epi16(_mm_loadu_si128((const __m128i*)&src[x + 0]), 2);
+        const auto pixel23 = _mm_srli_epi16(_mm_loadu_si128((const __m128i*)&src[x + 2]), 2);
+        auto pixels = _mm_packus_epi16(pixel01, pixel23);
+        if constexpr (SwapRB) {
+            pixels = _mm_shuffle_epi8(pixels, shuffle);
+        }
+        _mm_storeu_si128((__m128i*)&dst[x * 4], pixels);
+    }
+    WriteRGBAScalar<SwapRB>(dst + x * 4, src + x, width - x);
+}
+
+void WriteLumaSSE41(u8* dst, const Pixel* src, u32 width) {
+    const auto luma_mask = _mm_set_epi16(0, 0, 0, -1, 0, 0, 0, -1);
+    u32 x = 0;
+    for (; x + 16 <= width; x += 16) {
+        const auto load = [&](u32 offset) {
+            return _mm_and_si128(_mm_loadu_si128((const __m128i*)&src[x + offset]), luma_mask);
+        };
+        const auto l0123 = _mm_packus_epi32(load(0), load(2));
+        const auto l4567 = _mm_packus_epi32(load(4), load(6));
+        const auto l891011 = _mm_packus_epi32(load(8), load(10));
+        const auto l12131415 = _mm_packus_epi32(load(12), load(14));
+
+        const auto luma_lo = _mm_srli_epi16(_mm_packus_epi32(l0123, l4567), 2);
+        const auto luma_hi = _mm_srli_epi16(_mm_packus_epi32(l891011, l12131415), 2);
+        _mm_storeu_si128((__m128i*)&dst[x], _mm_packus_epi16(luma_lo, luma_hi));
+    }
+    WriteLumaScalar(dst + x, src + x, width - x);
+}
+
+void WriteChromaSSE41(u8* dst, const Pixel* src, u32 width) {
+    u32 x = 0;
+    for (; x + 16 <= width; x += 16) {
+        // Move the chroma of the even pixels to the low 32 bits
+        const auto load = [&](u32 offset) {
+            return _mm_srli_si128(_mm_loadu_si128((const __m128i*)&src[x + offset]), 2);
+        };
+        const auto c0123 = _mm_unpacklo_epi32(load(0), load(2));
+        const auto c4567 = _mm_unpacklo_epi32(load(4), load(6));
+        const auto c891011 = _mm_unpacklo_epi32(load(8), load(10));
+        const auto c12131415 = _mm_unpacklo_epi32(load(12), load(14));
+
+        const auto chroma_lo = _mm_srli_epi16(_mm_unpacklo_epi64(c0123, c4567), 2);
+        const auto chroma_hi = _mm_srli_epi16(_mm_unpacklo_epi64(c891011, c12131415), 2);
+        _mm_storeu_si128((__m128i*)&dst[x], _mm_packus_epi16(chroma_lo, chroma_hi));
+    }
+    WriteChromaScalar(dst + x, src + x, width - x);
+}
+
+constexpr VicKernels SSE41_KERNELS{
+    .read_planar = ReadSSE41<true>,
+    .read_semiplanar = ReadSemiplanarSSE41,
+    .blend = BlendSSE41,
+    .write_abgr = WriteRGBASSE41<false>,
+    .write_argb = WriteRGBASSE41<true>,
+    .write_luma = WriteLumaSSE41,
+    .write_chroma = WriteChromaSSE41,
+};
+#endif
+
+#if defined(ARCHITECTURE_arm64)
+void StoreNEON(Pixel* dst, uint8x8_t luma, uint8x8_t chroma_u, uint8x8_t chroma_v,
+               uint16x8_t alpha) {
+    uint16x8x4_t pixels;
+    pixels.val[0] = vshll_n_u8(luma, 2);
+    pixels.val[1] = vshll_n_u8(chroma_u, 2);
+    pixels.val[2] = vshll_n_u8(chroma_v, 2);
+    pixels.val[3] = alpha;
+    vst4q_u16(reinterpret_cast<u16*>(dst), pixels);
+}
+
+template <bool Planar>
+void ReadNEON(Pixel* dst, const u8* luma, const u8* chroma_u, const u8* chroma_v, u32 width,
+              u16 alpha) {
+    const uint16x8_t alpha_vec = vdupq_n_u16(alpha);
+    u32 x = 0;
+    for (; x + 16 <= width; x += 16) {
+        const uint8x16_t y = vld1q_u8(&luma[x]);
+        uint8x8_t u;
+        uint8x8_t v;
+        if constexpr (Planar) {
+            u = vld1_u8(&chroma_u[x / 2]);
+            v = vld1_u8(&chroma_v[x / 2]);
+        } else {
+            const uint8x8x2_t uv = vld2_u8(&chroma_u[x]);
+            u = uv.val[0];
+            v = uv.val[1];
+        }
+        // Duplicate every chroma sample for the two pixels sharing it
+        StoreNEON(&dst[x + 0], vget_low_u8(y), vzip1_u8(u, u), vzip1_u8(v, v), alpha_vec);
+        StoreNEON(&dst[x + 8], vget_high_u8(y), vzip2_u8(u, u), vzip2_u8(v, v), alpha_vec);
+    }
+    if constexpr (Planar) {
+        ReadPlanarScalar(dst + x, luma + x, chroma_u + x / 2, chroma_v + x / 2, width - x, alpha);
+    } else {
+        ReadSemiplanarScalar(dst + x, luma + x, chroma_u + x, width - x, alpha);
+    }
+}
+
+void ReadSemiplanarNEON(Pixel* dst, const u8* luma, const u8* chroma_uv, u32 width, u16 alpha) {
+    ReadNEON<false>(dst, luma, chroma_uv, nullptr, width, alpha);
+}
+
+void BlendNEON(Pixel* dst, const Pixel* src, u32 width, const ColorMatrix& matrix) {
+    // Shifting left by a negative amount is an arithmetic right shift
+    const int32x4_t shift = vdupq_n_s32(-matrix.shift);
+    const int32x4_t clamp_min = vdupq_n_s32(matrix.clamp_min);
+    const int32x4_t clamp_max = vdupq_n_s32(matrix.clamp_max);
+    const uint16x8_t alpha_min = vdupq_n_u16(static_cast<u16>(matrix.clamp_min));
+    const uint16x8_t alpha_max = vdupq_n_u16(static_cast<u16>(matrix.clamp_max));
+
+    const auto widen = [](uint16x4_t channel) {
+        return vreinterpretq_s32_u32(vmovl_u16(channel));
+    };
+    const auto convert = [&](int32x4_t r, int32x4_t g, int32x4_t b,
+                             const std::array<s32, 4>& row) {
+        int32x4_t value = vmulq_n_s32(r, row[0]);
+        value = vmlaq_n_s32(value, g, row[1]);
+        value = vmlaq_n_s32(value, b, row[2]);
+        value = vaddq_s32(vshlq_s32(value, shift), vdupq_n_s32(row[3]));
+        value = vminq_s32(vmaxq_s32(vshrq_n_s32(value, 8), clamp_min), clamp_max);
+        return vmovn_u32(vreinterpretq_u32_s32(value));
+    };
+
+    u32 x = 0;
+    for (; x + 8 <= width; x += 8) {
+        const uint16x8x4_t in = vld4q_u16(reinterpret_cast<const u16*>(&src[x]));
+        const int32x4_t r_lo = widen(vget_low_u16(in.val[0]));
+        const int32x4_t g_lo = widen(vget_low_u16(in.val[1]));
+        const int32x4_t b_lo = widen(vget_low_u16(in.val[2]));
+        const int32x4_t r_hi = widen(vget_high_u16(in.val[0]));
+        const int32x4_t g_hi = widen(vget_high_u16(in.val[1]));
+        const int32x4_t b_hi = widen(vget_high_u16(in.val[2]));
+
+        uint16x8x4_t out;
+        for (size_t channel = 0; channel < 3; channel++) {
+            const auto& row = matrix.coeffs[channel];
+            out.val[channel] =
+                vcombine_u16(convert(r_lo, g_lo, b_lo, row), convert(r_hi, g_hi, b_hi, row));
+        }
+        out.val[3] = vminq_u16(vmaxq_u16(in.val[3], alpha_min), alpha_max);
+        vst4q_u16(reinterpret_cast<u16*>(&dst[x]), out);
+    }
+    BlendScalar(dst + x, src + x, width - x, matrix);
+}
+
+template <bool SwapRB>
+void WriteRGBANEON(u8* dst, const Pixel* src, u32 width) {
+    u32 x = 0;
+    for (; x + 8 <= width; x += 8) {
+        const uint16x8x4_t in = vld4q_u16(reinterpret_cast<const u16*>(&src[x]));
+        uint8x8x4_t out;
+        out.val[0] = vshrn_n_u16(SwapRB ? in.val[2] : in.val[0], 2);
+        out.val[1] = vshrn_n_u16(in.val[1], 2);
+        out.val[2] = vshrn_n_u16(SwapRB ? in.val[0] : in.val[2], 2);
+        out.val[3] = vshrn_n_u16(in.val[3], 2);
+        vst4_u8(&dst[x * 4], out);
+    }
+    WriteRGBAScalar<SwapRB>(dst + x * 4, src + x, width - x);
+}
+
+void WriteLumaNEON(u8* dst, const Pixel* src, u32 width) {
+    u32 x = 0;
+    for (; x + 8 <= width; x += 8) {
+        const uint16x8x4_t in = vld4q_u16(reinterpret_cast<const u16*>(&src[x]));
+        vst1_u8(&dst[x], vshrn_n_u16(in.val[0], 2));
+    }
+    WriteLumaScalar(dst + x, src + x, width - x);
+}
+
+void WriteChromaNEON(u8* dst, const Pixel* src, u32 width) {
+    u32 x = 0;
+    for (; x + 16 <= width; x += 16) {
+        const uint16x8x4_t in0 = vld4q_u16(reinterpret_cast<const u16*>(&src[x + 0]));
+        const uint16x8x4_t in1 = vld4q_u16(reinterpret_cast<const u16*>(&src[x + 8]));
+        // Keep the chroma of the even pixels
+        uint8x8x2_t out;
+        out.val[0] = vshrn_n_u16(vuzp1q_u16(in0.val[1], in1.val[1]), 2);
+        out.val[1] = vshrn_n_u16(vuzp1q_u16(in0.val[2], in1.val[2]), 2);
+        vst2_u8(&dst[x], out);
+    }
+    WriteChromaScalar(dst + x, src + x, width - x);
+}
+
+constexpr VicKernels NEON_KERNELS{
+    .read_planar = ReadNEON<true>,
+    .read_semiplanar = ReadSemiplanarNEON,
+    .blend = BlendNEON,
+    .write_abgr = WriteRGBANEON<false>,
+    .write_argb = WriteRGBANEON<true>,
+    .write_luma = WriteLumaNEON,
+    .write_chroma = WriteChromaNEON,
+};
+#endif
+} // Anonymous namespace
+
+const VicKernels* GetVicKernels(VicIsa isa) {
+    switch (isa) {
+    case VicIsa::Scalar:
+        return &SCALAR_KERNELS;
+#if defined(ARCHITECTURE_x86_64)
+    case VicIsa::SSE41:
+        return Common::GetCPUCaps().sse4_1 ? &SSE41_KERNELS : nullptr;
+    case VicIsa::AVX2:
+        return Common::GetCPUCaps().avx2 ? &GetAVX2VicKernels() : nullptr;
+#endif
+#if defined(ARCHITECTURE_arm64)
+    case VicIsa::NEON:
+        return &NEON_KERNELS;
+#endif
+    default:
+        return nullptr;
+    }
+}
+
+const VicKernels& GetBestVicKernels() {
+    for (const VicIsa isa : {VicIsa::AVX2, VicIsa::SSE41, VicIsa::NEON}) {
+        if (const VicKernels* const kernels = GetVicKernels(isa)) {
+            return *kernels;
+        }
+    }
+    return SCALAR_KERNELS;
+}
+
+VicRowSplitter::VicRowSplitter(size_t num_workers_) : num_workers{num_workers_} {
+    if (num_workers > 0) {
+        workers = std::make_unique<Common::ThreadWorker>(num_workers, "VicWorker");
+    }
+}
+
+VicRowSplitter::~VicRowSplitter() = default;
+
+void VicRowSplitter::ForEachRows(u32 num_rows, const std::function<void(u32, u32)>& func) {
+    // Small surfaces are not worth the handoff to the workers
+    static constexpr u32 MIN_ROWS_PER_RANGE = 64;
+    const u32 num_ranges =
+        std::min(static_cast<u32>(num_workers + 1), num_rows / MIN_ROWS_PER_RANGE);
+    if (!workers || num_ranges <= 1) {
+        func(0, num_rows);
+        return;
+    }
+    const u32 rows_per_range = Common::AlignUp(Common::DivCeil(num_rows, num_ranges), 2);
+    for (u32 begin = rows_per_range; begin < num_rows; begin += rows_per_range) {
+        const u32 end = std::min(begin + rows_per_range, num_rows);
+        workers->QueueWork([&func, begin, end] { func(begin, end); });
+    }
+    func(0, std::min(rows_per_range, num_rows));
+    workers->WaitForRequests();
+}
+
+} // namespace Tegra::Host1x
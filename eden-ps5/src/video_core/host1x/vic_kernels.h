@@ -0,0 +1,80 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <array>
+#include <functional>
+#include <memory>
+
+#include "common/common_types.h"
+#include "common/thread_worker.h"
+
+namespace Tegra::Host1x {
+
+struct Pixel {
+    u16 r;
+    u16 g;
+    u16 b;
+    u16 a;
+};
+
+/// Colour conversion done when blending a slot, in the fixed point format of the VIC registers.
+struct ColorMatrix {
+    std::array<std::array<s32, 4>, 3> coeffs; ///< Rows of the 3x4 matrix, S12.8
+    s32 shift;                                ///< Right shift applied before the last column
+    s32 clamp_min;                            ///< Soft clamp applied to every channel
+    s32 clamp_max;
+};
+
+/// Row kernels of the VIC stages. Each call processes a single row of width pixels.
+/// Pixels hold 10-bit channels; every implementation produces the same output for them.
+struct VicKernels {
+    /// Converts 8-bit luma and separate U and V planes into pixels.
+    void (*read_planar)(Pixel* dst, const u8* luma, const u8* chroma_u, const u8* chroma_v,
+                        u32 width, u16 alpha);
+    /// Converts 8-bit luma and an interleaved UV plane into pixels.
+    void (*read_semiplanar)(Pixel* dst, const u8* luma, const u8* chroma_uv, u32 width,
+                            u16 alpha);
+    /// Applies the colour conversion matrix and soft clamp.
+    void (*blend)(Pixel* dst, const Pixel* src, u32 width, const ColorMatrix& matrix);
+    /// Writes 8-bit RGBA pixels.
+    void (*write_abgr)(u8* dst, const Pixel* src, u32 width);
+    /// Writes 8-bit BGRA pixels.
+    void (*write_argb)(u8* dst, const Pixel* src, u32 width);
+    /// Writes the luma channel as 8-bit samples.
+    void (*write_luma)(u8* dst, const Pixel* src, u32 width);
+    /// Writes the chroma of the even pixels as interleaved 8-bit UV samples.
+    void (*write_chroma)(u8* dst, const Pixel* src, u32 width);
+};
+
+enum class VicIsa : u32 {
+    Scalar,
+    SSE41,
+    AVX2,
+    NEON,
+};
+
+/// Returns the kernels of an instruction set, or nullptr when the host can not run them.
+[[nodiscard]] const VicKernels* GetVicKernels(VicIsa isa);
+
+/// Returns the fastest kernels the host can run.
+[[nodiscard]] const VicKernels& GetBestVicKernels();
+
+/// Splits the rows of a surface between a pool of workers and the calling thread.
+class VicRowSplitter {
+public:
+    /// Creates a splitter with num_workers threads besides the caller. Zero runs every row inline.
+    explicit VicRowSplitter(size_t num_workers);
+    ~VicRowSplitter();
+
+    /// Calls func(begin, end) over disjoint ranges covering [0, num_rows) and waits for them.
+    /// Range boundaries are even, so pairs of rows are never split.
+    void ForEachRows(u32 num_rows, const std::function<void(u32, u32)>& func);
+
+private:
+    size_t num_workers;
+    std::unique_ptr<Common::ThreadWorker> workers;
+};
+
+} // namespace Tegra::Host1x
@@ -0,0 +1,184 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <immintrin.h>
+#endif
+
+#include "video_core/host1x/vic_kernels.h"
+
+namespace Tegra::Host1x {
+namespace {
+// The scalar kernels handle the row tails
+const VicKernels& Scalar() {
+    return *GetVicKernels(VicIsa::Scalar);
+}
+
+template <bool Planar>
+void ReadAVX2(Pixel* dst, const u8* luma, const u8* chroma_u, const u8* chroma_v, u32 width,
+              u16 alpha) {
+    const auto alpha_mask = _mm256_set1_epi64x(static_cast<s64>(alpha) << 48);
+    // Moves [LL 00 UU VV] into [LL UU VV 00], leaving the zero byte as the alpha slot
+    const auto shuffle_mask =
+        _mm256_setr_epi8(0, 2, 3, 1, 4, 6, 7, 5, 8, 10, 11, 9, 12, 14, 15, 13, 0, 2, 3, 1, 4, 6, 7,
+                         5, 8, 10, 11, 9, 12, 14, 15, 13);
+    u32 x = 0;
+    for (; x + 16 <= width; x += 16) {
+        // Widen 16 luma samples to 16 bits
+        const auto y = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*)&luma[x]));
+
+        __m128i uv;
+        if constexpr (Planar) {
+            const auto u = _mm_loadl_epi64((const __m128i*)&chroma_u[x / 2]);
+            const auto v = _mm_loadl_epi64((const __m128i*)&chroma_v[x / 2]);
+            uv = _mm_unpacklo_epi8(u, v);
+        } else {
+            uv = _mm_loadu_si128((const __m128i*)&chroma_u[x]);
+        }
+        // Duplicate every UV pair for the two pixels sharing it
+        const auto uv32 = _mm256_cvtepu16_epi32(uv);
+        const auto chroma = _mm256_or_si256(uv32, _mm256_slli_epi32(uv32, 16));
+
+        // lo holds pixels 0-3 and 8-11, hi holds pixels 4-7 and 12-15
+        const auto lo = _mm256_shuffle_epi8(_mm256_unpacklo_epi16(y, chroma), shuffle_mask);
+        const auto hi = _mm256_shuffle_epi8(_mm256_unpackhi_epi16(y, chroma), shuffle_mask);
+
+        const auto store = [&](u32 offset, __m128i samples) {
+            const auto pixels = _mm256_slli_epi16(_mm256_cvtepu8_epi16(samples), 2);
+            _mm256_storeu_si256((__m256i*)&dst[x + offset], _mm256_or_si256(pixels, alpha_mask));
+        };
+        store(0, _mm256_castsi256_si128(lo));
+        store(4, _mm256_castsi256_si128(hi));
+        store(8, _mm256_extracti128_si256(lo, 1));
+        store(12, _mm256_extracti128_si256(hi, 1));
+    }
+    if constexpr (Planar) {
+        Scalar().read_planar(dst + x, luma + x, chroma_u + x / 2, chroma_v + x / 2, width - x,
+                             alpha);
+    } else {
+        Scalar().read_semiplanar(dst + x, luma + x, chroma_u + x, width - x, alpha);
+    }
+}
+
+void ReadSemiplanarAVX2(Pixel* dst, const u8* luma, const u8* chroma_uv, u32 width, u16 alpha) {
+    ReadAVX2<false>(dst, luma, chroma_uv, nullptr, width, alpha);
+}
+
+void BlendAVX2(Pixel* dst, const Pixel* src, u32 width, const ColorMatrix& matrix) {
+    const auto& m = matrix.coeffs;
+    // Every 128-bit lane holds one pixel, so the columns are repeated in both lanes
+    const auto column = [&](size_t index) {
+        return _mm256_setr_epi32(m[0][index], m[1][index], m[2][index], 0, m[0][index],
+                                 m[1][index], m[2][index], 0);
+    };
+    const auto c0 = column(0);
+    const auto c1 = column(1);
+    const auto c2 = column(2);
+    const auto c3 = column(3);
+    const auto shift = _mm_cvtsi32_si128(matrix.shift);
+    const auto clamp_min = _mm256_set1_epi16(static_cast<s16>(matrix.clamp_min));
+    const auto clamp_max = _mm256_set1_epi16(static_cast<s16>(matrix.clamp_max));
+
+    const auto mat_mul = [&](__m256i p) {
+        const auto r = _mm256_mullo_epi32(_mm256_shuffle_epi32(p, 0x00), c0);
+        const auto g = _mm256_mullo_epi32(_mm256_shuffle_epi32(p, 0x55), c1);
+        const auto b = _mm256_mullo_epi32(_mm256_shuffle_epi32(p, 0xAA), c2);
+        const auto out = _mm256_sra_epi32(_mm256_add_epi32(_mm256_add_epi32(r, g), b), shift);
+        return _mm256_srai_epi32(_mm256_add_epi32(out, c3), 8);
+    };
+
+    u32 x = 0;
+    for (; x + 4 <= width; x += 4) {
+        const auto pixels = _mm256_loadu_si256((const __m256i*)&src[x]);
+        // Every lane holds one pixel: p01 holds pixels 0 and 1, p23 holds pixels 2 and 3
+        const auto p01 = _mm256_cvtepu16_epi32(_mm256_castsi256_si128(pixels));
+        const auto p23 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(pixels, 1));
+
+        // Packing works per lane, giving pixels 0 2 1 3, which the permute puts back in order
+        auto done = _mm256_packus_epi32(mat_mul(p01), mat_mul(p23));
+        done = _mm256_permute4x64_epi64(done, 0xD8);
+        done = _mm256_blend_epi16(done, pixels, 0x88);
+        done = _mm256_min_epu16(_mm256_max_epu16(done, clamp_min), clamp_max);
+        _mm256_storeu_si256((__m256i*)&dst[x], done);
+    }
+    Scalar().blend(dst + x, src + x, width - x, matrix);
+}
+
+template <bool SwapRB>
+void WriteRGBAAVX2(u8* dst, const Pixel* src, u32 width) {
+    const auto shuffle = _mm256_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15, 2,
+                                          1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+    u32 x = 0;
+    for (; x + 8 <= width; x += 8) {
+        const auto p0123 = _mm256_srli_epi16(_mm256_loadu_si256((const __m256i*)&src[x + 0]), 2);
+        const auto p4567 = _mm256_srli_epi16(_mm256_loadu_si256((const __m256i*)&src[x + 4]), 2);
+        auto pixels = _mm256_permute4x64_epi64(_mm256_packus_epi16(p0123, p4567), 0xD8);
+        if constexpr (SwapRB) {
+            pixels = _mm256_shuffle_epi8(pixels, shuffle);
+        }
+        _mm256_storeu_si256((__m256i*)&dst[x * 4], pixels);
+    }
+    if constexpr (SwapRB) {
+        Scalar().write_argb(dst + x * 4, src + x, width - x);
+    } else {
+        Scalar().write_abgr(dst + x * 4, src + x, width - x);
+    }
+}
+
+void WriteLumaAVX2(u8* dst, const Pixel* src, u32 width) {
+    const auto luma_mask = _mm256_set1_epi64x(0xFFFF);
+    const auto order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+    u32 x = 0;
+    for (; x + 16 <= width; x += 16) {
+        const auto load = [&](u32 offset) {
+            return _mm256_and_si256(_mm256_loadu_si256((const __m256i*)&src[x + offset]),
+                                    luma_mask);
+        };
+        // Both packs interleave the lanes, the permute restores the pixel order
+        const auto l0 = _mm256_packus_epi32(load(0), load(4));
+        const auto l1 = _mm256_packus_epi32(load(8), load(12));
+        auto samples = _mm256_permutevar8x32_epi32(_mm256_packus_epi32(l0, l1), order);
+        samples = _mm256_srli_epi16(samples, 2);
+        const auto packed = _mm_packus_epi16(_mm256_castsi256_si128(samples),
+                                             _mm256_extracti128_si256(samples, 1));
+        _mm_storeu_si128((__m128i*)&dst[x], packed);
+    }
+    Scalar().write_luma(dst + x, src + x, width - x);
+}
+
+void WriteChromaAVX2(u8* dst, const Pixel* src, u32 width) {
+    const auto order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+    u32 x = 0;
+    for (; x + 16 <= width; x += 16) {
+        // Move the chroma of the even pixels to the low 32 bits of each lane
+        const auto load = [&](u32 offset) {
+            return _mm256_srli_si256(_mm256_loadu_si256((const __m256i*)&src[x + offset]), 2);
+        };
+        const auto c0 = _mm256_unpacklo_epi32(load(0), load(4));
+        const auto c1 = _mm256_unpacklo_epi32(load(8), load(12));
+        auto samples = _mm256_permutevar8x32_epi32(_mm256_unpacklo_epi64(c0, c1), order);
+        samples = _mm256_srli_epi16(samples, 2);
+        const auto packed = _mm_packus_epi16(_mm256_castsi256_si128(samples),
+                                             _mm256_extracti128_si256(samples, 1));
+        _mm_storeu_si128((__m128i*)&dst[x], packed);
+    }
+    Scalar().write_chroma(dst + x, src + x, width - x);
+}
+} // Anonymous namespace
+
+const VicKernels& GetAVX2VicKernels() {
+    static constexpr VicKernels kernels{
+        .read_planar = ReadAVX2<true>,
+        .read_semiplanar = ReadSemiplanarAVX2,
+        .blend = BlendAVX2,
+        .write_abgr = WriteRGBAAVX2<false>,
+        .write_argb = WriteRGBAAVX2<true>,
+        .write_luma = WriteLumaAVX2,
+        .write_chroma = WriteChromaAVX2,
+    };
+    return kernels;
+}
+
+} // namespace Tegra::Host1x
@@ -381,6 +381,16 @@ void QueryCacheBase<Traits>::NotifySegment(bool resume) {
     }
 }
 
+template <typename Traits>
+void QueryCacheBase<Traits>::TickFrame() {
+    sync_stats = SyncStats{
+        .host_stalls = frame_host_stalls.exchange(0, std::memory_order_relaxed),
+        .gpu_resolved = frame_gpu_resolved.exchange(0, std::memory_order_relaxed),
+    };
+    LOG_TRACE(HW_GPU, "Query reads: {} host stalls, {} resolved on the GPU",
+              sync_stats.host_stalls, sync_stats.gpu_resolved);
+}
+
 template <typename Traits>
 bool QueryCacheBase<Traits>::AccelerateHostConditionalRendering() {
     bool qc_dirty = false;
@@ -429,6 +439,21 @@ bool QueryCacheBase<Traits>::AccelerateHostConditionalRendering() {
     }
     const ComparisonMode mode = static_cast<ComparisonMode>(regs.render_enable.mode);
     const GPUVAddr address = regs.render_enable.Address();
+    // Pending host queries are resolved into guest memory on the GPU, so the comparison can be
+    // done there instead of waiting for their results.
+    const auto resolve_pending = [this](const VideoCommon::LookupData& object_1,
+                                        const VideoCommon::LookupData& object_2) {
+        const auto is_pending = [](const QueryBase* query) {
+            return query && True(query->flags & QueryFlagBits::IsHostManaged) &&
+                   False(query->flags & QueryFlagBits::IsHostSynced);
+        };
+        if (!Settings::IsGPULevelHigh() ||
+            (!is_pending(object_1.found_query) && !is_pending(object_2.found_query))) {
+            return;
+        }
+        impl->runtime.PauseHostConditionalRendering();
+        NotifyWFI();
+    };
     switch (mode) {
     case ComparisonMode::True:
         impl->runtime.EndHostConditionalRendering();
@@ -443,12 +468,14 @@ bool QueryCacheBase<Traits>::AccelerateHostConditionalRendering() {
     case ComparisonMode::IfEqual: {
         VideoCommon::LookupData object_1{gen_lookup(address)};
         VideoCommon::LookupData object_2{gen_lookup(address + 16)};
+        resolve_pending(object_1, object_2);
         return impl->runtime.HostConditionalRenderingCompareValues(object_1, object_2, qc_dirty,
                                                                    true);
     }
     case ComparisonMode::IfNotEqual: {
         VideoCommon::LookupData object_1{gen_lookup(address)};
         VideoCommon::LookupData object_2{gen_lookup(address + 16)};
+        resolve_pending(object_1, object_2);
         return impl->runtime.HostConditionalRenderingCompareValues(object_1, object_2, qc_dirty,
                                                                    false);
     }
@@ -574,6 +601,13 @@ bool QueryCacheBase<Traits>::SemiFlushQueryDirty(QueryCacheBase<Traits>::QueryLo
         std::memcpy(ptr, &value_l, sizeof(value_l));
         return false;
     }
+    if (True(query_base->flags & QueryFlagBits::IsHostManaged) &&
+        True(query_base->flags & QueryFlagBits::IsHostSynced)) {
+        // The result was resolved into guest memory on the GPU and is tracked by the buffer cache,
+        // which downloads it without waiting on the query.
+        ++frame_gpu_resolved;
+        return false;
+    }
     return True(query_base->flags & QueryFlagBits::IsHostManaged) &&
            False(query_base->flags & QueryFlagBits::IsGuestSynced);
 }
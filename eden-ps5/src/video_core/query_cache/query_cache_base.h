@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <functional>
 #include <mutex>
 #include <optional>
@@ -48,6 +49,11 @@ public:
         }
     };
 
+    struct SyncStats {
+        u64 host_stalls{};  ///< Guest CPU reads that waited on the host for query results
+        u64 gpu_resolved{}; ///< Guest CPU reads of results already resolved on the GPU
+    };
+
     explicit QueryCacheBase(Tegra::GPU& gpu, VideoCore::RasterizerInterface& rasterizer_,
                             Tegra::MaxwellDeviceMemoryManager& device_memory_,
                             RuntimeType& runtime_);
@@ -66,6 +72,7 @@ public:
             return result;
         });
         if (result) {
+            ++frame_host_stalls;
             RequestGuestHostSync();
         }
     }
@@ -114,6 +121,13 @@ public:
 
     void BindToChannel(s32 id) override;
 
+    void TickFrame();
+
+    /// Returns the synchronization counters of the last frame.
+    [[nodiscard]] const SyncStats& GetSyncStats() const noexcept {
+        return sync_stats;
+    }
+
 protected:
     template <bool remove_from_cache, typename Func>
     void IterateCache(VAddr addr, std::size_t size, Func&& func) {
@@ -173,6 +187,10 @@ protected:
     friend RuntimeType;
 
     std::unique_ptr<QueryCacheBaseImpl> impl;
+
+    std::atomic<u64> frame_host_stalls{};
+    std::atomic<u64> frame_gpu_resolved{};
+    SyncStats sync_stats;
 };
 
 } // namespace VideoCommon
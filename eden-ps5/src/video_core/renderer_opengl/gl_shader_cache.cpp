@@ -17,6 +17,7 @@
 #include "common/fs/path_util.h"
 #include "common/logging/log.h"
 #include "common/settings.h"
+#include "common/subsystem_profiler.h"
 #include "common/thread_worker.h"
 #include "shader_recompiler/backend/glasm/emit_glasm.h"
 #include "shader_recompiler/backend/glsl/emit_glsl.h"
@@ -227,6 +228,7 @@ ShaderCache::ShaderCache(Tegra::MaxwellDeviceMemoryManager& device_memory_,
           .need_declared_frag_colors = true,
           .need_fastmath_off = device.NeedsFastmathOff(),
           .need_gather_subpixel_offset = device.IsAmd() || device.IsIntel(),
+          .optimize_redundant_instructions = Settings::values.optimize_shader_ir.GetValue(),
 
           .has_broken_spirv_clamp = true,
           .has_broken_unsigned_image_offsets = true,
@@ -458,6 +460,8 @@ std::unique_ptr<GraphicsPipeline> ShaderCache::CreateGraphicsPipeline(
     ShaderContext::ShaderPools& pools, const GraphicsPipelineKey& key,
     std::span<Shader::Environment* const> envs, bool use_shader_workers,
     bool force_context_flush) try {
+    const Shader::ArenaScope arena_scope{pools.arena};
+    const Common::ScopedSubsystemTimer timer{Common::Subsystem::ShaderCompile};
     auto hash = key.Hash();
     LOG_INFO(Render_OpenGL, "0x{:016x}", hash);
     size_t env_index{};
@@ -581,6 +585,8 @@ std::unique_ptr<ComputePipeline> ShaderCache::CreateComputePipeline(
 std::unique_ptr<ComputePipeline> ShaderCache::CreateComputePipeline(
     ShaderContext::ShaderPools& pools, const ComputePipelineKey& key, Shader::Environment& env,
     bool force_context_flush) try {
+    const Shader::ArenaScope arena_scope{pools.arena};
+    const Common::ScopedSubsystemTimer timer{Common::Subsystem::ShaderCompile};
     auto hash = key.Hash();
     LOG_INFO(Render_OpenGL, "0x{:016x}", hash);
 
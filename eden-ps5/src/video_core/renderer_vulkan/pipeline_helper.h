@@ -4,6 +4,7 @@
 #pragma once
 
 #include <cstddef>
+#include <span>
 
 #include <boost/container/small_vector.hpp>
 
@@ -28,13 +29,29 @@ public:
                num_descriptors <= device->MaxPushDescriptors();
     }
 
+    /// Texel buffer descriptors are written through buffer views, which descriptor buffers can't
+    /// consume, so only graphics layouts without them are placed in descriptor buffers.
+    bool CanUseDescriptorBuffer() const noexcept {
+        if (!device->IsExtDescriptorBufferSupported() || is_compute || has_texel_buffers) {
+            return false;
+        }
+        return !has_texture_arrays ||
+               device->GetDescriptorBufferProperties().combinedImageSamplerDescriptorSingleArray;
+    }
+
     // TODO(crueter): utilize layout binding flags
-    vk::DescriptorSetLayout CreateDescriptorSetLayout(bool use_push_descriptor) const {
+    vk::DescriptorSetLayout CreateDescriptorSetLayout(bool use_push_descriptor,
+                                                      bool use_descriptor_buffer = false) const {
         if (bindings.empty()) {
             return nullptr;
         }
-        const VkDescriptorSetLayoutCreateFlags flags =
-            use_push_descriptor ? VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR : 0;
+        VkDescriptorSetLayoutCreateFlags flags{};
+        if (use_push_descriptor) {
+            flags |= VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR;
+        }
+        if (use_descriptor_buffer) {
+            flags |= VK_DESCRIPTOR_SET_LAYOUT_CREATE_DESCRIPTOR_BUFFER_BIT_EXT;
+        }
         return device->GetLogical().CreateDescriptorSetLayout({
             .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO,
             .pNext = nullptr,
@@ -89,6 +106,10 @@ public:
         });
     }
 
+    std::span<const VkDescriptorSetLayoutBinding> Bindings() const noexcept {
+        return bindings;
+    }
+
     void Add(const Shader::Info& info, VkShaderStageFlags stage) {
         is_compute |= (stage & VK_SHADER_STAGE_COMPUTE_BIT) != 0;
 
@@ -122,12 +143,18 @@ private:
             });
             ++binding;
             num_descriptors += descriptors[i].count;
+            has_texel_buffers |= type == VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER ||
+                                 type == VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER;
+            has_texture_arrays |=
+                type == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER && descriptors[i].count > 1;
             offset += sizeof(DescriptorUpdateEntry);
         }
     }
 
     const Device* device{};
     bool is_compute{};
+    bool has_texel_buffers{};
+    bool has_texture_arrays{};
     boost::container::small_vector<VkDescriptorSetLayoutBinding, 32> bindings;
     boost::container::small_vector<VkDescriptorUpdateTemplateEntry, 32> entries;
     u32 binding{};
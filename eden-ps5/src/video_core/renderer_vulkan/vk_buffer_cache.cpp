@@ -5,10 +5,13 @@
 #include <array>
 #include <cstring>
 #include <span>
+#include <utility>
 #include <vector>
 
 #include "video_core/renderer_vulkan/vk_buffer_cache.h"
 
+#include "common/literals.h"
+#include "common/logging/log.h"
 #include "video_core/renderer_vulkan/maxwell_to_vk.h"
 #include "video_core/renderer_vulkan/vk_scheduler.h"
 #include "video_core/renderer_vulkan/vk_staging_buffer_pool.h"
@@ -19,6 +22,11 @@
 
 namespace Vulkan {
 namespace {
+using namespace Common::Literals;
+
+/// Uploads up to this size are deferred and recorded together with the other uploads of a draw
+constexpr u64 BATCHED_UPLOAD_THRESHOLD = 64_KiB;
+
 VkBufferCopy MakeBufferCopy(const VideoCommon::BufferCopy& copy) {
     return VkBufferCopy{
         .srcOffset = copy.src_offset,
@@ -338,6 +346,12 @@ BufferCacheRuntime::BufferCacheRuntime(const Device& device_, MemoryAllocator& m
                                                                      scheduler_, staging_pool_);
     quad_strip_index_buffer = std::make_shared<QuadStripIndexBuffer>(device_, memory_allocator_,
                                                                      scheduler_, staging_pool_);
+    // Deferred uploads read stream buffer memory that is only reserved until the next submit
+    scheduler.RegisterPreSubmit([this] { FlushUploads(); });
+}
+
+BufferCacheRuntime::~BufferCacheRuntime() {
+    scheduler.RegisterPreSubmit({});
 }
 
 StagingBufferRef BufferCacheRuntime::UploadStagingBuffer(size_t size) {
@@ -372,6 +386,10 @@ void BufferCacheRuntime::TickFrame(Common::SlotVector<Buffer>& slot_buffers) noe
     for (auto it = slot_buffers.begin(); it != slot_buffers.end(); it++) {
         it->ResetUsageTracking();
     }
+    upload_stats = std::exchange(frame_upload_stats, UploadStats{});
+    LOG_TRACE(Render_Vulkan, "Uploads: {} KiB in {} copy commands, {} batched copies",
+              upload_stats.bytes_copied / 1_KiB, upload_stats.copy_commands,
+              upload_stats.batched_copies);
 }
 
 void BufferCacheRuntime::Finish() {
@@ -396,6 +414,14 @@ void BufferCacheRuntime::CopyBuffer(VkBuffer dst_buffer, VkBuffer src_buffer,
     if (dst_buffer == VK_NULL_HANDLE || src_buffer == VK_NULL_HANDLE) {
         return;
     }
+    for (const VideoCommon::BufferCopy& copy : copies) {
+        frame_upload_stats.bytes_copied += copy.size;
+    }
+    if (src_buffer == staging_pool.StreamBuf() && barrier && !can_reorder_upload &&
+        TryBatchUpload(dst_buffer, copies)) {
+        return;
+    }
+    ++frame_upload_stats.copy_commands;
     static constexpr VkMemoryBarrier READ_BARRIER{
         .sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
         .pNext = nullptr,
@@ -420,6 +446,7 @@ void BufferCacheRuntime::CopyBuffer(VkBuffer dst_buffer, VkBuffer src_buffer,
         return;
     }
 
+    FlushUploads();
     scheduler.RequestOutsideRenderPassOperationContext();
     scheduler.Record([src_buffer, dst_buffer, vk_copies, barrier](vk::CommandBuffer cmdbuf) {
         if (barrier) {
@@ -434,6 +461,91 @@ void BufferCacheRuntime::CopyBuffer(VkBuffer dst_buffer, VkBuffer src_buffer,
     });
 }
 
+bool BufferCacheRuntime::TryBatchUpload(VkBuffer dst_buffer,
+                                        std::span<const VideoCommon::BufferCopy> copies) {
+    if (!batch_uploads) {
+        return false;
+    }
+    u64 total_size{};
+    for (const VideoCommon::BufferCopy& copy : copies) {
+        total_size += copy.size;
+    }
+    if (total_size > BATCHED_UPLOAD_THRESHOLD) {
+        return false;
+    }
+    // Regions of a single copy command can't overlap, start a new batch if they would
+    const bool overlaps = std::ranges::any_of(pending_uploads, [&](const PendingUpload& pending) {
+        if (pending.dst_buffer != dst_buffer) {
+            return false;
+        }
+        return std::ranges::any_of(copies, [&](const VideoCommon::BufferCopy& copy) {
+            return copy.dst_offset < pending.copy.dstOffset + pending.copy.size &&
+                   pending.copy.dstOffset < copy.dst_offset + copy.size;
+        });
+    });
+    if (overlaps) {
+        FlushUploads();
+    }
+    for (const VideoCommon::BufferCopy& copy : copies) {
+        pending_uploads.push_back(PendingUpload{
+            .dst_buffer = dst_buffer,
+            .copy = MakeBufferCopy(copy),
+        });
+    }
+    frame_upload_stats.batched_copies += copies.size();
+    return true;
+}
+
+void BufferCacheRuntime::FlushUploads() {
+    if (pending_uploads.empty()) {
+        return;
+    }
+    static constexpr VkMemoryBarrier READ_BARRIER{
+        .sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
+        .pNext = nullptr,
+        .srcAccessMask = VK_ACCESS_MEMORY_WRITE_BIT,
+        .dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT,
+    };
+    static constexpr VkMemoryBarrier WRITE_BARRIER{
+        .sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
+        .pNext = nullptr,
+        .srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT,
+        .dstAccessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT,
+    };
+    // Group the regions by destination, so each buffer is written by a single copy command
+    std::ranges::stable_sort(pending_uploads, {}, &PendingUpload::dst_buffer);
+    std::vector<VkBuffer> dst_buffers;
+    std::vector<u32> region_counts;
+    std::vector<VkBufferCopy> regions;
+    regions.reserve(pending_uploads.size());
+    for (const PendingUpload& pending : pending_uploads) {
+        if (dst_buffers.empty() || dst_buffers.back() != pending.dst_buffer) {
+            dst_buffers.push_back(pending.dst_buffer);
+            region_counts.push_back(0);
+        }
+        ++region_counts.back();
+        regions.push_back(pending.copy);
+    }
+    pending_uploads.clear();
+    frame_upload_stats.copy_commands += dst_buffers.size();
+
+    scheduler.RequestOutsideRenderPassOperationContext();
+    scheduler.Record([src_buffer = staging_pool.StreamBuf(), dst_buffers = std::move(dst_buffers),
+                      region_counts = std::move(region_counts),
+                      regions = std::move(regions)](vk::CommandBuffer cmdbuf) {
+        cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                               0, READ_BARRIER);
+        const VkBufferCopy* region = regions.data();
+        for (size_t index = 0; index < dst_buffers.size(); ++index) {
+            cmdbuf.CopyBuffer(src_buffer, dst_buffers[index],
+                              vk::Span<VkBufferCopy>(region, region_counts[index]));
+            region += region_counts[index];
+        }
+        cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                               0, WRITE_BARRIER);
+    });
+}
+
 void BufferCacheRuntime::PreCopyBarrier() {
     static constexpr VkMemoryBarrier READ_BARRIER{
         .sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
@@ -441,6 +553,7 @@ void BufferCacheRuntime::PreCopyBarrier() {
         .srcAccessMask = VK_ACCESS_MEMORY_WRITE_BIT,
         .dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT,
     };
+    FlushUploads();
     scheduler.RequestOutsideRenderPassOperationContext();
     scheduler.Record([](vk::CommandBuffer cmdbuf) {
         cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
@@ -479,6 +592,7 @@ void BufferCacheRuntime::ClearBuffer(VkBuffer dest_buffer, u32 offset, size_t si
         .dstAccessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT,
     };
 
+    FlushUploads();
     scheduler.RequestOutsideRenderPassOperationContext();
     scheduler.Record([dest_buffer, offset, size, value](vk::CommandBuffer cmdbuf) {
         cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
@@ -496,11 +610,14 @@ void BufferCacheRuntime::BindIndexBuffer(PrimitiveTopology topology, IndexFormat
     VkDeviceSize vk_offset = offset;
     VkBuffer vk_buffer = buffer;
     if (topology == PrimitiveTopology::Quads || topology == PrimitiveTopology::QuadStrip) {
+        // The conversion passes read the index buffer, so its upload has to be recorded first
+        FlushUploads();
         vk_index_type = VK_INDEX_TYPE_UINT32;
         std::tie(vk_buffer, vk_offset) =
             quad_index_pass.Assemble(index_format, num_indices, base_vertex, buffer, offset,
                                      topology == PrimitiveTopology::QuadStrip);
     } else if (vk_index_type == VK_INDEX_TYPE_UINT8_EXT && !device.IsExtIndexTypeUint8Supported()) {
+        FlushUploads();
         vk_index_type = VK_INDEX_TYPE_UINT16;
         if (uint8_pass) {
             std::tie(vk_buffer, vk_offset) = uint8_pass->Assemble(num_indices, buffer, offset);
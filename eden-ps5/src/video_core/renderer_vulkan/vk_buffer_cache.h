@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include "video_core/buffer_cache/buffer_cache_base.h"
 #include "video_core/buffer_cache/memory_tracker_base.h"
 #include "video_core/buffer_cache/usage_tracker.h"
@@ -80,9 +82,35 @@ public:
                                 GuestDescriptorQueue& guest_descriptor_queue,
                                 ComputePassDescriptorQueue& compute_pass_descriptor_queue,
                                 DescriptorPool& descriptor_pool);
+    ~BufferCacheRuntime();
+
+    struct UploadStats {
+        u64 bytes_copied{};   ///< Bytes copied between buffers
+        u64 copy_commands{};  ///< Number of recorded vkCmdCopyBuffer commands
+        u64 batched_copies{}; ///< Copy regions that were merged into a batch
+    };
 
     void TickFrame(Common::SlotVector<Buffer>& slot_buffers) noexcept;
 
+    /// Returns the upload counters of the last frame.
+    [[nodiscard]] const UploadStats& GetUploadStats() const noexcept {
+        return upload_stats;
+    }
+
+    /// Starts deferring small stream buffer uploads, so the uploads of a draw share one batch.
+    void BeginUploadBatch() noexcept {
+        batch_uploads = true;
+    }
+
+    /// Records the deferred uploads and stops deferring new ones.
+    void EndUploadBatch() {
+        FlushUploads();
+        batch_uploads = false;
+    }
+
+    /// Records the deferred uploads behind a single pair of barriers.
+    void FlushUploads();
+
     void Finish();
 
     u64 GetDeviceLocalMemory() const;
@@ -146,10 +174,18 @@ public:
     }
 
 private:
+    struct PendingUpload {
+        VkBuffer dst_buffer;
+        VkBufferCopy copy;
+    };
+
     void BindBuffer(VkBuffer buffer, u32 offset, u32 size) {
         guest_descriptor_queue.AddBuffer(buffer, offset, size);
     }
 
+    /// Defers a stream buffer upload into the current batch, returns false when it can't be
+    bool TryBatchUpload(VkBuffer dst_buffer, std::span<const VideoCommon::BufferCopy> copies);
+
     void ReserveNullBuffer();
     vk::Buffer CreateNullBuffer();
 
@@ -166,6 +202,11 @@ private:
 
     std::unique_ptr<Uint8Pass> uint8_pass;
     QuadIndexedPass quad_index_pass;
+
+    bool batch_uploads{};
+    std::vector<PendingUpload> pending_uploads;
+    UploadStats frame_upload_stats;
+    UploadStats upload_stats;
 };
 
 struct BufferCacheParams {
@@ -10,11 +10,14 @@
 #include <optional>
 #include <utility>
 
+#include <boost/container/small_vector.hpp>
+
 #include "video_core/renderer_vulkan/vk_texture_cache.h"
 
 #include "common/assert.h"
 #include "common/common_types.h"
 #include "common/div_ceil.h"
+#include "common/settings.h"
 #include "common/vector_math.h"
 #include "video_core/host_shaders/astc_decoder_comp_spv.h"
 #include "video_core/host_shaders/convert_msaa_to_non_msaa_comp_spv.h"
@@ -22,6 +25,7 @@
 #include "video_core/host_shaders/queries_prefix_scan_sum_comp_spv.h"
 #include "video_core/host_shaders/queries_prefix_scan_sum_nosubgroups_comp_spv.h"
 #include "video_core/host_shaders/resolve_conditional_render_comp_spv.h"
+#include "video_core/host_shaders/vulkan_bcn_encode_comp_spv.h"
 #include "video_core/host_shaders/vulkan_quad_indexed_comp_spv.h"
 #include "video_core/host_shaders/vulkan_uint8_comp_spv.h"
 #include "video_core/renderer_vulkan/vk_compute_pass.h"
@@ -31,6 +35,7 @@
 #include "video_core/renderer_vulkan/vk_update_descriptor.h"
 #include "video_core/texture_cache/accelerated_swizzle.h"
 #include "video_core/texture_cache/types.h"
+#include "video_core/texture_cache/util.h"
 #include "video_core/textures/decoders.h"
 #include "video_core/vulkan_common/vulkan_device.h"
 #include "video_core/vulkan_common/vulkan_wrapper.h"
@@ -43,6 +48,10 @@ constexpr u32 ASTC_BINDING_INPUT_BUFFER = 0;
 constexpr u32 ASTC_BINDING_OUTPUT_IMAGE = 1;
 constexpr size_t ASTC_NUM_BINDINGS = 2;
 
+constexpr u32 BCN_BINDING_INPUT_IMAGE = 0;
+constexpr u32 BCN_BINDING_OUTPUT_BUFFER = 1;
+constexpr size_t BCN_NUM_BINDINGS = 2;
+
 template <size_t size>
 inline constexpr VkPushConstantRange COMPUTE_PUSH_CONSTANT_RANGE{
     .stageFlags = VK_SHADER_STAGE_COMPUTE_BIT,
@@ -212,6 +221,53 @@ constexpr std::array<VkDescriptorUpdateTemplateEntry, ASTC_NUM_BINDINGS>
         },
     }};
 
+constexpr std::array<VkDescriptorSetLayoutBinding, BCN_NUM_BINDINGS> BCN_DESCRIPTOR_SET_BINDINGS{{
+    {
+        .binding = BCN_BINDING_INPUT_IMAGE,
+        .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE,
+        .descriptorCount = 1,
+        .stageFlags = VK_SHADER_STAGE_COMPUTE_BIT,
+        .pImmutableSamplers = nullptr,
+    },
+    {
+        .binding = BCN_BINDING_OUTPUT_BUFFER,
+        .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+        .descriptorCount = 1,
+        .stageFlags = VK_SHADER_STAGE_COMPUTE_BIT,
+        .pImmutableSamplers = nullptr,
+    },
+}};
+
+constexpr DescriptorBankInfo BCN_BANK_INFO{
+    .uniform_buffers = 0,
+    .storage_buffers = 1,
+    .texture_buffers = 0,
+    .image_buffers = 0,
+    .textures = 0,
+    .images = 1,
+    .score = 2,
+};
+
+constexpr std::array<VkDescriptorUpdateTemplateEntry, BCN_NUM_BINDINGS>
+    BCN_PASS_DESCRIPTOR_UPDATE_TEMPLATE_ENTRY{{
+        {
+            .dstBinding = BCN_BINDING_INPUT_IMAGE,
+            .dstArrayElement = 0,
+            .descriptorCount = 1,
+            .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE,
+            .offset = BCN_BINDING_INPUT_IMAGE * sizeof(DescriptorUpdateEntry),
+            .stride = sizeof(DescriptorUpdateEntry),
+        },
+        {
+            .dstBinding = BCN_BINDING_OUTPUT_BUFFER,
+            .dstArrayElement = 0,
+            .descriptorCount = 1,
+            .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+            .offset = BCN_BINDING_OUTPUT_BUFFER * sizeof(DescriptorUpdateEntry),
+            .stride = sizeof(DescriptorUpdateEntry),
+        },
+    }};
+
 struct AstcPushConstants {
     std::array<u32, 2> blocks_dims;
     u32 layer_stride;
@@ -221,6 +277,26 @@ struct AstcPushConstants {
     u32 block_height_mask;
 };
 
+struct BCnPushConstants {
+    std::array<u32, 2> size;
+    u32 is_bc3;
+    u32 power_iterations;
+    u32 refine_count;
+};
+
+/// Returns the endpoint search effort of the BCn encoder as power iterations and refinements
+std::pair<u32, u32> BCnEncodeEffort(Settings::AstcRecompressionQuality quality) {
+    switch (quality) {
+    case Settings::AstcRecompressionQuality::Fast:
+        return {1, 0};
+    case Settings::AstcRecompressionQuality::Normal:
+        return {4, 1};
+    case Settings::AstcRecompressionQuality::High:
+        return {4, 2};
+    }
+    return {4, 1};
+}
+
 struct QueriesPrefixScanPushConstants {
     u32 min_accumulation_base;
     u32 max_accumulation_base;
@@ -525,6 +601,128 @@ void QueriesPrefixScanPass::Run(VkBuffer accumulation_buffer, VkBuffer dst_buffe
     }
 }
 
+BCnEncoderPass::BCnEncoderPass(const Device& device_, Scheduler& scheduler_,
+                               DescriptorPool& descriptor_pool_,
+                               StagingBufferPool& staging_buffer_pool_,
+                               ComputePassDescriptorQueue& compute_pass_descriptor_queue_)
+    : ComputePass(device_, descriptor_pool_, BCN_DESCRIPTOR_SET_BINDINGS,
+                  BCN_PASS_DESCRIPTOR_UPDATE_TEMPLATE_ENTRY, BCN_BANK_INFO,
+                  COMPUTE_PUSH_CONSTANT_RANGE<sizeof(BCnPushConstants)>, VULKAN_BCN_ENCODE_COMP_SPV),
+      scheduler{scheduler_}, staging_buffer_pool{staging_buffer_pool_},
+      compute_pass_descriptor_queue{compute_pass_descriptor_queue_} {}
+
+BCnEncoderPass::~BCnEncoderPass() = default;
+
+void BCnEncoderPass::Encode(Image& image, std::span<const VkImageView> src_views, bool is_bc3) {
+    const u32 bytes_per_block = is_bc3 ? 16 : 8;
+    const u32 num_layers = static_cast<u32>(image.info.resources.layers);
+    const auto [power_iterations, refine_count] =
+        BCnEncodeEffort(Settings::values.astc_recompression_quality.GetValue());
+    scheduler.RequestOutsideRenderPassOperationContext();
+    const VkPipeline vk_pipeline = *pipeline;
+    const VkImageAspectFlags aspect_mask = image.AspectMask();
+    const VkImage vk_image = image.Handle();
+    const bool is_initialized = image.ExchangeInitialization();
+    scheduler.Record([vk_pipeline, vk_image, aspect_mask,
+                      is_initialized](vk::CommandBuffer cmdbuf) {
+        const VkImageMemoryBarrier image_barrier{
+            .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+            .pNext = nullptr,
+            .srcAccessMask = static_cast<VkAccessFlags>(is_initialized ? VK_ACCESS_MEMORY_WRITE_BIT
+                                                                       : VK_ACCESS_NONE),
+            .dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT,
+            .oldLayout = is_initialized ? VK_IMAGE_LAYOUT_GENERAL : VK_IMAGE_LAYOUT_UNDEFINED,
+            .newLayout = VK_IMAGE_LAYOUT_GENERAL,
+            .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+            .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+            .image = vk_image,
+            .subresourceRange{
+                .aspectMask = aspect_mask,
+                .baseMipLevel = 0,
+                .levelCount = VK_REMAINING_MIP_LEVELS,
+                .baseArrayLayer = 0,
+                .layerCount = VK_REMAINING_ARRAY_LAYERS,
+            },
+        };
+        cmdbuf.PipelineBarrier(is_initialized ? VK_PIPELINE_STAGE_ALL_COMMANDS_BIT
+                                              : VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+                               VK_PIPELINE_STAGE_TRANSFER_BIT, 0, image_barrier);
+        cmdbuf.BindPipeline(VK_PIPELINE_BIND_POINT_COMPUTE, vk_pipeline);
+    });
+    for (s32 level = 0; level < image.info.resources.levels; ++level) {
+        const VideoCommon::Extent3D size = VideoCommon::MipSize(image.info.size, level);
+        const u32 num_blocks_x = Common::DivCeil(size.width, 4U);
+        const u32 num_blocks_y = Common::DivCeil(size.height, 4U);
+        const size_t level_size = num_blocks_x * num_blocks_y * num_layers * bytes_per_block;
+        const auto staging = staging_buffer_pool.Request(level_size, MemoryUsage::DeviceLocal);
+
+        compute_pass_descriptor_queue.Acquire();
+        compute_pass_descriptor_queue.AddImage(src_views[level]);
+        compute_pass_descriptor_queue.AddBuffer(staging.buffer, staging.offset, level_size);
+        const void* const descriptor_data{compute_pass_descriptor_queue.UpdateData()};
+
+        const BCnPushConstants uniforms{
+            .size = {size.width, size.height},
+            .is_bc3 = is_bc3 ? 1U : 0U,
+            .power_iterations = power_iterations,
+            .refine_count = refine_count,
+        };
+        const VkBufferImageCopy copy{
+            .bufferOffset = staging.offset,
+            .bufferRowLength = 0,
+            .bufferImageHeight = 0,
+            .imageSubresource{
+                .aspectMask = aspect_mask,
+                .mipLevel = static_cast<u32>(level),
+                .baseArrayLayer = 0,
+                .layerCount = num_layers,
+            },
+            .imageOffset{0, 0, 0},
+            .imageExtent{size.width, size.height, 1},
+        };
+        scheduler.Record([this, descriptor_data, uniforms, num_blocks_x, num_blocks_y, num_layers,
+                          buffer = staging.buffer, vk_image, copy](vk::CommandBuffer cmdbuf) {
+            static constexpr VkMemoryBarrier WRITE_BARRIER{
+                .sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
+                .pNext = nullptr,
+                .srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT,
+                .dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT,
+            };
+            const VkDescriptorSet set = descriptor_allocator.Commit();
+            device.GetLogical().UpdateDescriptorSet(set, *descriptor_template, descriptor_data);
+            cmdbuf.BindDescriptorSets(VK_PIPELINE_BIND_POINT_COMPUTE, *layout, 0, set, {});
+            cmdbuf.PushConstants(*layout, VK_SHADER_STAGE_COMPUTE_BIT, uniforms);
+            cmdbuf.Dispatch(Common::DivCeil(num_blocks_x, 8U), Common::DivCeil(num_blocks_y, 8U),
+                            num_layers);
+            cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                                   VK_PIPELINE_STAGE_TRANSFER_BIT, 0, WRITE_BARRIER);
+            cmdbuf.CopyBufferToImage(buffer, vk_image, VK_IMAGE_LAYOUT_GENERAL, copy);
+        });
+    }
+    scheduler.Record([vk_image, aspect_mask](vk::CommandBuffer cmdbuf) {
+        const VkImageMemoryBarrier image_barrier{
+            .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+            .pNext = nullptr,
+            .srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT,
+            .dstAccessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT,
+            .oldLayout = VK_IMAGE_LAYOUT_GENERAL,
+            .newLayout = VK_IMAGE_LAYOUT_GENERAL,
+            .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+            .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+            .image = vk_image,
+            .subresourceRange{
+                .aspectMask = aspect_mask,
+                .baseMipLevel = 0,
+                .levelCount = VK_REMAINING_MIP_LEVELS,
+                .baseArrayLayer = 0,
+                .layerCount = VK_REMAINING_ARRAY_LAYERS,
+            },
+        };
+        cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                               0, image_barrier);
+    });
+}
+
 ASTCDecoderPass::ASTCDecoderPass(const Device& device_, Scheduler& scheduler_,
                                  DescriptorPool& descriptor_pool_,
                                  StagingBufferPool& staging_buffer_pool_,
@@ -541,16 +739,84 @@ ASTCDecoderPass::~ASTCDecoderPass() = default;
 
 void ASTCDecoderPass::Assemble(Image& image, const StagingBufferRef& map,
                                std::span<const VideoCommon::SwizzleParameters> swizzles) {
+    boost::container::small_vector<VkImageView, 16> views;
+    for (s32 level = 0; level < image.info.resources.levels; ++level) {
+        views.push_back(image.StorageImageView(level));
+    }
+    scheduler.RequestOutsideRenderPassOperationContext();
+    RecordDecode(image, image.Handle(), views, image.ExchangeInitialization(), map, swizzles);
+    scheduler.Finish();
+}
+
+void ASTCDecoderPass::AssembleRecompressed(Image& image, const StagingBufferRef& map,
+                                           std::span<const VideoCommon::SwizzleParameters> swizzles,
+                                           BCnEncoderPass& encoder, bool is_bc3) {
+    const auto& info = image.info;
+    const vk::Image scratch_image = memory_allocator.CreateImage(VkImageCreateInfo{
+        .sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,
+        .pNext = nullptr,
+        .flags = 0,
+        .imageType = VK_IMAGE_TYPE_2D,
+        .format = VK_FORMAT_A8B8G8R8_UNORM_PACK32,
+        .extent{
+            .width = info.size.width,
+            .height = info.size.height,
+            .depth = 1,
+        },
+        .mipLevels = static_cast<u32>(info.resources.levels),
+        .arrayLayers = static_cast<u32>(info.resources.layers),
+        .samples = VK_SAMPLE_COUNT_1_BIT,
+        .tiling = VK_IMAGE_TILING_OPTIMAL,
+        .usage = VK_IMAGE_USAGE_STORAGE_BIT,
+        .sharingMode = VK_SHARING_MODE_EXCLUSIVE,
+        .queueFamilyIndexCount = 0,
+        .pQueueFamilyIndices = nullptr,
+        .initialLayout = VK_IMAGE_LAYOUT_UNDEFINED,
+    });
+    boost::container::small_vector<vk::ImageView, 16> scratch_views;
+    boost::container::small_vector<VkImageView, 16> views;
+    for (s32 level = 0; level < info.resources.levels; ++level) {
+        scratch_views.push_back(device.GetLogical().CreateImageView(VkImageViewCreateInfo{
+            .sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO,
+            .pNext = nullptr,
+            .flags = 0,
+            .image = *scratch_image,
+            .viewType = VK_IMAGE_VIEW_TYPE_2D_ARRAY,
+            .format = VK_FORMAT_A8B8G8R8_UNORM_PACK32,
+            .components{
+                .r = VK_COMPONENT_SWIZZLE_IDENTITY,
+                .g = VK_COMPONENT_SWIZZLE_IDENTITY,
+                .b = VK_COMPONENT_SWIZZLE_IDENTITY,
+                .a = VK_COMPONENT_SWIZZLE_IDENTITY,
+            },
+            .subresourceRange{
+                .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+                .baseMipLevel = static_cast<u32>(level),
+                .levelCount = 1,
+                .baseArrayLayer = 0,
+                .layerCount = VK_REMAINING_ARRAY_LAYERS,
+            },
+        }));
+        views.push_back(*scratch_views.back());
+    }
+    scheduler.RequestOutsideRenderPassOperationContext();
+    RecordDecode(image, *scratch_image, views, false, map, swizzles);
+    encoder.Encode(image, views, is_bc3);
+    // The scratch image is destroyed on return, so wait for both passes
+    scheduler.Finish();
+}
+
+void ASTCDecoderPass::RecordDecode(const Image& image, VkImage vk_image,
+                                   std::span<const VkImageView> dst_views, bool is_initialized,
+                                   const StagingBufferRef& map,
+                                   std::span<const VideoCommon::SwizzleParameters> swizzles) {
     using namespace VideoCommon::Accelerated;
     const std::array<u32, 2> block_dims{
         VideoCore::Surface::DefaultBlockWidth(image.info.format),
         VideoCore::Surface::DefaultBlockHeight(image.info.format),
     };
-    scheduler.RequestOutsideRenderPassOperationContext();
     const VkPipeline vk_pipeline = *pipeline;
-    const VkImageAspectFlags aspect_mask = image.AspectMask();
-    const VkImage vk_image = image.Handle();
-    const bool is_initialized = image.ExchangeInitialization();
+    const VkImageAspectFlags aspect_mask = VK_IMAGE_ASPECT_COLOR_BIT;
     scheduler.Record([vk_pipeline, vk_image, aspect_mask,
                       is_initialized](vk::CommandBuffer cmdbuf) {
         const VkImageMemoryBarrier image_barrier{
@@ -586,7 +852,7 @@ void ASTCDecoderPass::Assemble(Image& image, const StagingBufferRef& map,
         compute_pass_descriptor_queue.Acquire();
         compute_pass_descriptor_queue.AddBuffer(map.buffer, input_offset,
                                                 image.guest_size_bytes - swizzle.buffer_offset);
-        compute_pass_descriptor_queue.AddImage(image.StorageImageView(swizzle.level));
+        compute_pass_descriptor_queue.AddImage(dst_views[swizzle.level]);
         const void* const descriptor_data{compute_pass_descriptor_queue.UpdateData()};
 
         // To unswizzle the ASTC data
@@ -633,7 +899,6 @@ void ASTCDecoderPass::Assemble(Image& image, const StagingBufferRef& map,
         cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
                                VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, image_barrier);
     });
-    scheduler.Finish();
 }
 
 MSAACopyPass::MSAACopyPass(const Device& device_, Scheduler& scheduler_,
@@ -112,6 +112,23 @@ private:
     ComputePassDescriptorQueue& compute_pass_descriptor_queue;
 };
 
+class BCnEncoderPass final : public ComputePass {
+public:
+    explicit BCnEncoderPass(const Device& device_, Scheduler& scheduler_,
+                            DescriptorPool& descriptor_pool_,
+                            StagingBufferPool& staging_buffer_pool_,
+                            ComputePassDescriptorQueue& compute_pass_descriptor_queue_);
+    ~BCnEncoderPass();
+
+    /// Encodes the levels of an RGBA8 image in general layout into the BC1 or BC3 image
+    void Encode(Image& image, std::span<const VkImageView> src_views, bool is_bc3);
+
+private:
+    Scheduler& scheduler;
+    StagingBufferPool& staging_buffer_pool;
+    ComputePassDescriptorQueue& compute_pass_descriptor_queue;
+};
+
 class ASTCDecoderPass final : public ComputePass {
 public:
     explicit ASTCDecoderPass(const Device& device_, Scheduler& scheduler_,
@@ -124,7 +141,16 @@ public:
     void Assemble(Image& image, const StagingBufferRef& map,
                   std::span<const VideoCommon::SwizzleParameters> swizzles);
 
+    /// Decodes into a scratch RGBA8 image and encodes it to the BCn format of the image
+    void AssembleRecompressed(Image& image, const StagingBufferRef& map,
+                              std::span<const VideoCommon::SwizzleParameters> swizzles,
+                              BCnEncoderPass& encoder, bool is_bc3);
+
 private:
+    void RecordDecode(const Image& image, VkImage vk_image, std::span<const VkImageView> dst_views,
+                      bool is_initialized, const StagingBufferRef& map,
+                      std::span<const VideoCommon::SwizzleParameters> swizzles);
+
     Scheduler& scheduler;
     StagingBufferPool& staging_buffer_pool;
     ComputePassDescriptorQueue& compute_pass_descriptor_queue;
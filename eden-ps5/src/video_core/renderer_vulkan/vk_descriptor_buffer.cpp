@@ -0,0 +1,239 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <algorithm>
+
+#include "common/alignment.h"
+#include "common/assert.h"
+#include "common/literals.h"
+#include "video_core/renderer_vulkan/vk_descriptor_buffer.h"
+#include "video_core/renderer_vulkan/vk_scheduler.h"
+#include "video_core/vulkan_common/vulkan_device.h"
+
+namespace Vulkan {
+namespace {
+
+using namespace Common::Literals;
+
+// Preferred size of each descriptor buffer chunk
+constexpr VkDeviceSize PREFERRED_CHUNK_SIZE = 4_MiB;
+
+size_t DescriptorSize(const VkPhysicalDeviceDescriptorBufferPropertiesEXT& properties,
+                      VkDescriptorType type) {
+    // Robust buffer access is always enabled, so buffers use the robust descriptor sizes
+    switch (type) {
+    case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+        return properties.robustUniformBufferDescriptorSize;
+    case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+        return properties.robustStorageBufferDescriptorSize;
+    case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+        return properties.combinedImageSamplerDescriptorSize;
+    case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+        return properties.storageImageDescriptorSize;
+    default:
+        ASSERT_MSG(false, "Unsupported descriptor buffer type {}", static_cast<int>(type));
+        return 0;
+    }
+}
+
+bool IsBufferType(VkDescriptorType type) {
+    return type == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER || type == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+}
+
+} // Anonymous namespace
+
+DescriptorBufferAddressCache::DescriptorBufferAddressCache(const Device& device_)
+    : device{device_} {}
+
+VkDeviceAddress DescriptorBufferAddressCache::Address(VkBuffer buffer) {
+    const auto [it, is_new] = addresses.try_emplace(buffer);
+    if (is_new) {
+        it->second = device.GetLogical().GetBufferDeviceAddress(buffer);
+    }
+    return it->second;
+}
+
+DescriptorBufferLayout::DescriptorBufferLayout(
+    const Device& device_, VkDescriptorSetLayout set_layout,
+    std::span<const VkDescriptorSetLayoutBinding> layout_bindings)
+    : device{&device_} {
+    const vk::Device& dev{device->GetLogical()};
+    const auto& properties{device->GetDescriptorBufferProperties()};
+    size = dev.GetDescriptorSetLayoutSizeEXT(set_layout);
+    bindings.reserve(layout_bindings.size());
+    for (const VkDescriptorSetLayoutBinding& binding : layout_bindings) {
+        bindings.push_back({
+            .type = binding.descriptorType,
+            .count = binding.descriptorCount,
+            .offset = dev.GetDescriptorSetLayoutBindingOffsetEXT(set_layout, binding.binding),
+            .descriptor_size = DescriptorSize(properties, binding.descriptorType),
+        });
+        num_entries += binding.descriptorCount;
+    }
+}
+
+void DescriptorBufferLayout::Write(const DescriptorUpdateEntry* payload, u8* dst,
+                                   DescriptorBufferAddressCache& address_cache) const {
+    const vk::Device& dev{device->GetLogical()};
+    for (const Binding& binding : bindings) {
+        u8* descriptor{dst + binding.offset};
+        for (u32 index = 0; index < binding.count; ++index) {
+            const DescriptorUpdateEntry& entry{*(payload++)};
+            VkDescriptorGetInfoEXT info{
+                .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_GET_INFO_EXT,
+                .pNext = nullptr,
+                .type = binding.type,
+                .data{},
+            };
+            VkDescriptorAddressInfoEXT address_info;
+            if (IsBufferType(binding.type)) {
+                // Null buffers are only passed when null descriptors are supported
+                const VkBuffer buffer{entry.buffer.buffer};
+                address_info = {
+                    .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_ADDRESS_INFO_EXT,
+                    .pNext = nullptr,
+                    .address = buffer ? address_cache.Address(buffer) + entry.buffer.offset : 0,
+                    .range = buffer ? entry.buffer.range : VK_WHOLE_SIZE,
+                    .format = VK_FORMAT_UNDEFINED,
+                };
+            }
+            switch (binding.type) {
+            case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+                info.data.pUniformBuffer = &address_info;
+                break;
+            case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+                info.data.pStorageBuffer = &address_info;
+                break;
+            case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+                info.data.pCombinedImageSampler = &entry.image;
+                break;
+            case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+                info.data.pStorageImage = &entry.image;
+                break;
+            default:
+                break;
+            }
+            dev.GetDescriptorEXT(info, binding.descriptor_size, descriptor);
+            descriptor += binding.descriptor_size;
+        }
+    }
+}
+
+bool DescriptorBufferLayout::Equal(const DescriptorUpdateEntry* lhs,
+                                   const DescriptorUpdateEntry* rhs) const noexcept {
+    // Entries are compared by field, as the padding of image entries is never written
+    for (const Binding& binding : bindings) {
+        const bool is_buffer{IsBufferType(binding.type)};
+        for (u32 index = 0; index < binding.count; ++index, ++lhs, ++rhs) {
+            if (is_buffer) {
+                if (lhs->buffer.buffer != rhs->buffer.buffer ||
+                    lhs->buffer.offset != rhs->buffer.offset ||
+                    lhs->buffer.range != rhs->buffer.range) {
+                    return false;
+                }
+            } else if (lhs->image.sampler != rhs->image.sampler ||
+                       lhs->image.imageView != rhs->image.imageView) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+DescriptorBufferRing::DescriptorBufferRing(const Device& device_,
+                                           MemoryAllocator& memory_allocator_,
+                                           Scheduler& scheduler_)
+    : device{device_}, memory_allocator{memory_allocator_}, scheduler{scheduler_},
+      address_cache{device_} {
+    if (!device.IsExtDescriptorBufferSupported()) {
+        return;
+    }
+    const auto& properties{device.GetDescriptorBufferProperties()};
+    chunk_size = std::min({PREFERRED_CHUNK_SIZE, properties.maxResourceDescriptorBufferRange,
+                           properties.maxSamplerDescriptorBufferRange});
+    alignment = properties.descriptorBufferOffsetAlignment;
+    usage = VK_BUFFER_USAGE_RESOURCE_DESCRIPTOR_BUFFER_BIT_EXT |
+            VK_BUFFER_USAGE_SAMPLER_DESCRIPTOR_BUFFER_BIT_EXT |
+            VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
+}
+
+DescriptorBufferRing::~DescriptorBufferRing() = default;
+
+DescriptorBufferRing::Allocation DescriptorBufferRing::Allocate(VkDeviceSize size) {
+    ASSERT(size <= chunk_size);
+    if (chunks.empty() || iterator + size > chunk_size) {
+        NextChunk();
+    }
+    Chunk& chunk{chunks[current_chunk]};
+    chunk.tick = scheduler.CurrentTick();
+
+    const VkDeviceSize offset{iterator};
+    iterator = Common::AlignUp(iterator + size, alignment);
+    return Allocation{
+        .buffer = *chunk.buffer,
+        .address = chunk.address,
+        .offset = offset,
+        .mapped = chunk.mapped + offset,
+        .chunk = current_chunk,
+        .generation = chunk.generation,
+    };
+}
+
+bool DescriptorBufferRing::Reuse(const Allocation& allocation) {
+    Chunk& chunk{chunks[allocation.chunk]};
+    if (chunk.generation != allocation.generation) {
+        return false;
+    }
+    chunk.tick = scheduler.CurrentTick();
+    return true;
+}
+
+void DescriptorBufferRing::NextChunk() {
+    const size_t num_chunks{chunks.size()};
+    for (size_t step = 1; step <= num_chunks; ++step) {
+        const size_t index{(current_chunk + step) % num_chunks};
+        Chunk& chunk{chunks[index]};
+        if (index == current_chunk || !scheduler.IsFree(chunk.tick)) {
+            continue;
+        }
+        // Previous allocations from this chunk are about to be overwritten
+        ++chunk.generation;
+        current_chunk = index;
+        iterator = 0;
+        return;
+    }
+    vk::Buffer buffer{CreateBuffer(chunk_size)};
+    const VkDeviceAddress address{device.GetLogical().GetBufferDeviceAddress(*buffer)};
+    u8* const mapped{buffer.Mapped().data()};
+    chunks.push_back(Chunk{
+        .buffer = std::move(buffer),
+        .address = address,
+        .mapped = mapped,
+        .tick = 0,
+        .generation = 0,
+    });
+    current_chunk = chunks.size() - 1;
+    iterator = 0;
+}
+
+vk::Buffer DescriptorBufferRing::CreateBuffer(VkDeviceSize size) const {
+    vk::Buffer buffer{memory_allocator.CreateBuffer(
+        {
+            .sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+            .pNext = nullptr,
+            .flags = 0,
+            .size = size,
+            .usage = usage,
+            .sharingMode = VK_SHARING_MODE_EXCLUSIVE,
+            .queueFamilyIndexCount = 0,
+            .pQueueFamilyIndices = nullptr,
+        },
+        MemoryUsage::Upload)};
+    ASSERT_MSG(!buffer.Mapped().empty(), "Descriptor buffers must be host visible!");
+    if (device.HasDebuggingToolAttached()) {
+        buffer.SetObjectNameEXT("Descriptor Buffer");
+    }
+    return buffer;
+}
+
+} // namespace Vulkan
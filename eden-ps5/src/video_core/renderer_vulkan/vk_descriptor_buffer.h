@@ -0,0 +1,154 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+#include "common/common_types.h"
+#include "video_core/renderer_vulkan/vk_update_descriptor.h"
+#include "video_core/vulkan_common/vulkan_memory_allocator.h"
+#include "video_core/vulkan_common/vulkan_wrapper.h"
+
+namespace Vulkan {
+
+class Device;
+class Scheduler;
+
+/**
+ * Caches the device addresses of the buffers referenced by descriptors, so that writing a
+ * descriptor does not query the driver for an address it already returned.
+ *
+ * Buffers are only destroyed while ticking a frame, when the cache is cleared, so a handle that
+ * is reused by a new buffer never maps to the address of the destroyed one.
+ */
+class DescriptorBufferAddressCache {
+public:
+    explicit DescriptorBufferAddressCache(const Device& device);
+
+    /// Returns the device address of the start of a buffer.
+    [[nodiscard]] VkDeviceAddress Address(VkBuffer buffer);
+
+    /// Forgets every cached address.
+    void Clear() noexcept {
+        addresses.clear();
+    }
+
+private:
+    const Device& device;
+    std::unordered_map<VkBuffer, VkDeviceAddress> addresses;
+};
+
+/// Describes where each descriptor of a set layout lives inside a descriptor buffer.
+class DescriptorBufferLayout {
+public:
+    explicit DescriptorBufferLayout() = default;
+    explicit DescriptorBufferLayout(const Device& device, VkDescriptorSetLayout set_layout,
+                                    std::span<const VkDescriptorSetLayoutBinding> bindings);
+
+    /// Writes the descriptors of a guest descriptor queue payload into mapped descriptor memory.
+    void Write(const DescriptorUpdateEntry* payload, u8* dst,
+               DescriptorBufferAddressCache& address_cache) const;
+
+    /// Returns true when both payloads describe the same descriptors.
+    [[nodiscard]] bool Equal(const DescriptorUpdateEntry* lhs,
+                             const DescriptorUpdateEntry* rhs) const noexcept;
+
+    /// Returns the size in bytes of a descriptor set with this layout.
+    [[nodiscard]] VkDeviceSize Size() const noexcept {
+        return size;
+    }
+
+    /// Returns the number of payload entries consumed by a set with this layout.
+    [[nodiscard]] size_t NumEntries() const noexcept {
+        return num_entries;
+    }
+
+private:
+    struct Binding {
+        VkDescriptorType type;
+        u32 count;
+        VkDeviceSize offset;
+        size_t descriptor_size;
+    };
+
+    const Device* device{};
+    std::vector<Binding> bindings;
+    VkDeviceSize size{};
+    size_t num_entries{};
+};
+
+/**
+ * Suballocates descriptor sets from persistently mapped descriptor buffers.
+ *
+ * Sets are allocated linearly from a chunk. When a chunk is full, the ring moves on to a chunk
+ * the GPU has finished with, or creates a new one instead of waiting when all of them are busy.
+ */
+class DescriptorBufferRing {
+public:
+    struct Allocation {
+        VkBuffer buffer;
+        VkDeviceAddress address;
+        VkDeviceSize offset;
+        u8* mapped;
+        size_t chunk;
+        u64 generation;
+    };
+
+    explicit DescriptorBufferRing(const Device& device, MemoryAllocator& memory_allocator,
+                                  Scheduler& scheduler);
+    ~DescriptorBufferRing();
+
+    DescriptorBufferRing& operator=(const DescriptorBufferRing&) = delete;
+    DescriptorBufferRing(const DescriptorBufferRing&) = delete;
+
+    /// Allocates descriptor memory for a set of the given size.
+    [[nodiscard]] Allocation Allocate(VkDeviceSize size);
+
+    /// Keeps a previous allocation alive for the current tick.
+    /// Returns false when its memory has already been recycled.
+    [[nodiscard]] bool Reuse(const Allocation& allocation);
+
+    /// Drops the buffer addresses cached during the frame. Must be called after buffers were
+    /// destroyed.
+    void TickFrame() noexcept {
+        address_cache.Clear();
+    }
+
+    /// Returns the addresses of the buffers referenced by descriptors written this frame.
+    [[nodiscard]] DescriptorBufferAddressCache& AddressCache() noexcept {
+        return address_cache;
+    }
+
+private:
+    struct Chunk {
+        vk::Buffer buffer;
+        VkDeviceAddress address;
+        u8* mapped;
+        u64 tick;
+        u64 generation;
+    };
+
+    /// Moves to an idle chunk, creating a new one when all of them are in use.
+    void NextChunk();
+
+    vk::Buffer CreateBuffer(VkDeviceSize size) const;
+
+    const Device& device;
+    MemoryAllocator& memory_allocator;
+    Scheduler& scheduler;
+
+    VkDeviceSize chunk_size{};
+    VkDeviceSize alignment{};
+    VkBufferUsageFlags usage{};
+
+    std::vector<Chunk> chunks;
+    size_t current_chunk{};
+    VkDeviceSize iterator{};
+
+    DescriptorBufferAddressCache address_cache;
+};
+
+} // namespace Vulkan
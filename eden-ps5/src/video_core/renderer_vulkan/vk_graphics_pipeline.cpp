@@ -241,15 +241,21 @@ ConfigureFuncPtr ConfigureFunc(const std::array<vk::ShaderModule, NUM_STAGES>& m
 // TODO(crueter): This is the worst-formatted code I have EVER seen
 GraphicsPipeline::GraphicsPipeline(
     Scheduler& scheduler_, BufferCache& buffer_cache_, TextureCache& texture_cache_,
-    vk::PipelineCache& pipeline_cache_, VideoCore::ShaderNotify* shader_notify,
-    const Device& device_, DescriptorPool& descriptor_pool,
-    GuestDescriptorQueue& guest_descriptor_queue_, Common::ThreadWorker* worker_thread,
-    PipelineStatistics* pipeline_statistics, RenderPassCache& render_pass_cache,
-    const GraphicsPipelineCacheKey& key_, std::array<vk::ShaderModule, NUM_STAGES> stages,
+    vk::PipelineCache& pipeline_cache_, PipelineLibraryCache& library_cache_,
+    VideoCore::ShaderNotify* shader_notify, const Device& device_,
+    DescriptorPool& descriptor_pool,
+    DescriptorBufferRing& descriptor_buffer_ring_, GuestDescriptorQueue& guest_descriptor_queue_,
+    Common::ThreadWorker* worker_thread, PipelineStatistics* pipeline_statistics,
+    RenderPassCache& render_pass_cache, const GraphicsPipelineCacheKey& key_,
+    std::array<vk::ShaderModule, NUM_STAGES> stages,
+    const std::array<u64, NUM_STAGES>& module_hashes,
     const std::array<const Shader::Info*, NUM_STAGES>& infos)
     : key{key_}, device{device_}, texture_cache{texture_cache_}, buffer_cache{buffer_cache_},
-      pipeline_cache(pipeline_cache_), scheduler{scheduler_},
-      guest_descriptor_queue{guest_descriptor_queue_}, spv_modules{std::move(stages)} {
+      pipeline_cache(pipeline_cache_), library_cache{library_cache_}, scheduler{scheduler_},
+      descriptor_buffer_ring{descriptor_buffer_ring_},
+      guest_descriptor_queue{guest_descriptor_queue_}, spv_modules{std::move(stages)},
+      spv_hashes{module_hashes},
+      uses_pipeline_library{device.IsExtGraphicsPipelineLibrarySupported()} {
     if (shader_notify) {
         shader_notify->MarkShaderBuilding();
     }
@@ -263,23 +269,49 @@ GraphicsPipeline::GraphicsPipeline(
         std::ranges::copy(info->constant_buffer_used_sizes, uniform_buffer_sizes[stage].begin());
         num_textures += Shader::NumDescriptors(info->texture_descriptors);
     }
-    auto func{[this, shader_notify, &render_pass_cache, &descriptor_pool, pipeline_statistics] {
+    if (device.IsExtDescriptorBufferSupported()) {
+        // Descriptors are written when the draw is configured, which can happen before a pipeline
+        // built in the background is ready, so the descriptor buffer layout is made up front.
+        const DescriptorLayoutBuilder builder{MakeBuilder(device, stage_infos)};
+        if (builder.CanUseDescriptorBuffer()) {
+            descriptor_set_layout = builder.CreateDescriptorSetLayout(false, true);
+        }
+        if (descriptor_set_layout) {
+            descriptor_buffer_layout =
+                DescriptorBufferLayout(device, *descriptor_set_layout, builder.Bindings());
+            uses_descriptor_buffer = true;
+        }
+    }
+    auto func{[this, shader_notify, &render_pass_cache, &descriptor_pool, pipeline_statistics,
+                worker_thread] {
         DescriptorLayoutBuilder builder{MakeBuilder(device, stage_infos)};
-        uses_push_descriptor = builder.CanUsePushDescriptor();
-        descriptor_set_layout = builder.CreateDescriptorSetLayout(uses_push_descriptor);
+        if (!uses_descriptor_buffer) {
+            uses_push_descriptor = builder.CanUsePushDescriptor();
+            descriptor_set_layout = builder.CreateDescriptorSetLayout(uses_push_descriptor);
 
-        if (!uses_push_descriptor) {
-            descriptor_allocator = descriptor_pool.Allocator(*descriptor_set_layout, stage_infos);
+            if (!uses_push_descriptor) {
+                descriptor_allocator =
+                    descriptor_pool.Allocator(*descriptor_set_layout, stage_infos);
+            }
         }
 
         const VkDescriptorSetLayout set_layout{*descriptor_set_layout};
         pipeline_layout = builder.CreatePipelineLayout(set_layout);
-        descriptor_update_template =
-            builder.CreateTemplate(set_layout, *pipeline_layout, uses_push_descriptor);
+        layout_hash =
+            PipelineLayoutHash(builder.Bindings(), uses_push_descriptor, uses_descriptor_buffer);
+        if (!uses_descriptor_buffer) {
+            descriptor_update_template =
+                builder.CreateTemplate(set_layout, *pipeline_layout, uses_push_descriptor);
+        }
 
         const VkRenderPass render_pass{render_pass_cache.Get(MakeRenderPassKey(key.state))};
         Validate();
-        MakePipeline(render_pass);
+        // Pipelines built on the calling thread are not waited on by a draw, so they can be
+        // linked with full optimizations straight away.
+        MakePipeline(render_pass, worker_thread != nullptr);
+        if (uses_pipeline_library && worker_thread) {
+            worker_thread->QueueWork([this] { OptimizePipeline(); });
+        }
         if (pipeline_statistics) {
             pipeline_statistics->Collect(*pipeline);
         }
@@ -457,6 +489,8 @@ bool GraphicsPipeline::ConfigureImpl(bool is_indexed) {
         bind_stage_info(4);
     }
 
+    // Small uploads of the draw are recorded together, right before the draw
+    buffer_cache.runtime.BeginUploadBatch();
     buffer_cache.UpdateGraphicsBuffers(is_indexed);
     buffer_cache.BindHostGeometryBuffers(is_indexed);
 
@@ -494,14 +528,27 @@ bool GraphicsPipeline::ConfigureImpl(bool is_indexed) {
     }
     texture_cache.UpdateRenderTargets(false);
     texture_cache.CheckFeedbackLoop(views);
-    ConfigureDraw(rescaling, render_area);
+    buffer_cache.runtime.EndUploadBatch();
+    ConfigureDraw(rescaling, render_area, is_indexed);
 
     return true;
 }
 
 void GraphicsPipeline::ConfigureDraw(const RescalingPushConstant& rescaling,
-                                     const RenderAreaPushConstant& render_area) {
+                                     const RenderAreaPushConstant& render_area, bool is_indexed) {
+    const DescriptorUpdateEntry* const descriptor_data{guest_descriptor_queue.UpdateData()};
+    DescriptorBufferRing::Allocation buffer_set{};
+    if (uses_descriptor_buffer) {
+        buffer_set = WriteDescriptorBuffer(descriptor_data);
+    }
     scheduler.RequestRenderpass(texture_cache.GetFramebuffer());
+    if (scheduler.ConsumeLostBindings()) {
+        // Changing the renderpass ended the secondary the geometry of this draw was bound in
+        buffer_cache.BindHostGeometryBuffers(is_indexed);
+    }
+    // Ending a secondary invalidates the bound descriptor buffer too
+    const bool bind_descriptor_buffer{uses_descriptor_buffer &&
+                                      scheduler.UpdateDescriptorBuffer(buffer_set.buffer)};
     if (!is_built.load(std::memory_order::relaxed)) {
         // Wait for the pipeline to be built
         scheduler.Record([this](vk::CommandBuffer) {
@@ -511,14 +558,20 @@ void GraphicsPipeline::ConfigureDraw(const RescalingPushConstant& rescaling,
     }
     const bool is_rescaling{texture_cache.IsRescaling()};
     const bool update_rescaling{scheduler.UpdateRescaling(is_rescaling)};
-    const bool bind_pipeline{scheduler.UpdateGraphicsPipeline(this)};
-    const void* const descriptor_data{guest_descriptor_queue.UpdateData()};
-    scheduler.Record([this, descriptor_data, bind_pipeline, rescaling_data = rescaling.Data(),
-                      is_rescaling, update_rescaling,
+    bool bind_pipeline{scheduler.UpdateGraphicsPipeline(this)};
+    if (uses_pipeline_library && needs_rebind.load(std::memory_order::relaxed)) {
+        // The optimized pipeline has replaced the fast-linked one since this was last bound
+        needs_rebind.store(false, std::memory_order::relaxed);
+        bind_pipeline = true;
+    }
+    scheduler.Record([this, descriptor_data, buffer_set, bind_descriptor_buffer,
+                      bind_pipeline, rescaling_data = rescaling.Data(), is_rescaling,
+                      update_rescaling,
                       uses_render_area = render_area.uses_render_area,
                       render_area_data = render_area.words](vk::CommandBuffer cmdbuf) {
         if (bind_pipeline) {
-            cmdbuf.BindPipeline(VK_PIPELINE_BIND_POINT_GRAPHICS, *pipeline);
+            cmdbuf.BindPipeline(VK_PIPELINE_BIND_POINT_GRAPHICS,
+                                bound_pipeline.load(std::memory_order::acquire));
         }
         cmdbuf.PushConstants(*pipeline_layout, VK_SHADER_STAGE_ALL_GRAPHICS,
                              RESCALING_LAYOUT_WORDS_OFFSET, sizeof(rescaling_data),
@@ -538,7 +591,22 @@ void GraphicsPipeline::ConfigureDraw(const RescalingPushConstant& rescaling,
         if (!descriptor_set_layout) {
             return;
         }
-        if (uses_push_descriptor) {
+        if (uses_descriptor_buffer) {
+            if (bind_descriptor_buffer) {
+                const VkDescriptorBufferBindingInfoEXT binding_info{
+                    .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_BUFFER_BINDING_INFO_EXT,
+                    .pNext = nullptr,
+                    .address = buffer_set.address,
+                    .usage = VK_BUFFER_USAGE_RESOURCE_DESCRIPTOR_BUFFER_BIT_EXT |
+                             VK_BUFFER_USAGE_SAMPLER_DESCRIPTOR_BUFFER_BIT_EXT,
+                };
+                cmdbuf.BindDescriptorBuffersEXT(binding_info);
+            }
+            const u32 buffer_index{0};
+            cmdbuf.SetDescriptorBufferOffsetsEXT(VK_PIPELINE_BIND_POINT_GRAPHICS,
+                                                 *pipeline_layout, 0, buffer_index,
+                                                 buffer_set.offset);
+        } else if (uses_push_descriptor) {
             cmdbuf.PushDescriptorSetWithTemplateKHR(*descriptor_update_template, *pipeline_layout,
                                                     0, descriptor_data);
         } else {
@@ -551,7 +619,22 @@ void GraphicsPipeline::ConfigureDraw(const RescalingPushConstant& rescaling,
     });
 }
 
-void GraphicsPipeline::MakePipeline(VkRenderPass render_pass) {
+DescriptorBufferRing::Allocation GraphicsPipeline::WriteDescriptorBuffer(
+    const DescriptorUpdateEntry* descriptors) {
+    const size_t num_entries{descriptor_buffer_layout.NumEntries()};
+    if (!last_descriptors.empty() &&
+        descriptor_buffer_layout.Equal(descriptors, last_descriptors.data()) &&
+        descriptor_buffer_ring.Reuse(last_descriptor_set)) {
+        return last_descriptor_set;
+    }
+    last_descriptor_set = descriptor_buffer_ring.Allocate(descriptor_buffer_layout.Size());
+    descriptor_buffer_layout.Write(descriptors, last_descriptor_set.mapped,
+                                   descriptor_buffer_ring.AddressCache());
+    last_descriptors.assign(descriptors, descriptors + num_entries);
+    return last_descriptor_set;
+}
+
+void GraphicsPipeline::MakePipeline(VkRenderPass render_pass, bool fast_link) {
     FixedPipelineState::DynamicState dynamic{};
     if (!key.state.extended_dynamic_state) {
         dynamic = key.state.dynamic_state;
@@ -904,32 +987,152 @@ void GraphicsPipeline::MakePipeline(VkRenderPass render_pass) {
     if (device.IsKhrPipelineExecutablePropertiesEnabled() && Settings::values.renderer_debug.GetValue()) {
         flags |= VK_PIPELINE_CREATE_CAPTURE_STATISTICS_BIT_KHR;
     }
+    if (uses_descriptor_buffer) {
+        flags |= VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT;
+    }
+    create_flags = flags;
+
+    const VkGraphicsPipelineCreateInfo pipeline_ci{
+        .sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO,
+        .pNext = nullptr,
+        .flags = flags,
+        .stageCount = static_cast<u32>(shader_stages.size()),
+        .pStages = shader_stages.data(),
+        .pVertexInputState = &vertex_input_ci,
+        .pInputAssemblyState = &input_assembly_ci,
+        .pTessellationState = &tessellation_ci,
+        .pViewportState = &viewport_ci,
+        .pRasterizationState = &rasterization_ci,
+        .pMultisampleState = &multisample_ci,
+        .pDepthStencilState = &depth_stencil_ci,
+        .pColorBlendState = &color_blend_ci,
+        .pDynamicState = &dynamic_state_ci,
+        .layout = *pipeline_layout,
+        .renderPass = render_pass,
+        .subpass = 0,
+        .basePipelineHandle = nullptr,
+        .basePipelineIndex = 0,
+    };
+    if (uses_pipeline_library) {
+        MakeLibraries(pipeline_ci);
+        pipeline = LinkLibraries(
+            fast_link ? flags : flags | VK_PIPELINE_CREATE_LINK_TIME_OPTIMIZATION_BIT_EXT);
+    } else {
+        pipeline = device.GetLogical().CreateGraphicsPipeline(pipeline_ci, *pipeline_cache);
+    }
+    bound_pipeline.store(*pipeline, std::memory_order::release);
+}
+
+void GraphicsPipeline::MakeLibraries(const VkGraphicsPipelineCreateInfo& ci) {
+    static_vector<VkPipelineShaderStageCreateInfo, 4> pre_rasterization_stages;
+    static_vector<VkPipelineShaderStageCreateInfo, 1> fragment_stages;
+    static_vector<u64, 4> pre_rasterization_hashes;
+    static_vector<u64, 1> fragment_hashes;
+    for (const VkPipelineShaderStageCreateInfo& stage : std::span(ci.pStages, ci.stageCount)) {
+        const auto is_stage_module{
+            [&stage](const vk::ShaderModule& spv_module) { return *spv_module == stage.module; }};
+        const auto it{std::ranges::find_if(spv_modules, is_stage_module)};
+        const u64 hash{spv_hashes[std::distance(spv_modules.begin(), it)]};
+        if (stage.stage == VK_SHADER_STAGE_FRAGMENT_BIT) {
+            fragment_stages.push_back(stage);
+            fragment_hashes.push_back(hash);
+        } else {
+            pre_rasterization_stages.push_back(stage);
+            pre_rasterization_hashes.push_back(hash);
+        }
+    }
+    // Fragment state must be left out when rasterization is statically discarded
+    const std::span dynamic_states(ci.pDynamicState->pDynamicStates,
+                                   ci.pDynamicState->dynamicStateCount);
+    const bool has_fragment_state =
+        ci.pRasterizationState->rasterizerDiscardEnable == VK_FALSE ||
+        std::ranges::find(dynamic_states, VK_DYNAMIC_STATE_RASTERIZER_DISCARD_ENABLE_EXT) !=
+            dynamic_states.end();
+
+    const auto make_library{[&](VkGraphicsPipelineLibraryFlagsEXT subsets,
+                                std::span<const u64> stage_hashes,
+                                VkGraphicsPipelineCreateInfo library_ci) {
+        const VkGraphicsPipelineLibraryCreateInfoEXT library_info{
+            .sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_LIBRARY_CREATE_INFO_EXT,
+            .pNext = nullptr,
+            .flags = subsets,
+        };
+        library_ci.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+        library_ci.pNext = &library_info;
+        library_ci.flags = ci.flags | VK_PIPELINE_CREATE_LIBRARY_BIT_KHR |
+                           VK_PIPELINE_CREATE_RETAIN_LINK_TIME_OPTIMIZATION_INFO_BIT_EXT;
+        library_ci.pDynamicState = ci.pDynamicState;
+        const u64 hash{PipelineLibraryHash(subsets, library_ci, stage_hashes, layout_hash)};
+        libraries.push_back(library_cache.Get(hash, library_ci));
+    }};
+    libraries.clear();
+    make_library(VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT, {},
+                 {
+                     .pVertexInputState = ci.pVertexInputState,
+                     .pInputAssemblyState = ci.pInputAssemblyState,
+                 });
+    make_library(VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT,
+                 std::span(pre_rasterization_hashes.data(), pre_rasterization_hashes.size()),
+                 {
+                     .stageCount = static_cast<u32>(pre_rasterization_stages.size()),
+                     .pStages = pre_rasterization_stages.data(),
+                     .pTessellationState = ci.pTessellationState,
+                     .pViewportState = ci.pViewportState,
+                     .pRasterizationState = ci.pRasterizationState,
+                     .layout = ci.layout,
+                     .renderPass = ci.renderPass,
+                     .subpass = ci.subpass,
+                 });
+    if (!has_fragment_state) {
+        return;
+    }
+    make_library(VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT,
+                 std::span(fragment_hashes.data(), fragment_hashes.size()),
+                 {
+                     .stageCount = static_cast<u32>(fragment_stages.size()),
+                     .pStages = fragment_stages.data(),
+                     .pMultisampleState = ci.pMultisampleState,
+                     .pDepthStencilState = ci.pDepthStencilState,
+                     .layout = ci.layout,
+                     .renderPass = ci.renderPass,
+                     .subpass = ci.subpass,
+                 });
+    make_library(VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT, {},
+                 {
+                     .pMultisampleState = ci.pMultisampleState,
+                     .pColorBlendState = ci.pColorBlendState,
+                     .renderPass = ci.renderPass,
+                     .subpass = ci.subpass,
+                 });
+}
 
-    pipeline = device.GetLogical().CreateGraphicsPipeline(
+vk::Pipeline GraphicsPipeline::LinkLibraries(VkPipelineCreateFlags flags) const {
+    const VkPipelineLibraryCreateInfoKHR library_ci{
+        .sType = VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR,
+        .pNext = nullptr,
+        .libraryCount = static_cast<u32>(libraries.size()),
+        .pLibraries = libraries.data(),
+    };
+    return device.GetLogical().CreateGraphicsPipeline(
         {
             .sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO,
-            .pNext = nullptr,
+            .pNext = &library_ci,
             .flags = flags,
-            .stageCount = static_cast<u32>(shader_stages.size()),
-            .pStages = shader_stages.data(),
-            .pVertexInputState = &vertex_input_ci,
-            .pInputAssemblyState = &input_assembly_ci,
-            .pTessellationState = &tessellation_ci,
-            .pViewportState = &viewport_ci,
-            .pRasterizationState = &rasterization_ci,
-            .pMultisampleState = &multisample_ci,
-            .pDepthStencilState = &depth_stencil_ci,
-            .pColorBlendState = &color_blend_ci,
-            .pDynamicState = &dynamic_state_ci,
             .layout = *pipeline_layout,
-            .renderPass = render_pass,
-            .subpass = 0,
-            .basePipelineHandle = nullptr,
-            .basePipelineIndex = 0,
         },
         *pipeline_cache);
 }
 
+void GraphicsPipeline::OptimizePipeline() {
+    // Linking through the driver pipeline cache records the optimized pipeline in the disk cache,
+    // so the next boot links it with optimizations while loading instead of fast-linking it.
+    optimized_pipeline =
+        LinkLibraries(create_flags | VK_PIPELINE_CREATE_LINK_TIME_OPTIMIZATION_BIT_EXT);
+    // The fast-linked pipeline is kept alive, as recorded command buffers may still use it
+    bound_pipeline.store(*optimized_pipeline, std::memory_order::release);
+    needs_rebind.store(true, std::memory_order::release);
+}
+
 void GraphicsPipeline::Validate() {
     size_t num_images{};
     for (const auto& info : stage_infos) {
@@ -12,13 +12,16 @@
 #include <condition_variable>
 #include <mutex>
 #include <type_traits>
+#include <vector>
 
 #include "common/thread_worker.h"
 #include "shader_recompiler/shader_info.h"
 #include "video_core/engines/maxwell_3d.h"
 #include "video_core/renderer_vulkan/fixed_pipeline_state.h"
 #include "video_core/renderer_vulkan/vk_buffer_cache.h"
+#include "video_core/renderer_vulkan/vk_descriptor_buffer.h"
 #include "video_core/renderer_vulkan/vk_descriptor_pool.h"
+#include "video_core/renderer_vulkan/vk_pipeline_library_cache.h"
 #include "video_core/renderer_vulkan/vk_texture_cache.h"
 #include "video_core/vulkan_common/vulkan_wrapper.h"
 
@@ -74,11 +77,14 @@ class GraphicsPipeline {
 public:
     explicit GraphicsPipeline(
         Scheduler& scheduler, BufferCache& buffer_cache, TextureCache& texture_cache,
-        vk::PipelineCache& pipeline_cache, VideoCore::ShaderNotify* shader_notify,
-        const Device& device, DescriptorPool& descriptor_pool,
-        GuestDescriptorQueue& guest_descriptor_queue, Common::ThreadWorker* worker_thread,
-        PipelineStatistics* pipeline_statistics, RenderPassCache& render_pass_cache,
-        const GraphicsPipelineCacheKey& key, std::array<vk::ShaderModule, NUM_STAGES> stages,
+        vk::PipelineCache& pipeline_cache, PipelineLibraryCache& library_cache,
+        VideoCore::ShaderNotify* shader_notify, const Device& device,
+        DescriptorPool& descriptor_pool,
+        DescriptorBufferRing& descriptor_buffer_ring, GuestDescriptorQueue& guest_descriptor_queue,
+        Common::ThreadWorker* worker_thread, PipelineStatistics* pipeline_statistics,
+        RenderPassCache& render_pass_cache, const GraphicsPipelineCacheKey& key,
+        std::array<vk::ShaderModule, NUM_STAGES> stages,
+        const std::array<u64, NUM_STAGES>& module_hashes,
         const std::array<const Shader::Info*, NUM_STAGES>& infos);
     // True if this pipeline was created with VK_DYNAMIC_STATE_VERTEX_INPUT_EXT
     bool HasDynamicVertexInput() const noexcept { return key.state.dynamic_vertex_input; }
@@ -122,9 +128,24 @@ private:
     bool ConfigureImpl(bool is_indexed);
 
     void ConfigureDraw(const RescalingPushConstant& rescaling,
-                       const RenderAreaPushConstant& render_are);
+                       const RenderAreaPushConstant& render_are, bool is_indexed);
 
-    void MakePipeline(VkRenderPass render_pass);
+    /// Writes the descriptors of the current draw into the descriptor buffer ring, reusing the
+    /// previous set when none of them changed.
+    [[nodiscard]] DescriptorBufferRing::Allocation WriteDescriptorBuffer(
+        const DescriptorUpdateEntry* descriptors);
+
+    void MakePipeline(VkRenderPass render_pass, bool fast_link);
+
+    /// Splits the pipeline into vertex input, pre-rasterization, fragment shader and fragment
+    /// output libraries that can be compiled independently and linked together. Libraries with
+    /// the same state are shared with other pipelines through the library cache.
+    void MakeLibraries(const VkGraphicsPipelineCreateInfo& ci);
+
+    [[nodiscard]] vk::Pipeline LinkLibraries(VkPipelineCreateFlags flags) const;
+
+    /// Replaces the fast-linked pipeline with a link time optimized one.
+    void OptimizePipeline();
 
     void Validate();
 
@@ -135,7 +156,9 @@ private:
     TextureCache& texture_cache;
     BufferCache& buffer_cache;
     vk::PipelineCache& pipeline_cache;
+    PipelineLibraryCache& library_cache;
     Scheduler& scheduler;
+    DescriptorBufferRing& descriptor_buffer_ring;
     GuestDescriptorQueue& guest_descriptor_queue;
 
     bool (*configure_func)(GraphicsPipeline*, bool){};
@@ -144,6 +167,7 @@ private:
     std::vector<GraphicsPipeline*> transitions;
 
     std::array<vk::ShaderModule, NUM_STAGES> spv_modules;
+    std::array<u64, NUM_STAGES> spv_hashes{};
 
     std::array<Shader::Info, NUM_STAGES> stage_infos;
     std::array<u32, 5> enabled_uniform_buffer_masks{};
@@ -156,10 +180,23 @@ private:
     vk::DescriptorUpdateTemplate descriptor_update_template;
     vk::Pipeline pipeline;
 
+    DescriptorBufferLayout descriptor_buffer_layout;
+    DescriptorBufferRing::Allocation last_descriptor_set{};
+    std::vector<DescriptorUpdateEntry> last_descriptors;
+
+    u64 layout_hash{};
+    std::vector<VkPipeline> libraries; ///< Owned by the library cache
+    vk::Pipeline optimized_pipeline;
+    VkPipelineCreateFlags create_flags{};
+    std::atomic<VkPipeline> bound_pipeline{};
+    std::atomic_bool needs_rebind{false};
+
     std::condition_variable build_condvar;
     std::mutex build_mutex;
     std::atomic_bool is_built{false};
     bool uses_push_descriptor{false};
+    bool uses_descriptor_buffer{false};
+    bool uses_pipeline_library{false};
 };
 
 } // namespace Vulkan
@@ -6,6 +6,7 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <exception>
 #include <fstream>
 #include <iostream>
 #include <memory>
@@ -16,6 +17,7 @@
 #include "common/cityhash.h"
 #include "common/fs/fs.h"
 #include "common/fs/path_util.h"
+#include "common/subsystem_profiler.h"
 #include "common/thread_worker.h"
 #include "core/core.h"
 #include "shader_recompiler/backend/spirv/emit_spirv.h"
@@ -303,19 +305,25 @@ bool GraphicsPipelineCacheKey::operator==(const GraphicsPipelineCacheKey& rhs) c
 PipelineCache::PipelineCache(Tegra::MaxwellDeviceMemoryManager& device_memory_,
                              const Device& device_, Scheduler& scheduler_,
                              DescriptorPool& descriptor_pool_,
+                             DescriptorBufferRing& descriptor_buffer_ring_,
                              GuestDescriptorQueue& guest_descriptor_queue_,
                              RenderPassCache& render_pass_cache_, BufferCache& buffer_cache_,
                              TextureCache& texture_cache_, VideoCore::ShaderNotify& shader_notify_)
     : VideoCommon::ShaderCache{device_memory_}, device{device_}, scheduler{scheduler_},
-      descriptor_pool{descriptor_pool_}, guest_descriptor_queue{guest_descriptor_queue_},
+      descriptor_pool{descriptor_pool_}, descriptor_buffer_ring{descriptor_buffer_ring_},
+      guest_descriptor_queue{guest_descriptor_queue_},
       render_pass_cache{render_pass_cache_}, buffer_cache{buffer_cache_},
       texture_cache{texture_cache_}, shader_notify{shader_notify_},
       use_asynchronous_shaders{Settings::values.use_asynchronous_shaders.GetValue()},
       use_vulkan_pipeline_cache{Settings::values.use_vulkan_driver_pipeline_cache.GetValue()},
       optimize_spirv_output{Settings::values.optimize_spirv_output.GetValue() != Settings::SpirvOptimizeMode::Never},
+      library_cache{device, vulkan_pipeline_cache},
       workers(device.HasBrokenParallelShaderCompiling() ? 1ULL : GetTotalPipelineWorkers(),
               "VkPipelineBuilder"),
-      serialization_thread(1, "VkPipelineSerialization") {
+      serialization_thread(1, "VkPipelineSerialization"),
+      use_parallel_stages{!device.HasBrokenParallelShaderCompiling() &&
+                          GetTotalPipelineWorkers() > 1},
+      stage_workers(use_parallel_stages ? Maxwell::MaxShaderStage : 1ULL, "VkStageBuilder") {
     const auto& float_control{device.FloatControlProperties()};
     const VkDriverId driver_id{device.GetDriverID()};
     profile = Shader::Profile{
@@ -366,6 +374,7 @@ PipelineCache::PipelineCache(Tegra::MaxwellDeviceMemoryManager& device_memory_,
                                        driver_id == VK_DRIVER_ID_MESA_RADV ||
                                        driver_id == VK_DRIVER_ID_INTEL_PROPRIETARY_WINDOWS ||
                                        driver_id == VK_DRIVER_ID_INTEL_OPEN_SOURCE_MESA,
+        .optimize_redundant_instructions = Settings::values.optimize_shader_ir.GetValue(),
 
         .has_broken_spirv_clamp = driver_id == VK_DRIVER_ID_INTEL_PROPRIETARY_WINDOWS,
         .has_broken_spirv_position_input = driver_id == VK_DRIVER_ID_QUALCOMM_PROPRIETARY,
@@ -622,12 +631,61 @@ std::unique_ptr<GraphicsPipeline> PipelineCache::CreateGraphicsPipeline(
     ShaderPools& pools, const GraphicsPipelineCacheKey& key,
     std::span<Shader::Environment* const> envs, PipelineStatistics* statistics,
     bool build_in_parallel) try {
+    const Shader::ArenaScope arena_scope{pools.arena};
+    const Common::ScopedSubsystemTimer timer{Common::Subsystem::ShaderCompile};
     auto hash = key.Hash();
     LOG_INFO(Render_Vulkan, "0x{:016x}", hash);
-    size_t env_index{0};
     std::array<Shader::IR::Program, Maxwell::MaxShaderProgram> programs;
+    std::array<Shader::Environment*, Maxwell::MaxShaderProgram> stage_envs{};
     const bool uses_vertex_a{key.unique_hashes[0] != 0};
     const bool uses_vertex_b{key.unique_hashes[1] != 0};
+    for (size_t index = 0, env_index = 0; index < Maxwell::MaxShaderProgram; ++index) {
+        if (key.unique_hashes[index] != 0) {
+            stage_envs[index] = envs[env_index++];
+        }
+    }
+    // Pipelines built on the calling thread are the ones a draw is waiting for. Their stages are
+    // translated and emitted concurrently, each stage using its own pools.
+    const bool parallel_stages{build_in_parallel && use_parallel_stages};
+    const auto run_stages{[&](const auto& indices, auto&& func) {
+        if (!parallel_stages) {
+            for (const size_t index : indices) {
+                func(index, pools);
+            }
+            return;
+        }
+        std::array<std::exception_ptr, Maxwell::MaxShaderProgram> exceptions;
+        for (const size_t index : indices) {
+            stage_workers.QueueWork([&, index] {
+                ShaderPools& local_pools{stage_pools[index]};
+                const Shader::ArenaScope local_arena_scope{local_pools.arena};
+                try {
+                    func(index, local_pools);
+                } catch (...) {
+                    exceptions[index] = std::current_exception();
+                }
+            });
+        }
+        stage_workers.WaitForRequests();
+        for (const std::exception_ptr& exception : exceptions) {
+            if (exception) {
+                std::rethrow_exception(exception);
+            }
+        }
+    }};
+
+    boost::container::static_vector<size_t, Maxwell::MaxShaderProgram> guest_stages;
+    for (size_t index = 0; index < Maxwell::MaxShaderProgram; ++index) {
+        if (stage_envs[index]) {
+            guest_stages.push_back(index);
+        }
+    }
+    run_stages(guest_stages, [&](size_t index, ShaderPools& stage_pool) {
+        Shader::Environment& env{*stage_envs[index]};
+        const u32 cfg_offset{static_cast<u32>(env.StartAddress() + sizeof(Shader::ProgramHeader))};
+        Shader::Maxwell::Flow::CFG cfg(env, stage_pool.flow_block, cfg_offset, index == 0);
+        programs[index] = TranslateProgram(stage_pool.inst, stage_pool.block, env, cfg, host_info);
+    });
 
     // Layer passthrough generation for devices without VK_EXT_shader_viewport_index_layer
     Shader::IR::Program* layer_source_program{};
@@ -644,19 +702,11 @@ std::unique_ptr<GraphicsPipeline> PipelineCache::CreateGraphicsPipeline(
         if (key.unique_hashes[index] == 0) {
             continue;
         }
-        Shader::Environment& env{*envs[env_index]};
-        ++env_index;
-
-        const u32 cfg_offset{static_cast<u32>(env.StartAddress() + sizeof(Shader::ProgramHeader))};
-        Shader::Maxwell::Flow::CFG cfg(env, pools.flow_block, cfg_offset, index == 0);
-        if (!uses_vertex_a || index != 1) {
-            // Normal path
-            programs[index] = TranslateProgram(pools.inst, pools.block, env, cfg, host_info);
-        } else {
+        Shader::Environment& env{*stage_envs[index]};
+        if (uses_vertex_a && index == 1) {
             // VertexB path when VertexA is present.
-            auto& program_va{programs[0]};
-            auto program_vb{TranslateProgram(pools.inst, pools.block, env, cfg, host_info)};
-            programs[index] = MergeDualVertexPrograms(program_va, program_vb, env);
+            auto program_vb{std::move(programs[index])};
+            programs[index] = MergeDualVertexPrograms(programs[0], program_vb, env);
         }
 
         if (Settings::values.dump_shaders) {
@@ -669,7 +719,12 @@ std::unique_ptr<GraphicsPipeline> PipelineCache::CreateGraphicsPipeline(
     }
     std::array<const Shader::Info*, Maxwell::MaxShaderStage> infos{};
     std::array<vk::ShaderModule, Maxwell::MaxShaderStage> modules;
+    std::array<u64, Maxwell::MaxShaderStage> module_hashes{};
+    std::array<Shader::RuntimeInfo, Maxwell::MaxShaderStage> runtime_infos{};
+    std::array<Shader::Backend::Bindings, Maxwell::MaxShaderStage> stage_bindings{};
+    boost::container::static_vector<size_t, Maxwell::MaxShaderProgram> host_stages;
 
+    // Runtime info depends on the neighbouring stages, so it is resolved before emitting
     const Shader::IR::Program* previous_stage{};
     Shader::Backend::Bindings binding;
     for (size_t index = uses_vertex_a && uses_vertex_b ? 1 : 0; index < Maxwell::MaxShaderProgram;
@@ -685,22 +740,33 @@ std::unique_ptr<GraphicsPipeline> PipelineCache::CreateGraphicsPipeline(
         const size_t stage_index{index - 1};
         infos[stage_index] = &program.info;
 
-        const auto runtime_info{MakeRuntimeInfo(programs, key, program, previous_stage)};
-        ConvertLegacyToGeneric(program, runtime_info);
-        const std::vector<u32> code{EmitSPIRV(profile, runtime_info, program, binding, this->optimize_spirv_output)};
+        runtime_infos[stage_index] = MakeRuntimeInfo(programs, key, program, previous_stage);
+        ConvertLegacyToGeneric(program, runtime_infos[stage_index]);
+        stage_bindings[stage_index] = binding;
+        Shader::Backend::SPIRV::AdvanceBindings(profile, program.info, binding);
+        host_stages.push_back(index);
+        previous_stage = &program;
+    }
+    run_stages(host_stages, [&](size_t index, ShaderPools&) {
+        const size_t stage_index{index - 1};
+        const std::vector<u32> code{EmitSPIRV(profile, runtime_infos[stage_index], programs[index],
+                                              stage_bindings[stage_index],
+                                              this->optimize_spirv_output)};
         device.SaveShader(code);
         modules[stage_index] = BuildShader(device, code);
+        module_hashes[stage_index] = Common::CityHash64(
+            reinterpret_cast<const char*>(code.data()), code.size() * sizeof(u32));
         if (device.HasDebuggingToolAttached()) {
             const std::string name{fmt::format("Shader {:016x}", key.unique_hashes[index])};
             modules[stage_index].SetObjectNameEXT(name.c_str());
         }
-        previous_stage = &program;
-    }
+    });
     Common::ThreadWorker* const thread_worker{build_in_parallel ? &workers : nullptr};
     return std::make_unique<GraphicsPipeline>(
-        scheduler, buffer_cache, texture_cache, vulkan_pipeline_cache, &shader_notify, device,
-        descriptor_pool, guest_descriptor_queue, thread_worker, statistics, render_pass_cache, key,
-        std::move(modules), infos);
+        scheduler, buffer_cache, texture_cache, vulkan_pipeline_cache, library_cache,
+        &shader_notify, device, descriptor_pool, descriptor_buffer_ring, guest_descriptor_queue,
+        thread_worker, statistics, render_pass_cache, key, std::move(modules), module_hashes,
+        infos);
 
 } catch (const Shader::Exception& exception) {
     auto hash = key.Hash();
@@ -725,6 +791,11 @@ std::unique_ptr<GraphicsPipeline> PipelineCache::CreateGraphicsPipeline() {
     GetGraphicsEnvironments(environments, graphics_key.unique_hashes);
 
     main_pools.ReleaseContents();
+    if (use_parallel_stages) {
+        for (ShaderPools& stage_pool : stage_pools) {
+            stage_pool.ReleaseContents();
+        }
+    }
     auto pipeline{
         CreateGraphicsPipeline(main_pools, graphics_key, environments.Span(), nullptr, true)};
     if (!pipeline || pipeline_cache_filename.empty()) {
@@ -765,6 +836,8 @@ std::unique_ptr<ComputePipeline> PipelineCache::CreateComputePipeline(
 std::unique_ptr<ComputePipeline> PipelineCache::CreateComputePipeline(
     ShaderPools& pools, const ComputePipelineCacheKey& key, Shader::Environment& env,
     PipelineStatistics* statistics, bool build_in_parallel) try {
+    const Shader::ArenaScope arena_scope{pools.arena};
+    const Common::ScopedSubsystemTimer timer{Common::Subsystem::ShaderCompile};
     auto hash = key.Hash();
     if (device.HasBrokenCompute()) {
         LOG_ERROR(Render_Vulkan, "Skipping 0x{:016x}", hash);
@@ -13,6 +13,7 @@
 
 #include "common/common_types.h"
 #include "common/thread_worker.h"
+#include "shader_recompiler/arena.h"
 #include "shader_recompiler/frontend/ir/basic_block.h"
 #include "shader_recompiler/frontend/ir/value.h"
 #include "shader_recompiler/frontend/maxwell/control_flow.h"
@@ -25,6 +26,7 @@
 #include "video_core/renderer_vulkan/vk_buffer_cache.h"
 #include "video_core/renderer_vulkan/vk_compute_pipeline.h"
 #include "video_core/renderer_vulkan/vk_graphics_pipeline.h"
+#include "video_core/renderer_vulkan/vk_pipeline_library_cache.h"
 #include "video_core/renderer_vulkan/vk_texture_cache.h"
 #include "video_core/shader_cache.h"
 
@@ -90,17 +92,20 @@ struct ShaderPools {
         flow_block.ReleaseContents();
         block.ReleaseContents();
         inst.ReleaseContents();
+        arena.Release();
     }
 
     Shader::ObjectPool<Shader::IR::Inst> inst{8192};
     Shader::ObjectPool<Shader::IR::Block> block{32};
     Shader::ObjectPool<Shader::Maxwell::Flow::Block> flow_block{32};
+    Shader::Arena arena;
 };
 
 class PipelineCache : public VideoCommon::ShaderCache {
 public:
     explicit PipelineCache(Tegra::MaxwellDeviceMemoryManager& device_memory_, const Device& device,
                            Scheduler& scheduler, DescriptorPool& descriptor_pool,
+                           DescriptorBufferRing& descriptor_buffer_ring,
                            GuestDescriptorQueue& guest_descriptor_queue,
                            RenderPassCache& render_pass_cache, BufferCache& buffer_cache,
                            TextureCache& texture_cache, VideoCore::ShaderNotify& shader_notify_);
@@ -143,6 +148,7 @@ private:
     const Device& device;
     Scheduler& scheduler;
     DescriptorPool& descriptor_pool;
+    DescriptorBufferRing& descriptor_buffer_ring;
     GuestDescriptorQueue& guest_descriptor_queue;
     RenderPassCache& render_pass_cache;
     BufferCache& buffer_cache;
@@ -168,8 +174,17 @@ private:
     std::filesystem::path vulkan_pipeline_cache_filename;
     vk::PipelineCache vulkan_pipeline_cache;
 
+    /// Graphics pipeline libraries shared between pipelines, outlived by the pipelines using them
+    PipelineLibraryCache library_cache;
+
     Common::ThreadWorker workers;
     Common::ThreadWorker serialization_thread;
+
+    /// Pools and threads used to translate the stages of a synchronously built pipeline
+    bool use_parallel_stages{};
+    Common::ThreadWorker stage_workers;
+    std::array<ShaderPools, Maxwell::MaxShaderProgram> stage_pools;
+
     DynamicFeatures dynamic_features;
 };
 
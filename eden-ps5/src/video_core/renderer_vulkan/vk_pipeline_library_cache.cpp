@@ -0,0 +1,294 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+#include <boost/container/small_vector.hpp>
+
+#include "common/assert.h"
+#include "common/bit_cast.h"
+#include "common/cityhash.h"
+#include "video_core/renderer_vulkan/vk_pipeline_library_cache.h"
+#include "video_core/vulkan_common/vulkan_device.h"
+#include "video_core/vulkan_common/vulkan_wrapper.h"
+
+namespace Vulkan {
+namespace {
+
+/// Serializes pipeline state field by field, so padding and pointers never reach the hash.
+class StateWriter {
+public:
+    template <typename T>
+        requires std::is_integral_v<T> || std::is_enum_v<T>
+    void Write(T value) {
+        words.push_back(static_cast<u64>(value));
+    }
+
+    void Write(f32 value) {
+        words.push_back(Common::BitCast<u32>(value));
+    }
+
+    template <typename T>
+    void WriteHandle(T handle) {
+        words.push_back(static_cast<u64>(std::hash<T>{}(handle)));
+    }
+
+    [[nodiscard]] u64 Hash() const {
+        return Common::CityHash64(reinterpret_cast<const char*>(words.data()),
+                                  words.size() * sizeof(u64));
+    }
+
+private:
+    boost::container::small_vector<u64, 256> words;
+};
+
+void WriteStencilFace(StateWriter& writer, const VkStencilOpState& face) {
+    writer.Write(face.failOp);
+    writer.Write(face.passOp);
+    writer.Write(face.depthFailOp);
+    writer.Write(face.compareOp);
+    writer.Write(face.compareMask);
+    writer.Write(face.writeMask);
+    writer.Write(face.reference);
+}
+
+/// Writes the extension structures chained to a state, only the ones the pipelines use are known.
+void WriteChain(StateWriter& writer, const void* next) {
+    for (; next != nullptr; next = static_cast<const VkBaseInStructure*>(next)->pNext) {
+        const VkStructureType type{static_cast<const VkBaseInStructure*>(next)->sType};
+        writer.Write(type);
+        switch (type) {
+        case VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_DIVISOR_STATE_CREATE_INFO_EXT: {
+            const auto& info{
+                *static_cast<const VkPipelineVertexInputDivisorStateCreateInfoEXT*>(next)};
+            writer.Write(info.vertexBindingDivisorCount);
+            for (const auto& divisor :
+                 std::span(info.pVertexBindingDivisors, info.vertexBindingDivisorCount)) {
+                writer.Write(divisor.binding);
+                writer.Write(divisor.divisor);
+            }
+            break;
+        }
+        case VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_SWIZZLE_STATE_CREATE_INFO_NV: {
+            const auto& info{*static_cast<const VkPipelineViewportSwizzleStateCreateInfoNV*>(next)};
+            writer.Write(info.viewportCount);
+            for (const auto& swizzle : std::span(info.pViewportSwizzles, info.viewportCount)) {
+                writer.Write(swizzle.x);
+                writer.Write(swizzle.y);
+                writer.Write(swizzle.z);
+                writer.Write(swizzle.w);
+            }
+            break;
+        }
+        case VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_DEPTH_CLIP_CONTROL_CREATE_INFO_EXT:
+            writer.Write(static_cast<const VkPipelineViewportDepthClipControlCreateInfoEXT*>(next)
+                             ->negativeOneToOne);
+            break;
+        case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_LINE_STATE_CREATE_INFO_EXT: {
+            const auto& info{
+                *static_cast<const VkPipelineRasterizationLineStateCreateInfoEXT*>(next)};
+            writer.Write(info.lineRasterizationMode);
+            writer.Write(info.stippledLineEnable);
+            writer.Write(info.lineStippleFactor);
+            writer.Write(info.lineStipplePattern);
+            break;
+        }
+        case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_CONSERVATIVE_STATE_CREATE_INFO_EXT: {
+            const auto& info{
+                *static_cast<const VkPipelineRasterizationConservativeStateCreateInfoEXT*>(next)};
+            writer.Write(info.conservativeRasterizationMode);
+            writer.Write(info.extraPrimitiveOverestimationSize);
+            break;
+        }
+        case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_PROVOKING_VERTEX_STATE_CREATE_INFO_EXT:
+            writer.Write(
+                static_cast<const VkPipelineRasterizationProvokingVertexStateCreateInfoEXT*>(next)
+                    ->provokingVertexMode);
+            break;
+        default:
+            UNREACHABLE_MSG("Unknown pipeline state structure {}", static_cast<u32>(type));
+        }
+    }
+}
+
+void WriteVertexInput(StateWriter& writer, const VkPipelineVertexInputStateCreateInfo& info) {
+    writer.Write(info.vertexBindingDescriptionCount);
+    for (const auto& binding :
+         std::span(info.pVertexBindingDescriptions, info.vertexBindingDescriptionCount)) {
+        writer.Write(binding.binding);
+        writer.Write(binding.stride);
+        writer.Write(binding.inputRate);
+    }
+    writer.Write(info.vertexAttributeDescriptionCount);
+    for (const auto& attribute :
+         std::span(info.pVertexAttributeDescriptions, info.vertexAttributeDescriptionCount)) {
+        writer.Write(attribute.location);
+        writer.Write(attribute.binding);
+        writer.Write(attribute.format);
+        writer.Write(attribute.offset);
+    }
+    WriteChain(writer, info.pNext);
+}
+
+void WriteRasterization(StateWriter& writer, const VkPipelineRasterizationStateCreateInfo& info) {
+    writer.Write(info.depthClampEnable);
+    writer.Write(info.rasterizerDiscardEnable);
+    writer.Write(info.polygonMode);
+    writer.Write(info.cullMode);
+    writer.Write(info.frontFace);
+    writer.Write(info.depthBiasEnable);
+    writer.Write(info.depthBiasConstantFactor);
+    writer.Write(info.depthBiasClamp);
+    writer.Write(info.depthBiasSlopeFactor);
+    writer.Write(info.lineWidth);
+    WriteChain(writer, info.pNext);
+}
+
+void WriteMultisample(StateWriter& writer, const VkPipelineMultisampleStateCreateInfo& info) {
+    writer.Write(info.rasterizationSamples);
+    writer.Write(info.sampleShadingEnable);
+    writer.Write(info.minSampleShading);
+    writer.Write(info.pSampleMask != nullptr);
+    if (info.pSampleMask) {
+        const u32 num_words{(static_cast<u32>(info.rasterizationSamples) + 31) / 32};
+        for (const VkSampleMask mask : std::span(info.pSampleMask, num_words)) {
+            writer.Write(mask);
+        }
+    }
+    writer.Write(info.alphaToCoverageEnable);
+    writer.Write(info.alphaToOneEnable);
+    WriteChain(writer, info.pNext);
+}
+
+void WriteDepthStencil(StateWriter& writer, const VkPipelineDepthStencilStateCreateInfo& info) {
+    writer.Write(info.depthTestEnable);
+    writer.Write(info.depthWriteEnable);
+    writer.Write(info.depthCompareOp);
+    writer.Write(info.depthBoundsTestEnable);
+    writer.Write(info.stencilTestEnable);
+    WriteStencilFace(writer, info.front);
+    WriteStencilFace(writer, info.back);
+    writer.Write(info.minDepthBounds);
+    writer.Write(info.maxDepthBounds);
+    WriteChain(writer, info.pNext);
+}
+
+void WriteColorBlend(StateWriter& writer, const VkPipelineColorBlendStateCreateInfo& info) {
+    writer.Write(info.logicOpEnable);
+    writer.Write(info.logicOp);
+    writer.Write(info.attachmentCount);
+    for (const auto& attachment : std::span(info.pAttachments, info.attachmentCount)) {
+        writer.Write(attachment.blendEnable);
+        writer.Write(attachment.srcColorBlendFactor);
+        writer.Write(attachment.dstColorBlendFactor);
+        writer.Write(attachment.colorBlendOp);
+        writer.Write(attachment.srcAlphaBlendFactor);
+        writer.Write(attachment.dstAlphaBlendFactor);
+        writer.Write(attachment.alphaBlendOp);
+        writer.Write(attachment.colorWriteMask);
+    }
+    for (const f32 constant : info.blendConstants) {
+        writer.Write(constant);
+    }
+    WriteChain(writer, info.pNext);
+}
+
+} // Anonymous namespace
+
+u64 PipelineLibraryHash(VkGraphicsPipelineLibraryFlagsEXT subset,
+                        const VkGraphicsPipelineCreateInfo& ci, std::span<const u64> stage_hashes,
+                        u64 layout_hash) {
+    ASSERT(stage_hashes.size() == ci.stageCount);
+    StateWriter writer;
+    writer.Write(subset);
+    writer.Write(ci.flags);
+    writer.Write(ci.stageCount);
+    for (u32 index = 0; index < ci.stageCount; ++index) {
+        writer.Write(ci.pStages[index].stage);
+        writer.Write(stage_hashes[index]);
+    }
+    writer.Write(ci.pVertexInputState != nullptr);
+    if (ci.pVertexInputState) {
+        WriteVertexInput(writer, *ci.pVertexInputState);
+    }
+    writer.Write(ci.pInputAssemblyState != nullptr);
+    if (ci.pInputAssemblyState) {
+        writer.Write(ci.pInputAssemblyState->topology);
+        writer.Write(ci.pInputAssemblyState->primitiveRestartEnable);
+    }
+    writer.Write(ci.pTessellationState != nullptr);
+    if (ci.pTessellationState) {
+        writer.Write(ci.pTessellationState->patchControlPoints);
+    }
+    writer.Write(ci.pViewportState != nullptr);
+    if (ci.pViewportState) {
+        writer.Write(ci.pViewportState->viewportCount);
+        writer.Write(ci.pViewportState->scissorCount);
+        WriteChain(writer, ci.pViewportState->pNext);
+    }
+    writer.Write(ci.pRasterizationState != nullptr);
+    if (ci.pRasterizationState) {
+        WriteRasterization(writer, *ci.pRasterizationState);
+    }
+    writer.Write(ci.pMultisampleState != nullptr);
+    if (ci.pMultisampleState) {
+        WriteMultisample(writer, *ci.pMultisampleState);
+    }
+    writer.Write(ci.pDepthStencilState != nullptr);
+    if (ci.pDepthStencilState) {
+        WriteDepthStencil(writer, *ci.pDepthStencilState);
+    }
+    writer.Write(ci.pColorBlendState != nullptr);
+    if (ci.pColorBlendState) {
+        WriteColorBlend(writer, *ci.pColorBlendState);
+    }
+    writer.Write(ci.pDynamicState != nullptr);
+    if (ci.pDynamicState) {
+        writer.Write(ci.pDynamicState->dynamicStateCount);
+        for (const VkDynamicState state :
+             std::span(ci.pDynamicState->pDynamicStates, ci.pDynamicState->dynamicStateCount)) {
+            writer.Write(state);
+        }
+    }
+    writer.Write(ci.layout ? layout_hash : 0);
+    writer.WriteHandle(ci.renderPass);
+    writer.Write(ci.subpass);
+    return writer.Hash();
+}
+
+u64 PipelineLayoutHash(std::span<const VkDescriptorSetLayoutBinding> bindings,
+                       bool use_push_descriptor, bool use_descriptor_buffer) {
+    StateWriter writer;
+    writer.Write(use_push_descriptor);
+    writer.Write(use_descriptor_buffer);
+    writer.Write(bindings.size());
+    for (const VkDescriptorSetLayoutBinding& binding : bindings) {
+        writer.Write(binding.binding);
+        writer.Write(binding.descriptorType);
+        writer.Write(binding.descriptorCount);
+        writer.Write(binding.stageFlags);
+    }
+    return writer.Hash();
+}
+
+PipelineLibraryCache::PipelineLibraryCache(const Device& device_,
+                                           vk::PipelineCache& pipeline_cache_)
+    : device{device_}, pipeline_cache{pipeline_cache_} {}
+
+VkPipeline PipelineLibraryCache::Get(u64 hash, const VkGraphicsPipelineCreateInfo& ci) {
+    {
+        std::scoped_lock lock{mutex};
+        if (const auto it = cache.find(hash); it != cache.end()) {
+            return *it->second;
+        }
+    }
+    // Libraries are built without holding the lock, so pipeline workers don't wait on each other.
+    // When two of them build the same library, the one built last is dropped.
+    vk::Pipeline library{device.GetLogical().CreateGraphicsPipeline(ci, *pipeline_cache)};
+    std::scoped_lock lock{mutex};
+    return *cache.try_emplace(hash, std::move(library)).first->second;
+}
+
+} // namespace Vulkan
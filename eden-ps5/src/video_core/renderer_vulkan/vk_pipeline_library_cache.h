@@ -0,0 +1,44 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <mutex>
+#include <span>
+#include <unordered_map>
+
+#include "common/common_types.h"
+#include "video_core/vulkan_common/vulkan_wrapper.h"
+
+namespace Vulkan {
+
+class Device;
+
+/// Hashes the state a graphics pipeline library of the given subset is built from.
+/// Shader modules and pipeline layouts are made for each pipeline, so they are identified by the
+/// hashes of their code and of their definition.
+[[nodiscard]] u64 PipelineLibraryHash(VkGraphicsPipelineLibraryFlagsEXT subset,
+                                      const VkGraphicsPipelineCreateInfo& ci,
+                                      std::span<const u64> stage_hashes, u64 layout_hash);
+
+/// Hashes the definition of a graphics pipeline layout made of a single descriptor set.
+[[nodiscard]] u64 PipelineLayoutHash(std::span<const VkDescriptorSetLayoutBinding> bindings,
+                                     bool use_push_descriptor, bool use_descriptor_buffer);
+
+/// Shares the vertex input, pre-rasterization, fragment shader and fragment output libraries
+/// between the graphics pipelines that are built with the same state for that subset.
+class PipelineLibraryCache {
+public:
+    explicit PipelineLibraryCache(const Device& device_, vk::PipelineCache& pipeline_cache_);
+
+    /// Returns the library with the given hash, building it from ci the first time it is used.
+    [[nodiscard]] VkPipeline Get(u64 hash, const VkGraphicsPipelineCreateInfo& ci);
+
+private:
+    const Device& device;
+    vk::PipelineCache& pipeline_cache;
+    std::unordered_map<u64, vk::Pipeline> cache;
+    std::mutex mutex;
+};
+
+} // namespace Vulkan
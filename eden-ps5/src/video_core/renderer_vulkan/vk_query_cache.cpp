@@ -1277,6 +1277,7 @@ void QueryCacheRuntime::View3DRegs(Func&& func) {
 void QueryCacheRuntime::EndHostConditionalRendering() {
     PauseHostConditionalRendering();
     impl->hcr_is_set = false;
+    impl->scheduler.SetConditionalRendering(false);
     impl->is_hcr_running = false;
     impl->hcr_buffer = nullptr;
     impl->hcr_offset = 0;
@@ -1330,6 +1331,7 @@ void QueryCacheRuntime::HostConditionalRenderingCompareValueImpl(VideoCommon::Lo
     impl->hcr_setup.offset = impl->hcr_offset;
     impl->hcr_setup.flags = is_equal ? VK_CONDITIONAL_RENDERING_INVERTED_BIT_EXT : 0;
     impl->hcr_is_set = true;
+    impl->scheduler.SetConditionalRendering(true);
     impl->is_hcr_running = false;
     if (was_running) {
         ResumeHostConditionalRendering();
@@ -1358,6 +1360,7 @@ void QueryCacheRuntime::HostConditionalRenderingCompareBCImpl(DAddr address, boo
     impl->hcr_setup.offset = 0;
     impl->hcr_setup.flags = is_equal ? 0 : VK_CONDITIONAL_RENDERING_INVERTED_BIT_EXT;
     impl->hcr_is_set = true;
+    impl->scheduler.SetConditionalRendering(true);
     impl->is_hcr_running = false;
     if (was_running) {
         ResumeHostConditionalRendering();
@@ -1391,6 +1394,11 @@ bool QueryCacheRuntime::HostConditionalRenderingCompareValues(VideoCommon::Looku
         }
         return value == 0;
     };
+    // Results resolved on the GPU live in the buffer cache, where they can be compared directly
+    const auto is_resolved = [](const VideoCommon::QueryBase* query) {
+        return True(query->flags & VideoCommon::QueryFlagBits::IsHostManaged) &&
+               True(query->flags & VideoCommon::QueryFlagBits::IsHostSynced);
+    };
     std::array<VideoCommon::LookupData*, 2> objects{&object_1, &object_2};
     std::array<bool, 2> is_in_bc{};
     std::array<bool, 2> is_in_qc{};
@@ -1399,7 +1407,8 @@ bool QueryCacheRuntime::HostConditionalRenderingCompareValues(VideoCommon::Looku
     {
         std::scoped_lock lk(impl->buffer_cache.mutex);
         for (size_t i = 0; i < 2; i++) {
-            is_in_qc[i] = objects[i]->found_query != nullptr;
+            const auto* query = objects[i]->found_query;
+            is_in_qc[i] = query != nullptr && !is_resolved(query);
             is_in_bc[i] = !is_in_qc[i] && check_in_bc(objects[i]->address);
             is_in_ac[i] = is_in_qc[i] || is_in_bc[i];
         }
@@ -1549,6 +1558,16 @@ void QueryCacheRuntime::SyncValues(std::span<SyncValuesType> values, VkBuffer ba
                 pair.first, static_cast<u32>(pair.second - pair.first), sync_info, post_op);
             impl->buffers_to_upload_to.emplace_back(buffer->Handle(), offset);
         }
+        if constexpr (!SyncValuesType::GeneratesBaseBuffer) {
+            // Host query results only exist on the GPU. Track them as GPU writes, so the buffer
+            // cache downloads them with its async flushes and guest reads do not wait on queries.
+            static constexpr auto sync_info = VideoCommon::ObtainBufferSynchronize::NoSynchronize;
+            const auto post_op = VideoCommon::ObtainBufferOperation::MarkAsWritten;
+            for (const auto& sync_val : values) {
+                [[maybe_unused]] const auto result = impl->buffer_cache.ObtainCPUBuffer(
+                    sync_val.address, static_cast<u32>(sync_val.size), sync_info, post_op);
+            }
+        }
     });
 
     VkBuffer src_buffer;
@@ -0,0 +1,58 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <utility>
+
+#include "video_core/renderer_vulkan/vk_render_pass_splitter.h"
+
+namespace Vulkan {
+
+RenderPassSplitter::RenderPassSplitter(bool enabled_, u32 inline_draws_, u32 secondary_draws_)
+    : enabled{enabled_}, inline_draws{inline_draws_}, secondary_draws{secondary_draws_} {}
+
+void RenderPassSplitter::BeginRenderPass() {
+    in_renderpass = true;
+    is_secondary = false;
+    num_renderpass_draws = 0;
+}
+
+RenderPassSplitter::Action RenderPassSplitter::NotifyDraw(bool uses_queries) {
+    // Only bindings lost while recording this draw have to be restored, older ones are dirty
+    lost_bindings = false;
+    if (!enabled || !in_renderpass) {
+        return Action::None;
+    }
+    if (uses_queries) {
+        num_renderpass_draws = 0;
+        return is_secondary ? Action::EndSecondaries : Action::None;
+    }
+    if (!is_secondary) {
+        return num_renderpass_draws++ >= inline_draws ? Action::BeginSecondaries : Action::None;
+    }
+    return num_secondary_draws++ >= secondary_draws ? Action::SplitSecondary : Action::None;
+}
+
+void RenderPassSplitter::BeginSecondaries() {
+    in_renderpass = true;
+    is_secondary = true;
+    num_secondary_draws = 1;
+}
+
+void RenderPassSplitter::SplitSecondary() {
+    num_secondary_draws = 1;
+}
+
+bool RenderPassSplitter::EndRenderPass() {
+    in_renderpass = false;
+    if (!std::exchange(is_secondary, false)) {
+        return false;
+    }
+    lost_bindings = true;
+    return true;
+}
+
+bool RenderPassSplitter::ConsumeLostBindings() {
+    return std::exchange(lost_bindings, false);
+}
+
+} // namespace Vulkan
@@ -0,0 +1,61 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include "common/common_types.h"
+
+namespace Vulkan {
+
+/// Decides when the draws of a renderpass are recorded into secondary command buffers, and tracks
+/// the geometry bindings that are lost when they end. It doesn't record any command by itself.
+class RenderPassSplitter {
+public:
+    enum class Action {
+        None,             ///< The draw is recorded into the current command buffer
+        BeginSecondaries, ///< The renderpass has to restart with its contents in secondaries
+        SplitSecondary,   ///< The current secondary has to end and a new one has to begin
+        EndSecondaries,   ///< The renderpass has to end, the draw is recorded inline
+    };
+
+    explicit RenderPassSplitter(bool enabled, u32 inline_draws, u32 secondary_draws);
+
+    /// Notifies that a renderpass has begun inline in the main command buffer.
+    void BeginRenderPass();
+
+    /// Returns what has to be done before a draw is recorded.
+    /// Secondary command buffers inherit neither queries nor conditional rendering, so the draws
+    /// using them are kept inline.
+    [[nodiscard]] Action NotifyDraw(bool uses_queries);
+
+    /// Notifies that the renderpass has restarted with its contents in secondaries.
+    void BeginSecondaries();
+
+    /// Notifies that the current secondary has ended and a new one has begun.
+    void SplitSecondary();
+
+    /// Notifies that the renderpass has ended. Returns true when it was recorded into secondaries.
+    bool EndRenderPass();
+
+    /// Returns true once when a renderpass recorded into secondaries has ended since the current
+    /// draw was notified. Geometry buffers bound by the draw have to be bound again.
+    [[nodiscard]] bool ConsumeLostBindings();
+
+    /// Returns true while the renderpass is recorded into secondary command buffers.
+    [[nodiscard]] bool IsSecondary() const noexcept {
+        return is_secondary;
+    }
+
+private:
+    bool enabled;
+    u32 inline_draws;
+    u32 secondary_draws;
+
+    bool in_renderpass = false;
+    bool is_secondary = false;
+    bool lost_bindings = false;
+    u32 num_renderpass_draws = 0;
+    u32 num_secondary_draws = 0;
+};
+
+} // namespace Vulkan
@@ -4,6 +4,7 @@
 // SPDX-FileCopyrightText: Copyright 2019 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
 #include <memory>
 #include <mutex>
 #include <thread>
@@ -11,6 +12,8 @@
 
 #include "video_core/renderer_vulkan/vk_query_cache.h"
 
+#include "common/logging/log.h"
+#include "common/settings.h"
 #include "common/thread.h"
 #include "video_core/renderer_vulkan/vk_command_pool.h"
 #include "video_core/renderer_vulkan/vk_master_semaphore.h"
@@ -22,6 +25,125 @@
 
 namespace Vulkan {
 
+namespace {
+
+// Renderpasses with fewer draws than this are recorded inline by the worker thread
+constexpr u32 INLINE_RENDERPASS_DRAWS = 32;
+
+// Number of draws recorded into each secondary command buffer
+constexpr u32 SECONDARY_DRAWS = 128;
+
+constexpr u32 MAX_RECORDING_THREADS = 4;
+
+u64 ElapsedNs(std::chrono::steady_clock::time_point start) {
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    return static_cast<u64>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+}
+
+} // Anonymous namespace
+
+/// Records chunks of a renderpass into secondary command buffers from its own command pool.
+class Scheduler::RecordingThread {
+public:
+    explicit RecordingThread(Scheduler& scheduler_, size_t index)
+        : scheduler{scheduler_}, command_pool{*scheduler.master_semaphore, scheduler.device,
+                                              VK_COMMAND_BUFFER_LEVEL_SECONDARY} {
+        thread = std::jthread([this, index](std::stop_token token) { Run(token, index); });
+    }
+
+    /// Returns a secondary command buffer to record a sequence of chunks into.
+    /// Called from the worker thread. Committing never touches the Vulkan pools already in use.
+    VkCommandBuffer Commit() {
+        return command_pool.Commit();
+    }
+
+    /// Queues a chunk to be recorded into the given secondary command buffer.
+    void Push(std::unique_ptr<CommandChunk> work, VkCommandBuffer cmdbuf) {
+        {
+            std::scoped_lock lk{mutex};
+            queue.push({std::move(work), cmdbuf});
+        }
+        cv.notify_all();
+    }
+
+    /// Waits for every queued chunk to be recorded.
+    void WaitIdle() {
+        std::unique_lock lk{mutex};
+        cv.wait(lk, [this] { return queue.empty() && !busy; });
+    }
+
+private:
+    struct Work {
+        std::unique_ptr<CommandChunk> chunk;
+        VkCommandBuffer cmdbuf;
+    };
+
+    void Run(std::stop_token stop_token, size_t index) {
+        Common::SetCurrentThreadName(fmt::format("VulkanRecorder{}", index).c_str());
+        while (!stop_token.stop_requested()) {
+            Work work;
+            {
+                std::unique_lock lk{mutex};
+                Common::CondvarWait(cv, lk, stop_token, [this] { return !queue.empty(); });
+                if (stop_token.stop_requested()) {
+                    return;
+                }
+                work = std::move(queue.front());
+                queue.pop();
+                busy = true;
+            }
+            const auto start = std::chrono::steady_clock::now();
+            Record(*work.chunk, vk::CommandBuffer(work.cmdbuf, scheduler.device.GetDispatchLoader()));
+            scheduler.secondary_time_ns.fetch_add(ElapsedNs(start), std::memory_order_relaxed);
+            scheduler.RecycleChunk(std::move(work.chunk));
+            {
+                std::scoped_lock lk{mutex};
+                busy = false;
+            }
+            cv.notify_all();
+        }
+    }
+
+    void Record(CommandChunk& work, vk::CommandBuffer cmdbuf) {
+        if (work.BeginsSecondary()) {
+            const RenderPassInfo& info = work.GetRenderPassInfo();
+            const VkCommandBufferInheritanceInfo inheritance_info{
+                .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO,
+                .pNext = nullptr,
+                .renderPass = info.renderpass,
+                .subpass = 0,
+                .framebuffer = info.framebuffer,
+                // Draws using queries or conditional rendering are never split into secondaries,
+                // so neither is active in the main command buffer while these are executed
+                .occlusionQueryEnable = VK_FALSE,
+                .queryFlags = 0,
+                .pipelineStatistics = 0,
+            };
+            cmdbuf.Begin({
+                .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+                .pNext = nullptr,
+                .flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT |
+                         VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT,
+                .pInheritanceInfo = &inheritance_info,
+            });
+        }
+        const bool ends_secondary = work.EndsSecondary();
+        // Commands using the upload command buffer are never recorded into secondaries
+        work.ExecuteAll(cmdbuf, vk::CommandBuffer{});
+        if (ends_secondary) {
+            cmdbuf.End();
+        }
+    }
+
+    Scheduler& scheduler;
+    CommandPool command_pool;
+
+    std::mutex mutex;
+    std::condition_variable_any cv;
+    std::queue<Work> queue;
+    bool busy = false;
+    std::jthread thread;
+};
 
 void Scheduler::CommandChunk::ExecuteAll(vk::CommandBuffer cmdbuf,
                                          vk::CommandBuffer upload_cmdbuf) {
@@ -33,6 +155,11 @@ void Scheduler::CommandChunk::ExecuteAll(vk::CommandBuffer cmdbuf,
         command = next;
     }
     submit = false;
+    secondary = false;
+    secondary_begin = false;
+    secondary_end = false;
+    renderpass_begin = false;
+    upload_only = false;
     command_offset = 0;
     first = nullptr;
     last = nullptr;
@@ -41,9 +168,21 @@ void Scheduler::CommandChunk::ExecuteAll(vk::CommandBuffer cmdbuf,
 Scheduler::Scheduler(const Device& device_, StateTracker& state_tracker_)
     : device{device_}, state_tracker{state_tracker_},
       master_semaphore{std::make_unique<MasterSemaphore>(device)},
-      command_pool{std::make_unique<CommandPool>(*master_semaphore, device)} {
+      command_pool{std::make_unique<CommandPool>(*master_semaphore, device)},
+      splitter{Settings::values.use_parallel_command_recording.GetValue(),
+               INLINE_RENDERPASS_DRAWS, SECONDARY_DRAWS} {
     AcquireNewChunk();
     AllocateWorkerCommandBuffer();
+    parallel_recording = Settings::values.use_parallel_command_recording.GetValue();
+    if (parallel_recording) {
+        upload_chunk = TakeReserveChunk();
+        upload_chunk->MarkUploadOnly();
+        const u32 num_threads =
+            std::clamp(std::thread::hardware_concurrency() / 2, 2U, MAX_RECORDING_THREADS);
+        for (u32 index = 0; index < num_threads; ++index) {
+            recording_threads.push_back(std::make_unique<RecordingThread>(*this, index));
+        }
+    }
     worker_thread = std::jthread([this](std::stop_token token) { WorkerThread(token); });
 }
 
@@ -75,18 +214,41 @@ void Scheduler::WaitWorker() {
 
     // Now wait for execution to finish.
     std::scoped_lock el{execution_mutex};
+
+    // Chunks handed to recording threads have to be executed too.
+    for (const auto& recording_thread : recording_threads) {
+        recording_thread->WaitIdle();
+    }
 }
 
 void Scheduler::DispatchWork() {
-    if (chunk->Empty()) {
+    const bool has_uploads = upload_chunk && !upload_chunk->Empty();
+    if (chunk->Empty() && !chunk->HasSecondaryBoundary() && !has_uploads) {
         return;
     }
     {
         std::scoped_lock ql{queue_mutex};
-        work_queue.push(std::move(chunk));
+        if (has_uploads) {
+            work_queue.push(std::move(upload_chunk));
+        }
+        if (!chunk->Empty() || chunk->HasSecondaryBoundary()) {
+            work_queue.push(std::move(chunk));
+        }
     }
     event_cv.notify_all();
+    if (has_uploads) {
+        upload_chunk = TakeReserveChunk();
+        upload_chunk->MarkUploadOnly();
+    }
+    if (chunk) {
+        return;
+    }
     AcquireNewChunk();
+    if (splitter.IsSecondary()) {
+        // The renderpass continues in the same secondary command buffer
+        chunk->MarkSecondary({state.renderpass, state.framebuffer, state.render_area}, false,
+                             false);
+    }
 }
 
 void Scheduler::RequestRenderpass(const Framebuffer* framebuffer) {
@@ -102,6 +264,7 @@ void Scheduler::RequestRenderpass(const Framebuffer* framebuffer) {
     state.renderpass = renderpass;
     state.framebuffer = framebuffer_handle;
     state.render_area = render_area;
+    splitter.BeginRenderPass();
 
     Record([renderpass, framebuffer_handle, render_area](vk::CommandBuffer cmdbuf) {
         const VkRenderPassBeginInfo renderpass_bi{
@@ -124,6 +287,25 @@ void Scheduler::RequestRenderpass(const Framebuffer* framebuffer) {
     renderpass_image_ranges = framebuffer->ImageRanges();
 }
 
+void Scheduler::NotifyDraw(bool uses_queries) {
+    switch (splitter.NotifyDraw(uses_queries || conditional_rendering)) {
+    case RenderPassSplitter::Action::None:
+        break;
+    case RenderPassSplitter::Action::BeginSecondaries:
+        BeginSecondaryRenderPass();
+        break;
+    case RenderPassSplitter::Action::SplitSecondary:
+        SplitSecondary();
+        break;
+    case RenderPassSplitter::Action::EndSecondaries:
+        // Queries begun inside of the renderpass would end it anyway, after the draw is bound
+        EndRenderPass();
+        // Nothing of the draw has been bound yet, the state invalidation covers the rest
+        (void)splitter.ConsumeLostBindings();
+        break;
+    }
+}
+
 void Scheduler::RequestOutsideRenderPassOperationContext() {
     EndRenderPass();
 }
@@ -136,6 +318,14 @@ bool Scheduler::UpdateGraphicsPipeline(GraphicsPipeline* pipeline) {
     return true;
 }
 
+bool Scheduler::UpdateDescriptorBuffer(VkBuffer buffer) {
+    if (state.descriptor_buffer == buffer) {
+        return false;
+    }
+    state.descriptor_buffer = buffer;
+    return true;
+}
+
 bool Scheduler::UpdateRescaling(bool is_rescaling) {
     if (state.rescaling_defined && is_rescaling == state.is_rescaling) {
         return false;
@@ -145,6 +335,23 @@ bool Scheduler::UpdateRescaling(bool is_rescaling) {
     return true;
 }
 
+bool Scheduler::ConsumeLostBindings() {
+    return splitter.ConsumeLostBindings();
+}
+
+void Scheduler::TickFrame() {
+    recording_stats = {
+        .worker_time = std::chrono::nanoseconds{worker_time_ns.exchange(0)},
+        .secondary_time = std::chrono::nanoseconds{secondary_time_ns.exchange(0)},
+        .num_secondaries = num_secondaries.exchange(0),
+    };
+    if (parallel_recording) {
+        LOG_TRACE(Render_Vulkan, "Recording: worker {} us, secondaries {} us in {} buffers",
+                  recording_stats.worker_time.count() / 1000,
+                  recording_stats.secondary_time.count() / 1000, recording_stats.num_secondaries);
+    }
+}
+
 void Scheduler::WorkerThread(std::stop_token stop_token) {
     Common::SetCurrentThreadName("VulkanWorker");
 
@@ -178,24 +385,80 @@ void Scheduler::WorkerThread(std::stop_token stop_token) {
             // to complete in the next step.
             std::exchange(lk, std::unique_lock{execution_mutex});
 
-            // Perform the work, tracking whether the chunk was a submission
-            // before executing.
-            const bool has_submit = work->HasSubmit();
-            work->ExecuteAll(current_cmdbuf, current_upload_cmdbuf);
-
-            // If the chunk was a submission, reallocate the command buffer.
-            if (has_submit) {
-                AllocateWorkerCommandBuffer();
-            }
+            // Perform the work.
+            ExecuteChunk(std::move(work));
         }
+    }
+}
 
-        {
-            std::scoped_lock rl{reserve_mutex};
-
-            // Recycle the chunk back to the reserve.
-            chunk_reserve.emplace_back(std::move(work));
+void Scheduler::ExecuteChunk(std::unique_ptr<CommandChunk> work) {
+    if (work->IsUploadOnly()) {
+        work->ExecuteAll(vk::CommandBuffer{}, current_upload_cmdbuf);
+        RecycleChunk(std::move(work));
+        return;
+    }
+    if (work->IsSecondary()) {
+        if (work->BeginsRenderPass()) {
+            const RenderPassInfo& info = work->GetRenderPassInfo();
+            current_cmdbuf.BeginRenderPass(
+                {
+                    .sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO,
+                    .pNext = nullptr,
+                    .renderPass = info.renderpass,
+                    .framebuffer = info.framebuffer,
+                    .renderArea =
+                        {
+                            .offset = {.x = 0, .y = 0},
+                            .extent = info.render_area,
+                        },
+                    .clearValueCount = 0,
+                    .pClearValues = nullptr,
+                },
+                VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS);
         }
+        if (work->BeginsSecondary()) {
+            // Secondaries are handed to recording threads in turns, so consecutive ones overlap
+            current_recorder = recording_threads[next_recorder].get();
+            next_recorder = (next_recorder + 1) % recording_threads.size();
+            pending_secondaries.push_back(current_recorder->Commit());
+            num_secondaries.fetch_add(1, std::memory_order_relaxed);
+        }
+        current_recorder->Push(std::move(work), pending_secondaries.back());
+        return;
+    }
+    // A chunk outside of a split renderpass starts by ending it
+    FlushSecondaries();
+
+    // Track whether the chunk was a submission before executing.
+    const auto start = std::chrono::steady_clock::now();
+    const bool has_submit = work->HasSubmit();
+    work->ExecuteAll(current_cmdbuf, current_upload_cmdbuf);
+    worker_time_ns.fetch_add(ElapsedNs(start), std::memory_order_relaxed);
+
+    // If the chunk was a submission, reallocate the command buffer.
+    if (has_submit) {
+        AllocateWorkerCommandBuffer();
+    }
+    RecycleChunk(std::move(work));
+}
+
+void Scheduler::FlushSecondaries() {
+    if (pending_secondaries.empty()) {
+        return;
+    }
+    for (const auto& recording_thread : recording_threads) {
+        recording_thread->WaitIdle();
     }
+    current_cmdbuf.ExecuteCommands(pending_secondaries);
+    pending_secondaries.clear();
+    current_recorder = nullptr;
+}
+
+void Scheduler::RecycleChunk(std::unique_ptr<CommandChunk> work) {
+    std::scoped_lock rl{reserve_mutex};
+
+    // Recycle the chunk back to the reserve.
+    chunk_reserve.emplace_back(std::move(work));
 }
 
 void Scheduler::AllocateWorkerCommandBuffer() {
@@ -216,6 +479,9 @@ void Scheduler::AllocateWorkerCommandBuffer() {
 }
 
 u64 Scheduler::SubmitExecution(VkSemaphore signal_semaphore, VkSemaphore wait_semaphore) {
+    if (pre_submit) {
+        pre_submit();
+    }
     EndPendingOperations();
     InvalidateState();
 
@@ -261,6 +527,7 @@ void Scheduler::AllocateNewContext() {
 
 void Scheduler::InvalidateState() {
     state.graphics_pipeline = nullptr;
+    state.descriptor_buffer = nullptr;
     state.rescaling_defined = false;
     state_tracker.InvalidateCommandBufferState();
 }
@@ -270,6 +537,37 @@ void Scheduler::EndPendingOperations() {
     EndRenderPass();
 }
 
+void Scheduler::BeginSecondaryRenderPass() {
+    const RenderPassInfo info{state.renderpass, state.framebuffer, state.render_area};
+    const u32 num_images = num_renderpass_images;
+
+    // Restart the renderpass, its contents can't be inline and in secondaries at the same time
+    EndRenderPass();
+    DispatchWork();
+    state.renderpass = info.renderpass;
+    state.framebuffer = info.framebuffer;
+    state.render_area = info.render_area;
+    splitter.BeginSecondaries();
+    num_renderpass_images = num_images;
+
+    chunk->MarkSecondary(info, true, true);
+    InvalidateState();
+}
+
+void Scheduler::SplitSecondary() {
+    // Queries and conditional rendering can't span multiple command buffers
+    query_cache->CounterEnable(VideoCommon::QueryType::ZPassPixelCount64, false);
+    query_cache->NotifySegment(false);
+
+    chunk->MarkSecondaryEnd();
+    DispatchWork();
+    chunk->MarkSecondary({state.renderpass, state.framebuffer, state.render_area}, true, false);
+    splitter.SplitSecondary();
+
+    // Secondary command buffers don't inherit any state
+    InvalidateState();
+}
+
 void Scheduler::EndRenderPass()
     {
         if (!state.renderpass) {
@@ -279,6 +577,14 @@ void Scheduler::EndRenderPass()
         query_cache->CounterEnable(VideoCommon::QueryType::ZPassPixelCount64, false);
         query_cache->NotifySegment(false);
 
+        if (splitter.EndRenderPass()) {
+            chunk->MarkSecondaryEnd();
+            DispatchWork();
+
+            // Executing secondaries leaves the main command buffer state undefined
+            InvalidateState();
+        }
+
         Record([num_images = num_renderpass_images,
                        images = renderpass_images,
                        ranges = renderpass_image_ranges](vk::CommandBuffer cmdbuf) {
@@ -343,16 +649,20 @@ void Scheduler::EndRenderPass()
 
 
 void Scheduler::AcquireNewChunk() {
+    chunk = TakeReserveChunk();
+}
+
+std::unique_ptr<Scheduler::CommandChunk> Scheduler::TakeReserveChunk() {
     std::scoped_lock rl{reserve_mutex};
 
     if (chunk_reserve.empty()) {
         // If we don't have anything reserved, we need to make a new chunk.
-        chunk = std::make_unique<CommandChunk>();
-    } else {
-        // Otherwise, we can just take from the reserve.
-        chunk = std::move(chunk_reserve.back());
-        chunk_reserve.pop_back();
+        return std::make_unique<CommandChunk>();
     }
+    // Otherwise, we can just take from the reserve.
+    std::unique_ptr<CommandChunk> reserved = std::move(chunk_reserve.back());
+    chunk_reserve.pop_back();
+    return reserved;
 }
 
 } // namespace Vulkan
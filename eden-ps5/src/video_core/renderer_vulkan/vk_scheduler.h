@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <cstddef>
 #include <functional>
@@ -10,11 +12,13 @@
 #include <thread>
 #include <utility>
 #include <queue>
+#include <vector>
 
 #include "common/alignment.h"
 #include "common/common_types.h"
 #include "common/polyfill_thread.h"
 #include "video_core/renderer_vulkan/vk_master_semaphore.h"
+#include "video_core/renderer_vulkan/vk_render_pass_splitter.h"
 #include "video_core/vulkan_common/vulkan_wrapper.h"
 
 namespace VideoCommon {
@@ -55,6 +59,16 @@ public:
     /// Requests to begin a renderpass.
     void RequestRenderpass(const Framebuffer* framebuffer);
 
+    /// Notifies that a draw is about to be recorded. When parallel command recording is enabled,
+    /// this may split the current renderpass into a new secondary command buffer.
+    /// Draws using occlusion queries or conditional rendering are recorded inline.
+    void NotifyDraw(bool uses_queries);
+
+    /// Notifies whether host conditional rendering is set for the following draws.
+    void SetConditionalRendering(bool is_set) noexcept {
+        conditional_rendering = is_set;
+    }
+
     /// Requests the current execution context to be able to execute operations only allowed outside
     /// of a renderpass.
     void RequestOutsideRenderPassOperationContext();
@@ -62,12 +76,19 @@ public:
     /// Update the pipeline to the current execution context.
     bool UpdateGraphicsPipeline(GraphicsPipeline* pipeline);
 
+    /// Update the bound descriptor buffer. Returns true if the buffer has to be bound.
+    bool UpdateDescriptorBuffer(VkBuffer buffer);
+
     /// Update the rescaling state. Returns true if the state has to be updated.
     bool UpdateRescaling(bool is_rescaling);
 
     /// Invalidates current command buffer state except for render passes
     void InvalidateState();
 
+    /// Returns true once when a renderpass split into secondary command buffers has ended since
+    /// the current draw was notified. Geometry buffers bound by the draw have to be bound again.
+    bool ConsumeLostBindings();
+
     /// Assigns the query cache.
     void SetQueryCache(VideoCommon::QueryCacheBase<QueryCacheParams>& query_cache_) {
         query_cache = &query_cache_;
@@ -78,21 +99,31 @@ public:
         on_submit = std::move(func);
     }
 
+    // Registers a callback to record pending work right before the command buffer is submitted.
+    void RegisterPreSubmit(std::function<void()>&& func) {
+        pre_submit = std::move(func);
+    }
+
     /// Send work to a separate thread.
+    /// While a renderpass is split into secondary command buffers, these commands are executed by
+    /// the worker thread without a main command buffer, so they may only record to the upload one.
     template <typename T>
         requires std::is_invocable_v<T, vk::CommandBuffer, vk::CommandBuffer>
     void RecordWithUploadBuffer(T&& command) {
-        if (chunk->Record(command)) {
+        if (splitter.IsSecondary()) {
+            if (!upload_chunk->Record(command)) {
+                DispatchWork();
+                (void)upload_chunk->Record(command);
+            }
             return;
         }
-        DispatchWork();
-        (void)chunk->Record(command);
+        RecordCommand(std::forward<T>(command));
     }
 
     template <typename T>
         requires std::is_invocable_v<T, vk::CommandBuffer>
     void Record(T&& c) {
-        this->RecordWithUploadBuffer(
+        this->RecordCommand(
             [command = std::move(c)](vk::CommandBuffer cmdbuf, vk::CommandBuffer) {
                 command(cmdbuf);
             });
@@ -122,6 +153,20 @@ public:
         return *master_semaphore;
     }
 
+    struct RecordingStats {
+        std::chrono::nanoseconds worker_time{};    ///< Time the worker thread spent recording
+        std::chrono::nanoseconds secondary_time{}; ///< Time spent recording secondary buffers
+        u64 num_secondaries{};                     ///< Number of secondary command buffers
+    };
+
+    /// Collects the command recording counters of the frame that just ended.
+    void TickFrame();
+
+    /// Returns the command recording counters of the last frame.
+    [[nodiscard]] const RecordingStats& GetRecordingStats() const noexcept {
+        return recording_stats;
+    }
+
     std::mutex submit_mutex;
 
 private:
@@ -161,6 +206,12 @@ private:
         T command;
     };
 
+    struct RenderPassInfo {
+        VkRenderPass renderpass;
+        VkFramebuffer framebuffer;
+        VkExtent2D render_area;
+    };
+
     class CommandChunk final {
     public:
         void ExecuteAll(vk::CommandBuffer cmdbuf, vk::CommandBuffer upload_cmdbuf);
@@ -198,12 +249,65 @@ private:
             return submit;
         }
 
+        /// Marks the chunk as part of a renderpass recorded into secondary command buffers.
+        void MarkSecondary(const RenderPassInfo& info, bool begins_secondary,
+                           bool begins_renderpass) {
+            secondary = true;
+            secondary_begin = begins_secondary;
+            renderpass_begin = begins_renderpass;
+            renderpass_info = info;
+        }
+
+        /// Marks the chunk as the last one of its secondary command buffer.
+        void MarkSecondaryEnd() {
+            secondary_end = true;
+        }
+
+        /// Returns true when the chunk has to be sent even without commands.
+        bool HasSecondaryBoundary() const {
+            return secondary_begin || secondary_end;
+        }
+
+        bool IsSecondary() const {
+            return secondary;
+        }
+
+        bool BeginsSecondary() const {
+            return secondary_begin;
+        }
+
+        bool EndsSecondary() const {
+            return secondary_end;
+        }
+
+        bool BeginsRenderPass() const {
+            return renderpass_begin;
+        }
+
+        const RenderPassInfo& GetRenderPassInfo() const {
+            return renderpass_info;
+        }
+
+        void MarkUploadOnly() {
+            upload_only = true;
+        }
+
+        bool IsUploadOnly() const {
+            return upload_only;
+        }
+
     private:
         Command* first = nullptr;
         Command* last = nullptr;
 
         size_t command_offset = 0;
         bool submit = false;
+        bool secondary = false;
+        bool secondary_begin = false;
+        bool secondary_end = false;
+        bool renderpass_begin = false;
+        bool upload_only = false;
+        RenderPassInfo renderpass_info{};
         alignas(std::max_align_t) std::array<u8, 0x8000> data{};
     };
 
@@ -212,12 +316,38 @@ private:
         VkFramebuffer framebuffer = nullptr;
         VkExtent2D render_area = {0, 0};
         GraphicsPipeline* graphics_pipeline = nullptr;
+        VkBuffer descriptor_buffer = nullptr;
         bool is_rescaling = false;
         bool rescaling_defined = false;
     };
 
+    class RecordingThread;
+
+    template <typename T>
+    void RecordCommand(T&& command) {
+        if (chunk->Record(command)) {
+            return;
+        }
+        DispatchWork();
+        (void)chunk->Record(command);
+    }
+
     void WorkerThread(std::stop_token stop_token);
 
+    /// Executes a chunk on the worker thread, handing renderpass contents to recording threads.
+    void ExecuteChunk(std::unique_ptr<CommandChunk> work);
+
+    /// Waits for the secondary command buffers of the current renderpass and executes them.
+    void FlushSecondaries();
+
+    /// Ends the current secondary command buffer and starts a new one in the same renderpass.
+    void SplitSecondary();
+
+    /// Restarts the current renderpass with its contents recorded into secondary command buffers.
+    void BeginSecondaryRenderPass();
+
+    void RecycleChunk(std::unique_ptr<CommandChunk> work);
+
     void AllocateWorkerCommandBuffer();
 
     u64 SubmitExecution(VkSemaphore signal_semaphore, VkSemaphore wait_semaphore);
@@ -230,6 +360,8 @@ private:
 
     void AcquireNewChunk();
 
+    std::unique_ptr<CommandChunk> TakeReserveChunk();
+
     const Device& device;
     StateTracker& state_tracker;
 
@@ -242,10 +374,16 @@ private:
     vk::CommandBuffer current_upload_cmdbuf;
 
     std::unique_ptr<CommandChunk> chunk;
+    std::unique_ptr<CommandChunk> upload_chunk;
     std::function<void()> on_submit;
+    std::function<void()> pre_submit;
 
     State state;
 
+    bool parallel_recording = false;
+    bool conditional_rendering = false;
+    RenderPassSplitter splitter;
+
     u32 num_renderpass_images = 0;
     std::array<VkImage, 9> renderpass_images{};
     std::array<VkImageSubresourceRange, 9> renderpass_image_ranges{};
@@ -256,6 +394,17 @@ private:
     std::mutex reserve_mutex;
     std::mutex queue_mutex;
     std::condition_variable_any event_cv;
+
+    std::vector<std::unique_ptr<RecordingThread>> recording_threads;
+    std::vector<VkCommandBuffer> pending_secondaries; ///< Worker-owned, in submission order
+    RecordingThread* current_recorder = nullptr;      ///< Worker-owned
+    size_t next_recorder = 0;                         ///< Worker-owned
+
+    std::atomic<u64> worker_time_ns{};
+    std::atomic<u64> secondary_time_ns{};
+    std::atomic<u64> num_secondaries{};
+    RecordingStats recording_stats;
+
     std::jthread worker_thread;
 };
 
@@ -12,6 +12,7 @@
 #include "common/common_types.h"
 #include "video_core/texture_cache/image_info.h"
 #include "video_core/texture_cache/image_view_info.h"
+#include "video_core/texture_cache/memory_budget.h"
 #include "video_core/texture_cache/types.h"
 
 namespace VideoCommon {
@@ -103,6 +104,9 @@ struct ImageBase {
 
     u64 modification_tick = 0;
     size_t lru_index = SIZE_MAX;
+    ImageBudgetClass budget_class = ImageBudgetClass::Sampled;
+    u64 budget_bytes = 0; ///< Memory charged to the budget class of the image
+    u64 recompression_saved_bytes = 0; ///< Memory saved by storing the image recompressed
 
     std::array<u32, MAX_MIP_LEVELS> mip_level_offsets{};
 
@@ -0,0 +1,142 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "common/assert.h"
+#include "video_core/texture_cache/memory_budget.h"
+
+namespace VideoCommon {
+
+namespace {
+
+/// Recreate cost of each image class relative to reuploading a sampled texture
+constexpr std::array<u64, NUM_IMAGE_BUDGET_CLASSES> RECREATE_COSTS{
+    1, // Sampled
+    4, // AsyncDecoded
+    8, // RenderTarget
+    8, // Rescaled
+};
+
+/// Fixed point scale of eviction priorities
+constexpr u64 PRIORITY_SCALE = 16;
+
+constexpr size_t Index(ImageBudgetClass budget_class) {
+    return static_cast<size_t>(budget_class);
+}
+
+} // Anonymous namespace
+
+std::string_view NameOf(ImageBudgetClass budget_class) noexcept {
+    switch (budget_class) {
+    case ImageBudgetClass::Sampled:
+        return "sampled";
+    case ImageBudgetClass::AsyncDecoded:
+        return "async_decoded";
+    case ImageBudgetClass::RenderTarget:
+        return "render_target";
+    case ImageBudgetClass::Rescaled:
+        return "rescaled";
+    case ImageBudgetClass::Count:
+        break;
+    }
+    return "unknown";
+}
+
+void MemoryBudget::SetLimits(u64 minimum, u64 expected, u64 critical) noexcept {
+    minimum_bytes = minimum;
+    expected_bytes = expected;
+    critical_bytes = critical;
+}
+
+MemoryPressure MemoryBudget::GetPressure(u64 used_bytes) const noexcept {
+    if (used_bytes >= critical_bytes) {
+        return MemoryPressure::Critical;
+    }
+    if (used_bytes >= expected_bytes) {
+        return MemoryPressure::High;
+    }
+    if (used_bytes > minimum_bytes) {
+        return MemoryPressure::Low;
+    }
+    return MemoryPressure::None;
+}
+
+void MemoryBudget::Add(ImageBudgetClass budget_class, u64 bytes) noexcept {
+    class_bytes[Index(budget_class)] += bytes;
+}
+
+void MemoryBudget::Remove(ImageBudgetClass budget_class, u64 bytes) noexcept {
+    u64& current = class_bytes[Index(budget_class)];
+    ASSERT(current >= bytes);
+    current -= bytes;
+}
+
+u64 MemoryBudget::GetClassBytes(ImageBudgetClass budget_class) const noexcept {
+    return class_bytes[Index(budget_class)];
+}
+
+void MemoryBudget::AddRecompressionSavings(u64 bytes) noexcept {
+    recompression_saved_bytes += bytes;
+}
+
+void MemoryBudget::RemoveRecompressionSavings(u64 bytes) noexcept {
+    ASSERT(recompression_saved_bytes >= bytes);
+    recompression_saved_bytes -= bytes;
+}
+
+void MemoryBudget::RecordEviction(ImageBudgetClass budget_class, u64 bytes) noexcept {
+    ++frame_evictions[Index(budget_class)];
+    frame_evicted_bytes += bytes;
+}
+
+void MemoryBudget::TickFrame(u64 used_bytes) noexcept {
+    stats = Stats{
+        .used_bytes = used_bytes,
+        .minimum_bytes = minimum_bytes,
+        .expected_bytes = expected_bytes,
+        .critical_bytes = critical_bytes,
+        .pressure = GetPressure(used_bytes),
+        .class_bytes = class_bytes,
+        .evictions = frame_evictions,
+        .evicted_bytes = frame_evicted_bytes,
+        .recompression_saved_bytes = recompression_saved_bytes,
+    };
+    frame_evictions = {};
+    frame_evicted_bytes = 0;
+}
+
+u64 MemoryBudget::GetMinimumAge(MemoryPressure pressure) noexcept {
+    switch (pressure) {
+    case MemoryPressure::None:
+    case MemoryPressure::Low:
+        return 50;
+    case MemoryPressure::High:
+        return 25;
+    case MemoryPressure::Critical:
+        return 10;
+    }
+    return 50;
+}
+
+size_t MemoryBudget::GetMaxEvictions(MemoryPressure pressure) noexcept {
+    switch (pressure) {
+    case MemoryPressure::None:
+        return 0;
+    case MemoryPressure::Low:
+        return 10;
+    case MemoryPressure::High:
+        return 20;
+    case MemoryPressure::Critical:
+        return 40;
+    }
+    return 0;
+}
+
+u64 MemoryBudget::GetRecreateCost(ImageBudgetClass budget_class) noexcept {
+    return RECREATE_COSTS[Index(budget_class)];
+}
+
+u64 MemoryBudget::GetEvictionPriority(ImageBudgetClass budget_class, u64 age) noexcept {
+    return age * PRIORITY_SCALE / GetRecreateCost(budget_class);
+}
+
+} // namespace VideoCommon
@@ -0,0 +1,103 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <array>
+#include <string_view>
+
+#include "common/common_types.h"
+
+namespace VideoCommon {
+
+/// Classes of images accounted separately by the texture cache memory budget
+enum class ImageBudgetClass : u8 {
+    Sampled,      ///< Only written from guest memory, it can be uploaded again
+    AsyncDecoded, ///< Decoded or converted on upload, costly to load again
+    RenderTarget, ///< Written by the GPU, it has to be downloaded before eviction
+    Rescaled,     ///< Has a copy at the rescaled resolution that has to be rendered again
+    Count,
+};
+
+constexpr size_t NUM_IMAGE_BUDGET_CLASSES = static_cast<size_t>(ImageBudgetClass::Count);
+
+[[nodiscard]] std::string_view NameOf(ImageBudgetClass budget_class) noexcept;
+
+/// Memory pressure levels, ordered from lowest to highest
+enum class MemoryPressure : u8 {
+    None,     ///< Below the minimum, nothing is evicted
+    Low,      ///< Old images that can be evicted without a download are evicted
+    High,     ///< Over the expected budget, GPU modified images are downloaded and evicted
+    Critical, ///< Over the critical budget, costly to load images are evicted too
+};
+
+/**
+ * Memory budget of the texture cache.
+ * Tracks the memory used by each image class and ranks eviction candidates. The priority of an
+ * image grows with the frames it has been unused for and shrinks with the cost of recreating it,
+ * so under pressure old sampled textures go before render targets and rescaled images.
+ */
+class MemoryBudget {
+public:
+    struct Stats {
+        u64 used_bytes{};     ///< Memory used by the cache at the end of the frame
+        u64 minimum_bytes{};  ///< Memory usage where garbage collection starts
+        u64 expected_bytes{}; ///< Expected memory budget
+        u64 critical_bytes{}; ///< Memory usage where costly to load images are evicted
+        MemoryPressure pressure{}; ///< Pressure at the end of the frame
+        std::array<u64, NUM_IMAGE_BUDGET_CLASSES> class_bytes{}; ///< Memory of each image class
+        std::array<u64, NUM_IMAGE_BUDGET_CLASSES> evictions{};   ///< Evicted images of each class
+        u64 evicted_bytes{}; ///< Memory released by evictions
+        u64 recompression_saved_bytes{}; ///< Memory saved by recompressing decoded ASTC to BCn
+    };
+
+    void SetLimits(u64 minimum, u64 expected, u64 critical) noexcept;
+
+    [[nodiscard]] MemoryPressure GetPressure(u64 used_bytes) const noexcept;
+
+    void Add(ImageBudgetClass budget_class, u64 bytes) noexcept;
+
+    void Remove(ImageBudgetClass budget_class, u64 bytes) noexcept;
+
+    [[nodiscard]] u64 GetClassBytes(ImageBudgetClass budget_class) const noexcept;
+
+    /// Accounts memory saved by images stored recompressed instead of decoded to RGBA8
+    void AddRecompressionSavings(u64 bytes) noexcept;
+
+    void RemoveRecompressionSavings(u64 bytes) noexcept;
+
+    /// Records an image evicted by the garbage collector
+    void RecordEviction(ImageBudgetClass budget_class, u64 bytes) noexcept;
+
+    /// Publishes the counters of the current frame and starts a new one
+    void TickFrame(u64 used_bytes) noexcept;
+
+    /// Returns the counters of the last frame
+    [[nodiscard]] const Stats& GetStats() const noexcept {
+        return stats;
+    }
+
+    /// Returns the frames an image has to be unused for to be evicted at the given pressure
+    [[nodiscard]] static u64 GetMinimumAge(MemoryPressure pressure) noexcept;
+
+    /// Returns the maximum number of images evicted per frame at the given pressure
+    [[nodiscard]] static size_t GetMaxEvictions(MemoryPressure pressure) noexcept;
+
+    /// Returns the relative cost of recreating an image of the given class
+    [[nodiscard]] static u64 GetRecreateCost(ImageBudgetClass budget_class) noexcept;
+
+    /// Returns the eviction priority of an image unused for age frames, higher is evicted first
+    [[nodiscard]] static u64 GetEvictionPriority(ImageBudgetClass budget_class, u64 age) noexcept;
+
+private:
+    u64 minimum_bytes{};
+    u64 expected_bytes{};
+    u64 critical_bytes{};
+    std::array<u64, NUM_IMAGE_BUDGET_CLASSES> class_bytes{};
+    std::array<u64, NUM_IMAGE_BUDGET_CLASSES> frame_evictions{};
+    u64 frame_evicted_bytes{};
+    u64 recompression_saved_bytes{};
+    Stats stats{};
+};
+
+} // namespace VideoCommon
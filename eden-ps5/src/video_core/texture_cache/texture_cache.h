@@ -59,54 +59,82 @@ TextureCache<P>::TextureCache(Runtime& runtime_, Tegra::MaxwellDeviceMemoryManag
         const s64 mem_threshold = std::min(device_local_memory, TARGET_THRESHOLD);
         const s64 min_vacancy_expected = (6 * mem_threshold) / 10;
         const s64 min_vacancy_critical = (2 * mem_threshold) / 10;
-        expected_memory = static_cast<u64>(
+        const u64 expected_memory = static_cast<u64>(
             std::max(std::min(device_local_memory - min_vacancy_expected, min_spacing_expected),
                      DEFAULT_EXPECTED_MEMORY));
-        critical_memory = static_cast<u64>(
+        const u64 critical_memory = static_cast<u64>(
             std::max(std::min(device_local_memory - min_vacancy_critical, min_spacing_critical),
                      DEFAULT_CRITICAL_MEMORY));
-        minimum_memory = static_cast<u64>((device_local_memory - mem_threshold) / 2);
+        const u64 minimum_memory = static_cast<u64>((device_local_memory - mem_threshold) / 2);
+        memory_budget.SetLimits(minimum_memory, expected_memory, critical_memory);
     } else {
-        expected_memory = DEFAULT_EXPECTED_MEMORY + 512_MiB;
-        critical_memory = DEFAULT_CRITICAL_MEMORY + 1_GiB;
-        minimum_memory = 0;
+        memory_budget.SetLimits(0, DEFAULT_EXPECTED_MEMORY + 512_MiB,
+                                DEFAULT_CRITICAL_MEMORY + 1_GiB);
     }
 }
 
 template <class P>
 void TextureCache<P>::RunGarbageCollector() {
-    bool high_priority_mode = false;
-    bool aggressive_mode = false;
-    u64 ticks_to_destroy = 0;
-    size_t num_iterations = 0;
-
-    const auto Configure = [&](bool allow_aggressive) {
-        high_priority_mode = total_used_memory >= expected_memory;
-        aggressive_mode = allow_aggressive && total_used_memory >= critical_memory;
-        ticks_to_destroy = aggressive_mode ? 10ULL : high_priority_mode ? 25ULL : 50ULL;
-        num_iterations = aggressive_mode ? 40 : (high_priority_mode ? 20 : 10);
-    };
-    const auto Cleanup = [this, &num_iterations, &high_priority_mode,
-                          &aggressive_mode](ImageId image_id) {
-        if (num_iterations == 0) {
-            return true;
-        }
-        --num_iterations;
+    // Try to remove anything old enough and not costly to load back.
+    EvictImages(std::min(memory_budget.GetPressure(total_used_memory), MemoryPressure::High));
+
+    // If pressure is still too high, prune aggressively.
+    if (memory_budget.GetPressure(total_used_memory) == MemoryPressure::Critical) {
+        EvictImages(MemoryPressure::Critical);
+    }
+}
+
+template <class P>
+void TextureCache<P>::EvictImages(MemoryPressure pressure) {
+    static constexpr size_t MAX_CANDIDATES = 256;
+    if (pressure == MemoryPressure::None) {
+        return;
+    }
+
+    // Gather the least recently used images that can be evicted at this pressure
+    gc_candidates.clear();
+    const u64 minimum_age = MemoryBudget::GetMinimumAge(pressure);
+    lru_cache.ForEachItemBelow(frame_tick - minimum_age, [&](ImageId image_id, u64 tick) {
         auto& image = slot_images[image_id];
         if (True(image.flags & ImageFlagBits::IsDecoding)) {
             // This image is still being decoded, deleting it will invalidate the slot
             // used by the async decoder thread.
             return false;
         }
-        if (!aggressive_mode && True(image.flags & ImageFlagBits::CostlyLoad)) {
+        if (pressure < MemoryPressure::Critical && True(image.flags & ImageFlagBits::CostlyLoad)) {
             return false;
         }
         const bool must_download =
             image.IsSafeDownload() && False(image.flags & ImageFlagBits::BadOverlap);
-        if (!high_priority_mode && must_download) {
+        if (pressure < MemoryPressure::High && must_download) {
             return false;
         }
+        UpdateImageBudget(image);
+        gc_candidates.push_back({
+            .image_id = image_id,
+            .priority = MemoryBudget::GetEvictionPriority(image.budget_class, frame_tick - tick),
+            .size = image.budget_bytes,
+        });
+        return gc_candidates.size() == MAX_CANDIDATES;
+    });
+
+    // Evict images that are cheap to rebuild and long unused first, larger ones on ties
+    std::ranges::sort(gc_candidates, [](const GcCandidate& lhs, const GcCandidate& rhs) {
+        return lhs.priority != rhs.priority ? lhs.priority > rhs.priority : lhs.size > rhs.size;
+    });
+
+    size_t num_evictions = MemoryBudget::GetMaxEvictions(pressure);
+    for (const GcCandidate& candidate : gc_candidates) {
+        if (num_evictions == 0) {
+            break;
+        }
+        auto& image = slot_images[candidate.image_id];
+        const bool must_download =
+            image.IsSafeDownload() && False(image.flags & ImageFlagBits::BadOverlap);
         if (must_download) {
+            if (pressure < MemoryPressure::High) {
+                continue;
+            }
             auto map = runtime.DownloadStagingBuffer(image.unswizzled_size_bytes);
             const auto copies = FullDownloadCopies(image.info);
             image.DownloadMemory(map, copies);
@@ -114,34 +142,20 @@ void TextureCache<P>::RunGarbageCollector() {
             SwizzleImage(*gpu_memory, image.gpu_addr, image.info, copies, map.mapped_span,
                          swizzle_data_buffer);
         }
+        --num_evictions;
+        memory_budget.RecordEviction(image.budget_class, image.budget_bytes);
         if (True(image.flags & ImageFlagBits::Tracked)) {
-            UntrackImage(image, image_id);
+            UntrackImage(image, candidate.image_id);
         }
-        UnregisterImage(image_id);
-        DeleteImage(image_id, image.scale_tick > frame_tick + 5);
-        if (total_used_memory < critical_memory) {
-            if (aggressive_mode) {
-                // Sink the aggresiveness.
-                num_iterations >>= 2;
-                aggressive_mode = false;
-                return false;
-            }
-            if (high_priority_mode && total_used_memory < expected_memory) {
-                num_iterations >>= 1;
-                high_priority_mode = false;
-            }
-        }
-        return false;
-    };
-
-    // Try to remove anything old enough and not high priority.
-    Configure(false);
-    lru_cache.ForEachItemBelow(frame_tick - ticks_to_destroy, Cleanup);
+        UnregisterImage(candidate.image_id);
+        DeleteImage(candidate.image_id, image.scale_tick > frame_tick + 5);
 
-    // If pressure is still too high, prune aggressively.
-    if (total_used_memory >= critical_memory) {
-        Configure(true);
-        lru_cache.ForEachItemBelow(frame_tick - ticks_to_destroy, Cleanup);
+        // Sink the pressure as memory is released
+        const MemoryPressure new_pressure = memory_budget.GetPressure(total_used_memory);
+        if (new_pressure < pressure) {
+            pressure = new_pressure;
+            num_evictions = std::min(num_evictions, MemoryBudget::GetMaxEvictions(pressure));
+        }
     }
 }
 
@@ -151,9 +165,10 @@ void TextureCache<P>::TickFrame() {
     if (runtime.CanReportMemoryUsage()) {
         total_used_memory = runtime.GetDeviceMemoryUsage();
     }
-    if (total_used_memory > minimum_memory) {
+    if (memory_budget.GetPressure(total_used_memory) != MemoryPressure::None) {
         RunGarbageCollector();
     }
+    memory_budget.TickFrame(total_used_memory);
     sentenced_images.Tick();
     sentenced_framebuffers.Tick();
     sentenced_image_view.Tick();
@@ -1279,6 +1294,60 @@ u64 TextureCache<P>::GetScaledImageSizeBytes(const ImageBase& image) {
     return fitted_size;
 }
 
+template <class P>
+u64 TextureCache<P>::GetImageBudgetBytes(const ImageBase& image) {
+    u64 tentative_size = std::max(image.guest_size_bytes, image.unswizzled_size_bytes);
+    if ((IsPixelFormatASTC(image.info.format) &&
+         True(image.flags & ImageFlagBits::AcceleratedUpload)) ||
+        True(image.flags & ImageFlagBits::Converted)) {
+        tentative_size = TranscodedAstcSize(tentative_size, image.info.format);
+    }
+    u64 budget_bytes = Common::AlignUp(tentative_size, 1024);
+    if (image.HasScaled()) {
+        budget_bytes += GetScaledImageSizeBytes(image);
+    }
+    return budget_bytes;
+}
+
+template <class P>
+u64 TextureCache<P>::GetRecompressionSavedBytes(const ImageBase& image) {
+    const auto recompression = Settings::values.astc_recompression.GetValue();
+    if (!IsPixelFormatASTC(image.info.format) ||
+        recompression == Settings::AstcRecompression::Uncompressed ||
+        False(image.flags & (ImageFlagBits::AcceleratedUpload | ImageFlagBits::Converted))) {
+        return 0;
+    }
+    const u64 transcoded_size = TranscodedAstcSize(
+        std::max(image.guest_size_bytes, image.unswizzled_size_bytes), image.info.format);
+    // RGBA8 takes 4 bytes per texel, BC1 half a byte and BC3 one byte
+    const u64 ratio = recompression == Settings::AstcRecompression::Bc1 ? 8 : 4;
+    return transcoded_size * (ratio - 1);
+}
+
+template <class P>
+void TextureCache<P>::UpdateImageBudget(ImageBase& image) {
+    ImageBudgetClass budget_class = ImageBudgetClass::Sampled;
+    if (True(image.flags & ImageFlagBits::Rescaled)) {
+        budget_class = ImageBudgetClass::Rescaled;
+    } else if (True(image.flags & ImageFlagBits::GpuModified)) {
+        budget_class = ImageBudgetClass::RenderTarget;
+    } else if (True(image.flags & (ImageFlagBits::CostlyLoad | ImageFlagBits::AsynchronousDecode |
+                                   ImageFlagBits::Converted))) {
+        budget_class = ImageBudgetClass::AsyncDecoded;
+    }
+    const u64 budget_bytes = GetImageBudgetBytes(image);
+    memory_budget.Remove(image.budget_class, image.budget_bytes);
+    memory_budget.Add(budget_class, budget_bytes);
+    total_used_memory = total_used_memory - image.budget_bytes + budget_bytes;
+    image.budget_class = budget_class;
+    image.budget_bytes = budget_bytes;
+
+    const u64 saved_bytes = GetRecompressionSavedBytes(image);
+    memory_budget.RemoveRecompressionSavings(image.recompression_saved_bytes);
+    memory_budget.AddRecompressionSavings(saved_bytes);
+    image.recompression_saved_bytes = saved_bytes;
+}
+
 template <class P>
 void TextureCache<P>::QueueAsyncDecode(Image& image, ImageId image_id) {
     UNIMPLEMENTED_IF(False(image.flags & ImageFlagBits::Converted));
@@ -1341,14 +1410,11 @@ void TextureCache<P>::TickAsyncDecode() {
 
 template <class P>
 bool TextureCache<P>::ScaleUp(Image& image) {
-    const bool has_copy = image.HasScaled();
     const bool rescaled = image.ScaleUp();
     if (!rescaled) {
         return false;
     }
-    if (!has_copy) {
-        total_used_memory += GetScaledImageSizeBytes(image);
-    }
+    UpdateImageBudget(image);
     InvalidateScale(image);
     return true;
 }
@@ -1359,6 +1425,7 @@ bool TextureCache<P>::ScaleDown(Image& image) {
     if (!rescaled) {
         return false;
     }
+    UpdateImageBudget(image);
     InvalidateScale(image);
     return true;
 }
@@ -1994,13 +2061,7 @@ void TextureCache<P>::RegisterImage(ImageId image_id) {
     ASSERT_MSG(False(image.flags & ImageFlagBits::Registered),
                "Trying to register an already registered image");
     image.flags |= ImageFlagBits::Registered;
-    u64 tentative_size = std::max(image.guest_size_bytes, image.unswizzled_size_bytes);
-    if ((IsPixelFormatASTC(image.info.format) &&
-         True(image.flags & ImageFlagBits::AcceleratedUpload)) ||
-        True(image.flags & ImageFlagBits::Converted)) {
-        tentative_size = TranscodedAstcSize(tentative_size, image.info.format);
-    }
-    total_used_memory += Common::AlignUp(tentative_size, 1024);
+    UpdateImageBudget(image);
     image.lru_index = lru_cache.Insert(image_id, frame_tick);
 
     ForEachGPUPage(image.gpu_addr, image.guest_size_bytes, [this, image_id](u64 page) {
@@ -2165,16 +2226,11 @@ void TextureCache<P>::UntrackImage(ImageBase& image, ImageId image_id) {
 template <class P>
 void TextureCache<P>::DeleteImage(ImageId image_id, bool immediate_delete) {
     ImageBase& image = slot_images[image_id];
-    if (image.HasScaled()) {
-        total_used_memory -= GetScaledImageSizeBytes(image);
-    }
-    u64 tentative_size = std::max(image.guest_size_bytes, image.unswizzled_size_bytes);
-    if ((IsPixelFormatASTC(image.info.format) &&
-         True(image.flags & ImageFlagBits::AcceleratedUpload)) ||
-        True(image.flags & ImageFlagBits::Converted)) {
-        tentative_size = TranscodedAstcSize(tentative_size, image.info.format);
-    }
-    total_used_memory -= Common::AlignUp(tentative_size, 1024);
+    memory_budget.Remove(image.budget_class, image.budget_bytes);
+    total_used_memory -= image.budget_bytes;
+    image.budget_bytes = 0;
+    memory_budget.RemoveRecompressionSavings(image.recompression_saved_bytes);
+    image.recompression_saved_bytes = 0;
     const GPUVAddr gpu_addr = image.gpu_addr;
     const auto alloc_it = image_allocs_table.find(gpu_addr);
     if (alloc_it == image_allocs_table.end()) {
@@ -2290,6 +2346,10 @@ template <class P>
 void TextureCache<P>::MarkModification(ImageBase& image) noexcept {
     image.flags |= ImageFlagBits::GpuModified;
     image.modification_tick = ++modification_tick;
+    if (image.budget_class != ImageBudgetClass::RenderTarget &&
+        image.budget_class != ImageBudgetClass::Rescaled) {
+        UpdateImageBudget(image);
+    }
 }
 
 template <class P>
@@ -2322,6 +2382,7 @@ void TextureCache<P>::SynchronizeAliases(ImageId image_id) {
     image.modification_tick = most_recent_tick;
     if (any_modified) {
         image.flags |= ImageFlagBits::GpuModified;
+        UpdateImageBudget(image);
     }
     std::ranges::sort(aliased_images, [this](const AliasedImage* lhs, const AliasedImage* rhs) {
         const ImageBase& lhs_image = slot_images[lhs->id];
@@ -35,6 +35,7 @@
 #include "video_core/texture_cache/image_base.h"
 #include "video_core/texture_cache/image_info.h"
 #include "video_core/texture_cache/image_view_base.h"
+#include "video_core/texture_cache/memory_budget.h"
 #include "video_core/texture_cache/render_targets.h"
 #include "video_core/texture_cache/types.h"
 #include "video_core/textures/texture.h"
@@ -137,6 +138,11 @@ public:
     /// Notify the cache that a new frame has been queued
     void TickFrame();
 
+    /// Returns the memory budget counters of the last frame
+    [[nodiscard]] const MemoryBudget::Stats& GetMemoryBudgetStats() const noexcept {
+        return memory_budget.GetStats();
+    }
+
     /// Return a constant reference to the given image view id
     [[nodiscard]] const ImageView& GetImageView(ImageViewId id) const noexcept;
 
@@ -292,6 +298,9 @@ private:
     /// Runs the Garbage Collector.
     void RunGarbageCollector();
 
+    /// Evicts the least recently used images ranked by the memory budget at the given pressure
+    void EvictImages(MemoryPressure pressure);
+
     /// Fills image_view_ids in the image views in indices
     template <bool has_blacklists>
     void FillImageViews(DescriptorTable<TICEntry>& table,
@@ -422,6 +431,15 @@ private:
     bool ScaleDown(Image& image);
     u64 GetScaledImageSizeBytes(const ImageBase& image);
 
+    /// Returns the memory the texture cache accounts for an image
+    [[nodiscard]] u64 GetImageBudgetBytes(const ImageBase& image);
+
+    /// Returns the memory saved by storing a decoded ASTC image recompressed to BCn
+    [[nodiscard]] u64 GetRecompressionSavedBytes(const ImageBase& image);
+
+    /// Updates the budget class and memory charged for an image after its state changed
+    void UpdateImageBudget(ImageBase& image);
+
     void QueueAsyncDecode(Image& image, ImageId image_id);
     void TickAsyncDecode();
 
@@ -442,9 +460,14 @@ private:
     bool has_deleted_images = false;
     bool is_rescaling = false;
     u64 total_used_memory = 0;
-    u64 minimum_memory;
-    u64 expected_memory;
-    u64 critical_memory;
+    MemoryBudget memory_budget;
+
+    struct GcCandidate {
+        ImageId image_id;
+        u64 priority;
+        u64 size;
+    };
+    std::vector<GcCandidate> gc_candidates;
 
     struct BufferDownload {
         GPUVAddr address;
@@ -968,9 +968,11 @@ void ConvertImage(std::span<const u8> input, const ImageInfo& info, std::span<u8
                 copy.image_subresource.num_layers * copy.image_extent.depth, tile_size.width,
                 tile_size.height, decode_scratch);
 
+            const bool high_quality = Settings::values.astc_recompression_quality.GetValue() ==
+                                      Settings::AstcRecompressionQuality::High;
             compress(decode_scratch, copy.image_extent.width, copy.image_extent.height,
                      copy.image_subresource.num_layers * copy.image_extent.depth,
-                     output.subspan(output_offset));
+                     output.subspan(output_offset), high_quality);
 
             const u32 aligned_plane_dim = Common::AlignUp(copy.image_extent.width, 4) *
                                           Common::AlignUp(copy.image_extent.height, 4);
@@ -9,20 +9,21 @@
 
 namespace Tegra::Texture::BCN {
 
-using BCNCompressor = void(u8* block_output, const u8* block_input, bool any_alpha);
+using BCNCompressor = void(u8* block_output, const u8* block_input, bool any_alpha, int mode);
 
 template <u32 BytesPerBlock, bool ThresholdAlpha = false>
 void CompressBCN(std::span<const uint8_t> data, uint32_t width, uint32_t height, uint32_t depth,
-                 std::span<uint8_t> output, BCNCompressor f) {
+                 std::span<uint8_t> output, bool high_quality, BCNCompressor f) {
     constexpr u8 alpha_threshold = 128;
     constexpr u32 bytes_per_px = 4;
     const u32 plane_dim = width * height;
+    const int mode = high_quality ? STB_DXT_HIGHQUAL : STB_DXT_NORMAL;
 
     Common::ThreadWorker& workers{GetThreadWorkers()};
 
     for (u32 z = 0; z < depth; z++) {
         for (u32 y = 0; y < height; y += 4) {
-            auto compress_row = [z, y, width, height, plane_dim, f, data, output]() {
+            auto compress_row = [z, y, width, height, plane_dim, mode, f, data, output]() {
                 for (u32 x = 0; x < width; x += 4) {
                     // Gather 4x4 block of RGBA texels
                     u8 input_colors[4][4][4];
@@ -57,7 +58,7 @@ void CompressBCN(std::span<const uint8_t> data, uint32_t width, uint32_t height,
                     const u32 bytes_per_plane = bytes_per_row * Common::DivideUp(height, 4U);
                     f(output.data() + z * bytes_per_plane + (y / 4) * bytes_per_row +
                           (x / 4) * BytesPerBlock,
-                      reinterpret_cast<u8*>(input_colors), any_alpha);
+                      reinterpret_cast<u8*>(input_colors), any_alpha, mode);
                 }
             };
             workers.QueueWork(std::move(compress_row));
@@ -67,19 +68,18 @@ void CompressBCN(std::span<const uint8_t> data, uint32_t width, uint32_t height,
 }
 
 void CompressBC1(std::span<const uint8_t> data, uint32_t width, uint32_t height, uint32_t depth,
-                 std::span<uint8_t> output) {
-    CompressBCN<8, true>(data, width, height, depth, output,
-                         [](u8* block_output, const u8* block_input, bool any_alpha) {
-                             stb_compress_bc1_block(block_output, block_input, any_alpha,
-                                                    STB_DXT_NORMAL);
+                 std::span<uint8_t> output, bool high_quality) {
+    CompressBCN<8, true>(data, width, height, depth, output, high_quality,
+                         [](u8* block_output, const u8* block_input, bool any_alpha, int mode) {
+                             stb_compress_bc1_block(block_output, block_input, any_alpha, mode);
                          });
 }
 
 void CompressBC3(std::span<const uint8_t> data, uint32_t width, uint32_t height, uint32_t depth,
-                 std::span<uint8_t> output) {
-    CompressBCN<16, false>(data, width, height, depth, output,
-                           [](u8* block_output, const u8* block_input, bool any_alpha) {
-                               stb_compress_bc3_block(block_output, block_input, STB_DXT_NORMAL);
+                 std::span<uint8_t> output, bool high_quality) {
+    CompressBCN<16, false>(data, width, height, depth, output, high_quality,
+                           [](u8* block_output, const u8* block_input, bool any_alpha, int mode) {
+                               stb_compress_bc3_block(block_output, block_input, mode);
                            });
 }
 
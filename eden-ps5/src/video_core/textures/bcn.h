@@ -9,8 +9,11 @@
 
 namespace Tegra::Texture::BCN {
 
-void CompressBC1(std::span<const u8> data, u32 width, u32 height, u32 depth, std::span<u8> output);
+/// When high_quality is set the endpoints are refined further at a higher encoding cost
+void CompressBC1(std::span<const u8> data, u32 width, u32 height, u32 depth, std::span<u8> output,
+                 bool high_quality);
 
-void CompressBC3(std::span<const u8> data, u32 width, u32 height, u32 depth, std::span<u8> output);
+void CompressBC3(std::span<const u8> data, u32 width, u32 height, u32 depth, std::span<u8> output,
+                 bool high_quality);
 
 } // namespace Tegra::Texture::BCN
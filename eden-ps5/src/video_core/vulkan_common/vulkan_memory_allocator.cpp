@@ -221,8 +221,16 @@ namespace Vulkan {
     }
 
     vk::Buffer
-    MemoryAllocator::CreateBuffer(const VkBufferCreateInfo &ci, MemoryUsage usage) const
+    MemoryAllocator::CreateBuffer(const VkBufferCreateInfo &buffer_ci, MemoryUsage usage) const
     {
+        VkBufferCreateInfo ci = buffer_ci;
+        // Descriptor buffers reference uniform and storage buffers by their device address
+        constexpr VkBufferUsageFlags addressable_usage =
+                VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+        if (device.IsExtDescriptorBufferSupported() && (ci.usage & addressable_usage) != 0) {
+            ci.usage |= VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
+        }
+
         const VmaAllocationCreateInfo alloc_ci = {
                 .flags = VMA_ALLOCATION_CREATE_WITHIN_BUDGET_BIT | MemoryUsageVmaFlags(usage),
                 .usage = MemoryUsageVma(usage),
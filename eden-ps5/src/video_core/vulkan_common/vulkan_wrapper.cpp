@@ -95,6 +95,7 @@ void Load(VkDevice device, DeviceDispatch& dld) noexcept {
     X(vkCmdBeginRenderPass);
     X(vkCmdBeginTransformFeedbackEXT);
     X(vkCmdBeginDebugUtilsLabelEXT);
+    X(vkCmdBindDescriptorBuffersEXT);
     X(vkCmdBindDescriptorSets);
     X(vkCmdBindIndexBuffer);
     X(vkCmdBindPipeline);
@@ -123,6 +124,7 @@ void Load(VkDevice device, DeviceDispatch& dld) noexcept {
     X(vkCmdResetQueryPool);
     X(vkCmdEndTransformFeedbackEXT);
     X(vkCmdEndDebugUtilsLabelEXT);
+    X(vkCmdExecuteCommands);
     X(vkCmdFillBuffer);
     X(vkCmdPipelineBarrier);
     X(vkCmdPushConstants);
@@ -131,6 +133,7 @@ void Load(VkDevice device, DeviceDispatch& dld) noexcept {
     X(vkCmdSetDepthBias);
     X(vkCmdSetDepthBias2EXT);
     X(vkCmdSetDepthBounds);
+    X(vkCmdSetDescriptorBufferOffsetsEXT);
     X(vkCmdSetEvent);
     X(vkCmdSetScissor);
     X(vkCmdSetStencilCompareMask);
@@ -210,7 +213,11 @@ void Load(VkDevice device, DeviceDispatch& dld) noexcept {
     X(vkFreeCommandBuffers);
     X(vkFreeDescriptorSets);
     X(vkFreeMemory);
+    X(vkGetBufferDeviceAddress);
     X(vkGetBufferMemoryRequirements2);
+    X(vkGetDescriptorEXT);
+    X(vkGetDescriptorSetLayoutBindingOffsetEXT);
+    X(vkGetDescriptorSetLayoutSizeEXT);
     X(vkGetDeviceQueue);
     X(vkGetEventStatus);
     X(vkGetFenceStatus);
@@ -247,6 +254,11 @@ void Load(VkDevice device, DeviceDispatch& dld) noexcept {
         Proc(dld.vkResetQueryPool, dld, "vkResetQueryPoolEXT", device);
     }
 
+    // Support for buffer device addresses is mandatory in Vulkan 1.3
+    if (!dld.vkGetBufferDeviceAddress) {
+        Proc(dld.vkGetBufferDeviceAddress, dld, "vkGetBufferDeviceAddressKHR", device);
+    }
+
     // Support for draw indirect with count is optional in Vulkan 1.2
     if (!dld.vkCmdDrawIndirectCount) {
         Proc(dld.vkCmdDrawIndirectCount, dld, "vkCmdDrawIndirectCountKHR", device);
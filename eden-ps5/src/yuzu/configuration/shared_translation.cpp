@@ -245,6 +245,13 @@ std::unique_ptr<TranslationMap> InitializeTranslations(QWidget* parent)
            "the emulator to decompress to an intermediate format any card supports, RGBA8.\n"
            "This option recompresses RGBA8 to either the BC1 or BC3 format, saving VRAM but "
            "negatively affecting image quality."));
+    INSERT(Settings,
+           astc_recompression_quality,
+           tr("ASTC Recompression Quality:"),
+           tr("Trades recompression speed for image quality when ASTC textures are recompressed.\n"
+              "Fast: Picks the endpoints of each block from a rough estimate.\n"
+              "Normal: Matches the quality of the CPU encoder.\n"
+              "High: Refines the endpoints of each block further, taking more time."));
     INSERT(Settings,
            vram_usage_mode,
            tr("VRAM Usage Mode:"),
@@ -319,6 +326,30 @@ std::unique_ptr<TranslationMap> InitializeTranslations(QWidget* parent)
            tr("Enables GPU vendor-specific pipeline cache.\nThis option can improve shader loading "
               "time significantly in cases where the Vulkan driver does not store pipeline cache "
               "files internally."));
+    INSERT(Settings,
+           use_graphics_pipeline_library,
+           tr("Use graphics pipeline libraries"),
+           tr("Builds new pipelines from separately compiled parts when the driver supports "
+              "VK_EXT_graphics_pipeline_library.\nThis reduces shader stutter, while a fully "
+              "optimized pipeline is built in the background."));
+    INSERT(Settings,
+           use_descriptor_buffer,
+           tr("Use descriptor buffers (Experimental)"),
+           tr("Writes shader resource descriptors directly into GPU memory when the driver "
+              "supports VK_EXT_descriptor_buffer.\nThis lowers the CPU cost of draws that "
+              "change textures or buffers often."));
+    INSERT(Settings,
+           use_parallel_command_recording,
+           tr("Parallel command recording (Experimental)"),
+           tr("Splits large render passes into secondary command buffers recorded on several "
+              "threads.\nThis helps games with high draw counts that are limited by the Vulkan "
+              "worker thread."));
+    INSERT(Settings,
+           optimize_shader_ir,
+           tr("Eliminate redundant shader instructions (Experimental)"),
+           tr("Removes repeated constant buffer loads, attribute reads and texture samples from "
+              "translated shaders, and moves loop invariant math out of loops.\nShaders take "
+              "slightly longer to build."));
     INSERT(
         Settings,
         enable_compute_pipelines,
@@ -502,6 +533,12 @@ std::unique_ptr<ComboboxTranslationMap> ComboboxEnumeration(QWidget* parent)
              PAIR(AstcRecompression, Bc1, tr("BC1 (Low quality)")),
              PAIR(AstcRecompression, Bc3, tr("BC3 (Medium quality)")),
          }});
+    translations->insert({Settings::EnumMetadata<Settings::AstcRecompressionQuality>::Index(),
+                          {
+                              PAIR(AstcRecompressionQuality, Fast, tr("Fast")),
+                              PAIR(AstcRecompressionQuality, Normal, tr("Normal")),
+                              PAIR(AstcRecompressionQuality, High, tr("High")),
+                          }});
     translations->insert({Settings::EnumMetadata<Settings::VramUsageMode>::Index(),
                           {
                               PAIR(VramUsageMode, Conservative, tr("Conservative")),
@@ -0,0 +1,81 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <algorithm>
+#include <iostream>
+
+#include <SDL.h>
+
+#include "common/fs/file.h"
+#include "common/logging/log.h"
+#include "common/settings.h"
+#include "core/core.h"
+#include "core/perf_stats.h"
+#include "yuzu_cmd/benchmark.h"
+#include "yuzu_cmd/emu_window/emu_window_sdl2.h"
+
+namespace {
+using DoubleMs = std::chrono::duration<double, std::milli>;
+} // Anonymous namespace
+
+Benchmark::Benchmark(u64 num_frames_, std::string output_path_)
+    : output_path{std::move(output_path_)} {
+    report.frames_requested = num_frames_;
+}
+
+void Benchmark::ConfigureSettings() {
+    // The null renderer only needs a window handle, the dummy driver provides one without a
+    // display. An SDL_VIDEODRIVER set in the environment takes precedence.
+    SDL_SetHint(SDL_HINT_VIDEODRIVER, "dummy");
+
+    Settings::values.renderer_backend.SetValue(Settings::RendererBackend::Null);
+    // Multicore timing depends on how the host schedules the core threads
+    Settings::values.use_multi_core.SetValue(false);
+    Settings::values.use_speed_limit.SetValue(false);
+    Settings::values.rng_seed_enabled.SetValue(true);
+}
+
+void Benchmark::Run(Core::System& system, EmuWindow_SDL2& emu_window) {
+    const auto& perf_stats = system.GetPerfStats();
+    const u64 num_frames = report.frames_requested;
+    report.program_id = system.GetApplicationProcessProgramID();
+    report.multi_core = Settings::values.use_multi_core.GetValue();
+
+    Common::SubsystemProfiler::Reset();
+    Common::SubsystemProfiler::SetEnabled(true);
+    const auto start = std::chrono::steady_clock::now();
+
+    while (!stop_requested && emu_window.IsOpen() &&
+           perf_stats.GetTotalSystemFrames() < num_frames) {
+        emu_window.WaitEventTimeout(std::chrono::milliseconds{1});
+    }
+
+    report.wall_time = std::chrono::steady_clock::now() - start;
+    report.subsystem_totals = Common::SubsystemProfiler::GetTotals();
+    Common::SubsystemProfiler::SetEnabled(false);
+
+    report.frames_run = std::min(perf_stats.GetTotalSystemFrames(), num_frames);
+    report.frametimes = perf_stats.GetFrametimeHistory();
+    report.frametimes.resize(std::min<size_t>(report.frametimes.size(), report.frames_run));
+    LOG_INFO(Frontend, "Benchmark ran {} of {} frames in {:.2f} ms", report.frames_run, num_frames,
+             DoubleMs{report.wall_time}.count());
+}
+
+void Benchmark::Stop() {
+    stop_requested = true;
+}
+
+bool Benchmark::WriteReport() const {
+    const std::string formatted = Common::FormatBenchmarkReport(report);
+    if (output_path.empty()) {
+        std::cout << formatted;
+        return true;
+    }
+    const auto written =
+        Common::FS::WriteStringToFile(output_path, Common::FS::FileType::TextFile, formatted);
+    if (written != formatted.size()) {
+        LOG_ERROR(Frontend, "Failed to write the benchmark report to {}", output_path);
+        return false;
+    }
+    return true;
+}
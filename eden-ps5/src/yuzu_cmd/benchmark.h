@@ -0,0 +1,53 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <atomic>
+#include <string>
+
+#include "common/benchmark_report.h"
+#include "common/common_types.h"
+
+class EmuWindow_SDL2;
+
+namespace Core {
+class System;
+}
+
+/**
+ * Runs a title headless for a fixed number of guest frames and reports the frametimes and the
+ * host time spent in each emulator subsystem as JSON. Runs are made reproducible by rendering
+ * with the null backend, emulating on a single core, disabling the speed limit and seeding the
+ * guest RNG.
+ */
+class Benchmark {
+public:
+    explicit Benchmark(u64 num_frames_, std::string output_path_);
+
+    /// Overrides the settings that would make runs differ. Must be called before the system
+    /// applies its settings.
+    void ConfigureSettings();
+
+    /// Emulates until num_frames guest frames were presented, the window was closed or the guest
+    /// exited. The system must be running.
+    void Run(Core::System& system, EmuWindow_SDL2& emu_window);
+
+    /// Stops the run early, callable from any thread.
+    void Stop();
+
+    /// Writes the report of the last run to the output path, or stdout when it is empty.
+    /// Returns false when the report could not be written.
+    bool WriteReport() const;
+
+    /// Returns true when the last run presented every requested frame.
+    [[nodiscard]] bool Completed() const {
+        return report.Completed();
+    }
+
+private:
+    std::string output_path;
+    std::atomic<bool> stop_requested{false};
+
+    Common::BenchmarkReport report;
+};
@@ -11,6 +11,7 @@
 #include "hid_core/hid_core.h"
 #include "input_common/drivers/keyboard.h"
 #include "input_common/drivers/mouse.h"
+#include "input_common/drivers/tas_input.h"
 #include "input_common/drivers/touch_screen.h"
 #include "input_common/main.h"
 #include "yuzu_cmd/emu_window/emu_window_sdl2.h"
@@ -167,6 +168,23 @@ void EmuWindow_SDL2::WaitEvent() {
         exit(1);
     }
 
+    OnEvent(event);
+}
+
+void EmuWindow_SDL2::WaitEventTimeout(std::chrono::milliseconds timeout) {
+    // Called on main thread
+    SDL_Event event;
+
+    if (SDL_WaitEventTimeout(&event, static_cast<int>(timeout.count()))) {
+        OnEvent(event);
+    }
+}
+
+void EmuWindow_SDL2::OnFrameDisplayed() {
+    input_subsystem->GetTas()->UpdateThread();
+}
+
+void EmuWindow_SDL2::OnEvent(const SDL_Event& event) {
     switch (event.type) {
     case SDL_WINDOWEVENT:
         switch (event.window.event) {
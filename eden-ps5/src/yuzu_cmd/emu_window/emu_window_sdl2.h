@@ -3,12 +3,14 @@
 
 #pragma once
 
+#include <chrono>
 #include <utility>
 
 #include "core/frontend/emu_window.h"
 #include "core/frontend/graphics_context.h"
 
 struct SDL_Window;
+union SDL_Event;
 
 namespace Core {
 class System;
@@ -33,10 +35,19 @@ public:
     /// Wait for the next event on the main thread.
     void WaitEvent();
 
+    /// Wait for the next event on the main thread, giving up after timeout.
+    void WaitEventTimeout(std::chrono::milliseconds timeout);
+
+    /// Advances the TAS playback by one frame
+    void OnFrameDisplayed() override;
+
     // Sets the window icon from yuzu.bmp
     void SetWindowIcon();
 
 protected:
+    /// Called by WaitEvent and WaitEventTimeout for every received event.
+    void OnEvent(const SDL_Event& event);
+
     /// Called by WaitEvent when a key is pressed or released.
     void OnKeyEvent(int key, u8 state);
 
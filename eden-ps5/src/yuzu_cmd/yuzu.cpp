@@ -14,6 +14,7 @@
 #include <fmt/ostream.h>
 
 #include "common/detached_tasks.h"
+#include "common/fs/path_util.h"
 #include "common/logging/backend.h"
 #include "common/logging/log.h"
 #include "common/nvidia_flags.h"
@@ -31,10 +32,12 @@
 #include "core/hle/service/filesystem/filesystem.h"
 #include "core/loader/loader.h"
 #include "frontend_common/config.h"
+#include "input_common/drivers/tas_input.h"
 #include "input_common/main.h"
 #include "network/network.h"
 #include "sdl_config.h"
 #include "video_core/renderer_base.h"
+#include "yuzu_cmd/benchmark.h"
 #include "yuzu_cmd/emu_window/emu_window_sdl2.h"
 #include "yuzu_cmd/emu_window/emu_window_sdl2_gl.h"
 #include "yuzu_cmd/emu_window/emu_window_sdl2_null.h"
@@ -71,6 +74,9 @@ __declspec(dllexport) int AmdPowerXpressRequestHighPerformance = 1;
 static void PrintHelp(const char* argv0) {
     std::cout << "Usage: " << argv0
               << " [options] <filename>\n"
+                 "-b, --benchmark=frames Run headless for a number of guest frames and report"
+                 " timings as JSON\n"
+                 "-o, --benchmark-output Write the benchmark report to a file instead of stdout\n"
                  "-c, --config          Load the specified configuration file\n"
                  "-f, --fullscreen      Start in fullscreen mode\n"
                  "-g, --game            File path of the game to load\n"
@@ -78,6 +84,7 @@ static void PrintHelp(const char* argv0) {
                  "-m, --multiplayer=nick:password@address:port"
                  " Nickname, password, address and port for multiplayer\n"
                  "-p, --program         Pass following string as arguments to executable\n"
+                 "-t, --tas             Play the TAS scripts of a directory from the first frame\n"
                  "-u, --user            Select a specific user profile from 0 to 7\n"
                  "-d, --debug           Run the GDB stub on a port from 1 to 65535\n"
                  "-v, --version         Output version information and exit\n";
@@ -213,6 +220,9 @@ int main(int argc, char** argv) {
     std::optional<u16> override_gdb_port{};
     bool use_multiplayer = false;
     bool fullscreen = false;
+    std::optional<u64> benchmark_frames{};
+    std::string benchmark_output{};
+    std::optional<std::string> tas_path{};
     std::string nickname{};
     std::string password{};
     std::string address{};
@@ -221,12 +231,15 @@ int main(int argc, char** argv) {
     static struct option long_options[] = {
         // clang-format off
         {"debug", no_argument, 0, 'd'},
+        {"benchmark", required_argument, 0, 'b'},
+        {"benchmark-output", required_argument, 0, 'o'},
         {"config", required_argument, 0, 'c'},
         {"fullscreen", no_argument, 0, 'f'},
         {"help", no_argument, 0, 'h'},
         {"game", required_argument, 0, 'g'},
         {"multiplayer", required_argument, 0, 'm'},
         {"program", optional_argument, 0, 'p'},
+        {"tas", required_argument, 0, 't'},
         {"user", required_argument, 0, 'u'},
         {"version", no_argument, 0, 'v'},
         {0, 0, 0, 0},
@@ -234,12 +247,22 @@ int main(int argc, char** argv) {
     };
 
     while (optind < argc) {
-        int arg = getopt_long(argc, argv, "g:fhvp::c:u:d:", long_options, &option_index);
+        int arg = getopt_long(argc, argv, "g:fhvp::c:u:d:b:o:t:", long_options, &option_index);
         if (arg != -1) {
             switch (static_cast<char>(arg)) {
             case 'd':
                 override_gdb_port = static_cast<uint16_t>(atoi(optarg));
                 break;
+            case 'b':
+                benchmark_frames = std::strtoull(optarg, nullptr, 0);
+                if (*benchmark_frames == 0) {
+                    std::cout << "The benchmark must run at least one frame.\n";
+                    return -1;
+                }
+                break;
+            case 'o':
+                benchmark_output = optarg;
+                break;
             case 'c':
                 config_path = optarg;
                 break;
@@ -292,6 +315,9 @@ int main(int argc, char** argv) {
                 program_args = argv[optind];
                 ++optind;
                 break;
+            case 't':
+                tas_path = optarg;
+                break;
             case 'u':
                 selected_user = atoi(optarg);
                 break;
@@ -330,6 +356,17 @@ int main(int argc, char** argv) {
         Settings::values.gdbstub_port = *override_gdb_port;
     }
 
+    if (tas_path.has_value()) {
+        Common::FS::SetEdenPath(Common::FS::EdenPath::TASDir, *tas_path);
+        Settings::values.tas_enable = true;
+    }
+
+    std::unique_ptr<Benchmark> benchmark;
+    if (benchmark_frames.has_value()) {
+        benchmark = std::make_unique<Benchmark>(*benchmark_frames, benchmark_output);
+        benchmark->ConfigureSettings();
+    }
+
 #ifdef _WIN32
     LocalFree(argv_w);
 #endif
@@ -432,10 +469,19 @@ int main(int argc, char** argv) {
     }
 
     system.RegisterExitCallback([&] {
+        if (benchmark) {
+            // Report the frames run so far
+            benchmark->Stop();
+            return;
+        }
         // Just exit right away.
         exit(0);
     });
 
+    if (tas_path.has_value()) {
+        input_subsystem.GetTas()->StartStop();
+    }
+
 #ifdef __linux__
     Common::Linux::StartGamemode();
 #endif
@@ -444,11 +490,20 @@ int main(int argc, char** argv) {
     if (system.DebuggerEnabled()) {
         system.InitializeDebugger();
     }
-    while (emu_window->IsOpen()) {
-        emu_window->WaitEvent();
+    if (benchmark) {
+        benchmark->Run(system, *emu_window);
+    } else {
+        while (emu_window->IsOpen()) {
+            emu_window->WaitEvent();
+        }
     }
     system.DetachDebugger();
     void(system.Pause());
+
+    bool benchmark_passed = true;
+    if (benchmark) {
+        benchmark_passed = benchmark->WriteReport() && benchmark->Completed();
+    }
     system.ShutdownMainProcess();
 
 #ifdef __linux__
@@ -456,5 +511,5 @@ int main(int argc, char** argv) {
 #endif
 
     detached_tasks.WaitForAllTasks();
-    return 0;
+    return benchmark_passed ? 0 : 1;
 }
@@ -0,0 +1,267 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// Simulates a number of room members that broadcast packets to each other at a fixed rate, and
+// reports the throughput and delivery latency of the room.
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "common/common_types.h"
+#include "common/logging/backend.h"
+#include "common/logging/log.h"
+#include "network/network.h"
+#include "network/room.h"
+#include "network/room_member.h"
+#include "network/verify_user.h"
+
+#undef _UNICODE
+#include <getopt.h>
+
+namespace {
+using Clock = std::chrono::steady_clock;
+using DoubleMs = std::chrono::duration<double, std::milli>;
+
+/// Bytes at the start of each payload: the send time and the index of the sender
+constexpr size_t HeaderSize = sizeof(u64) + sizeof(u32);
+
+struct Client {
+    std::unique_ptr<Network::RoomMember> member;
+    Network::RoomMember::CallbackHandle<Network::ProxyPacket> proxy_handle;
+    Network::RoomMember::CallbackHandle<Network::LDNPacket> ldn_handle;
+
+    u64 sent{};
+    std::mutex latency_mutex;
+    std::vector<double> latencies_ms;
+};
+
+void PrintHelp(const char* argv0) {
+    std::cout << "Usage: " << argv0
+              << " [options]\n"
+                 "-a, --address   Address of the room, a local room is hosted when omitted\n"
+                 "-p, --port      Port of the room\n"
+                 "-n, --clients   Number of simulated members\n"
+                 "-r, --rate      Broadcasts sent per second by each member\n"
+                 "-s, --size      Payload size of each broadcast in bytes\n"
+                 "-d, --duration  Duration of the measurement in seconds\n"
+                 "-l, --ldn       Send LDN packets instead of proxy packets\n"
+                 "-h, --help      Display this help and exit\n";
+}
+
+void RecordPacket(Client& client, const std::vector<u8>& data) {
+    if (data.size() < HeaderSize) {
+        return;
+    }
+    u64 send_time;
+    std::memcpy(&send_time, data.data(), sizeof(send_time));
+    const auto latency = Clock::now().time_since_epoch() - Clock::duration{send_time};
+
+    std::scoped_lock lk{client.latency_mutex};
+    client.latencies_ms.push_back(DoubleMs{latency}.count());
+}
+
+void SendPacket(Client& client, u32 index, size_t size, bool use_ldn) {
+    std::vector<u8> data(std::max(size, HeaderSize));
+    const u64 send_time = static_cast<u64>(Clock::now().time_since_epoch().count());
+    std::memcpy(data.data(), &send_time, sizeof(send_time));
+    std::memcpy(data.data() + sizeof(send_time), &index, sizeof(index));
+
+    const Network::IPv4Address local_ip = client.member->GetFakeIpAddress();
+    if (use_ldn) {
+        client.member->SendLdnPacket({
+            .type = Network::LDNPacketType::SyncNetwork,
+            .local_ip = local_ip,
+            .remote_ip = {},
+            .broadcast = true,
+            .data = std::move(data),
+        });
+    } else {
+        client.member->SendProxyPacket({
+            .local_endpoint = {Network::Domain::INET, local_ip, 0},
+            .remote_endpoint = {Network::Domain::INET, {255, 255, 255, 255}, 0},
+            .protocol = Network::Protocol::UDP,
+            .broadcast = true,
+            .data = std::move(data),
+        });
+    }
+    ++client.sent;
+}
+
+bool AllJoined(const std::vector<std::unique_ptr<Client>>& clients) {
+    return std::ranges::all_of(clients, [](const auto& client) {
+        const auto state = client->member->GetState();
+        return state == Network::RoomMember::State::Joined ||
+               state == Network::RoomMember::State::Moderator;
+    });
+}
+
+double Percentile(const std::vector<double>& sorted, double fraction) {
+    if (sorted.empty()) {
+        return 0.0;
+    }
+    return sorted[static_cast<size_t>(fraction * static_cast<double>(sorted.size() - 1))];
+}
+} // Anonymous namespace
+
+int main(int argc, char** argv) {
+    Common::Log::Initialize();
+    Common::Log::SetColorConsoleBackendEnabled(true);
+    Common::Log::Start();
+
+    std::string address;
+    u16 port = Network::DefaultRoomPort;
+    u32 num_clients = 8;
+    u32 rate = 60;
+    size_t size = 512;
+    u32 duration = 10;
+    bool use_ldn = false;
+
+    static struct option long_options[] = {
+        // clang-format off
+        {"address", required_argument, 0, 'a'},
+        {"port", required_argument, 0, 'p'},
+        {"clients", required_argument, 0, 'n'},
+        {"rate", required_argument, 0, 'r'},
+        {"size", required_argument, 0, 's'},
+        {"duration", required_argument, 0, 'd'},
+        {"ldn", no_argument, 0, 'l'},
+        {"help", no_argument, 0, 'h'},
+        {0, 0, 0, 0},
+        // clang-format on
+    };
+
+    int option_index = 0;
+    int arg;
+    while ((arg = getopt_long(argc, argv, "a:p:n:r:s:d:lh", long_options, &option_index)) != -1) {
+        switch (static_cast<char>(arg)) {
+        case 'a':
+            address = optarg;
+            break;
+        case 'p':
+            port = static_cast<u16>(std::strtoul(optarg, nullptr, 0));
+            break;
+        case 'n':
+            num_clients = static_cast<u32>(std::strtoul(optarg, nullptr, 0));
+            break;
+        case 'r':
+            rate = static_cast<u32>(std::strtoul(optarg, nullptr, 0));
+            break;
+        case 's':
+            size = std::strtoull(optarg, nullptr, 0);
+            break;
+        case 'd':
+            duration = static_cast<u32>(std::strtoul(optarg, nullptr, 0));
+            break;
+        case 'l':
+            use_ldn = true;
+            break;
+        case 'h':
+            PrintHelp(argv[0]);
+            return 0;
+        default:
+            PrintHelp(argv[0]);
+            return -1;
+        }
+    }
+    if (num_clients < 2 || num_clients > Network::MaxConcurrentConnections || rate == 0 ||
+        duration == 0) {
+        std::cout << "At least two clients, a rate and a duration are required.\n";
+        return -1;
+    }
+
+    if (!Network::Init()) {
+        return -1;
+    }
+    if (address.empty()) {
+        address = "127.0.0.1";
+        auto room = Network::GetRoom().lock();
+        if (!room || !room->Create("Load generator", "", address, port, "", num_clients, "", {},
+                                   std::make_unique<Network::VerifyUser::NullBackend>())) {
+            LOG_CRITICAL(Network, "Failed to create the room on port {}", port);
+            Network::Shutdown();
+            return -1;
+        }
+    }
+
+    std::vector<std::unique_ptr<Client>> clients;
+    for (u32 index = 0; index < num_clients; ++index) {
+        auto& client = *clients.emplace_back(std::make_unique<Client>());
+        client.member = std::make_unique<Network::RoomMember>();
+        client.proxy_handle = client.member->BindOnProxyPacketReceived(
+            [&client](const Network::ProxyPacket& packet) { RecordPacket(client, packet.data); });
+        client.ldn_handle = client.member->BindOnLdnPacketReceived(
+            [&client](const Network::LDNPacket& packet) { RecordPacket(client, packet.data); });
+        client.member->Join(fmt::format("loadgen-{:03}", index), address.c_str(), port);
+    }
+
+    const auto join_deadline = Clock::now() + std::chrono::seconds{10};
+    while (!AllJoined(clients) && Clock::now() < join_deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds{10});
+    }
+    if (!AllJoined(clients)) {
+        LOG_CRITICAL(Network, "Not every client could join the room at {}:{}", address, port);
+        clients.clear();
+        Network::Shutdown();
+        return -1;
+    }
+    LOG_INFO(Network, "{} clients joined, broadcasting {} bytes {} times per second for {} s",
+             num_clients, size, rate, duration);
+
+    // Every client sends from its own thread, spread over the send interval
+    const auto interval = std::chrono::duration_cast<Clock::duration>(std::chrono::seconds{1}) /
+                          rate;
+    const auto start = Clock::now();
+    const auto end = start + std::chrono::seconds{duration};
+    {
+        std::vector<std::jthread> senders;
+        for (u32 index = 0; index < num_clients; ++index) {
+            senders.emplace_back([&, index] {
+                auto next_send = start + interval * index / num_clients;
+                while (next_send < end) {
+                    std::this_thread::sleep_until(next_send);
+                    SendPacket(*clients[index], index, size, use_ldn);
+                    next_send += interval;
+                }
+            });
+        }
+    }
+    // Let the packets in flight arrive
+    std::this_thread::sleep_for(std::chrono::seconds{1});
+
+    u64 sent = 0;
+    std::vector<double> latencies;
+    for (auto& client : clients) {
+        client->member->Leave();
+        sent += client->sent;
+        latencies.insert(latencies.end(), client->latencies_ms.begin(),
+                         client->latencies_ms.end());
+    }
+    clients.clear();
+    Network::Shutdown();
+
+    std::ranges::sort(latencies);
+    const u64 expected = sent * (num_clients - 1);
+    const u64 received = latencies.size();
+    std::cout << fmt::format("sent:       {} packets\n", sent);
+    std::cout << fmt::format("received:   {} of {} packets ({:.2f}%)\n", received, expected,
+                             expected == 0 ? 0.0
+                                           : 100.0 * static_cast<double>(received) /
+                                                 static_cast<double>(expected));
+    std::cout << fmt::format("throughput: {:.0f} packets/s\n",
+                             static_cast<double>(received) / static_cast<double>(duration));
+    std::cout << fmt::format("latency:    p50 {:.3f} ms, p99 {:.3f} ms, p99.9 {:.3f} ms, "
+                             "max {:.3f} ms\n",
+                             Percentile(latencies, 0.5), Percentile(latencies, 0.99),
+                             Percentile(latencies, 0.999),
+                             latencies.empty() ? 0.0 : latencies.back());
+    return received == expected ? 0 : 1;
+}